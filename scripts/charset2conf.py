@@ -3,8 +3,19 @@
 """
 Dirty hack to parse IANA charset names file:
 http://www.iana.org/assignments/character-sets
+
+Usage:
+  charset2conf.py [--c-source] IANA_CHARSETS_FILE
+
+By default a GKeyFile-style .conf is written to stdout. With --c-source
+a C source file is written instead, containing a static table of all
+charsets and a perfect hash of every (case-folded) name, MIME name and
+alias, so the library can look charsets up without parsing anything at
+runtime.
 """
 
+from __future__ import print_function
+
 
 CHARSET_FILE_PATH = "data/iana-charsets.txt"
 
@@ -13,8 +24,15 @@ import os, re, sys
 import datetime
 
 
-if len (sys.argv) > 1:
-  CHARSET_FILE_PATH = sys.argv[1]
+EMIT_C_SOURCE = False
+
+args = sys.argv[1:]
+if args and args[0] == "--c-source":
+  EMIT_C_SOURCE = True
+  args = args[1:]
+
+if len (args) > 0:
+  CHARSET_FILE_PATH = args[0]
 else:
   sys.stderr.write ("error: no data file specified\n")
   sys.exit (1)
@@ -70,43 +88,215 @@ for line in fobj:
         d["mime_name"] = alias
 
 
-count = -1
-
 time_stamp = datetime.datetime.now().strftime ("%d-%m-%Y %H:%M:%S")
 
-print '#'
-print '# Automatically generated from the IANA charset assignments:'
-print '#   http://www.iana.org/assignments/character-sets'
-print '#'
-print '# Statistics:'
-print '#   Number of charsets: %d' % name_cnt
-print '#   Most aliases for a charset: %d' % max_aliases
-print '#   Longest charset name: %d' % max_charset_len
-print '#   Date generated: %s' % time_stamp
-print '#'
 
+# normalize the parsed fields so both output formats see the same data
 for charset in charsets:
 
-  count += 1
+  charset["name"] = charset["name"].strip ()
 
   if "aliases" in charset and charset["aliases"] and charset["aliases"][0]:
     charset["aliases"] = [ a.strip () for a in charset["aliases"] ]
-    aliases_text = ';'.join (charset["aliases"])
   else:
-    aliases_text = ''
+    charset["aliases"] = []
 
-  if "mib_enum" in charset:
-    mib_ = charset["mib_enum"]
-  else:
-    mib_ = -1
+  if "mib_enum" not in charset:
+    charset["mib_enum"] = -1
 
   if "mime_name" in charset and charset["mime_name"]:
-    mime_name = charset["mime_name"].strip ()
+    charset["mime_name"] = charset["mime_name"].strip ()
   else:
-    mime_name = ''
+    charset["mime_name"] = ''
+
+
+def emit_conf ():
+
+  print ('#')
+  print ('# Automatically generated from the IANA charset assignments:')
+  print ('#   http://www.iana.org/assignments/character-sets')
+  print ('#')
+  print ('# Statistics:')
+  print ('#   Number of charsets: %d' % name_cnt)
+  print ('#   Most aliases for a charset: %d' % max_aliases)
+  print ('#   Longest charset name: %d' % max_charset_len)
+  print ('#   Date generated: %s' % time_stamp)
+  print ('#')
+
+  for charset in charsets:
+    print ('')
+    print ('[%s]' % charset["name"])
+    print ('mib_enum=%d' % charset["mib_enum"])
+    print ('mime_name=%s' % charset["mime_name"])
+    print ('aliases=%s' % ';'.join (charset["aliases"]))
+
+
+#
+# Perfect hash (hash-and-displace) over every case-folded name. The
+# hash function must stay in sync with charset_hash() in the emitted
+# C source below.
+#
+
+def charset_hash (key, seed):
+  h = (2166136261 ^ seed) & 0xffffffff
+  for c in key:
+    h ^= ord (c.lower ())
+    h = (h * 16777619) & 0xffffffff
+  return h
+
+def build_perfect_hash (keys):
+  n_buckets = max (1, len (keys) // 4)
+  n_slots = 1
+  while n_slots < len (keys):
+    n_slots <<= 1
 
-  print ''
-  print '[%s]' % charset["name"].strip ()
-  print 'mib_enum=%d' % mib_
-  print 'mime_name=%s' % mime_name
-  print 'aliases=%s' % aliases_text
+  buckets = [ [] for i in range (n_buckets) ]
+  for key, index in keys:
+    buckets[charset_hash (key, 0) % n_buckets].append ((key, index))
+
+  displacements = [0] * n_buckets
+  slots = [None] * n_slots
+
+  order = sorted (range (n_buckets), key=lambda b: -len (buckets[b]))
+  for b in order:
+    if not buckets[b]:
+      continue
+    seed = 1
+    while True:
+      taken = [ charset_hash (k, seed) % n_slots for k, i in buckets[b] ]
+      if len (set (taken)) == len (taken) and \
+         all (slots[s] is None for s in taken):
+        break
+      seed += 1
+      if seed > 0xffff:
+        sys.stderr.write ("error: failed to build perfect hash\n")
+        sys.exit (1)
+    displacements[b] = seed
+    for (k, i), s in zip (buckets[b], taken):
+      slots[s] = (k, i)
+
+  return displacements, slots
+
+def c_string (s):
+  return '"%s"' % s.replace ('\\', '\\\\').replace ('"', '\\"')
+
+
+def emit_c_source ():
+
+  # first one wins, same as the old linear scan
+  keys = []
+  seen = set ()
+  for index, charset in enumerate (charsets):
+    for key in [ charset["name"], charset["mime_name"] ] + charset["aliases"]:
+      folded = key.lower ()
+      if key and folded not in seen:
+        seen.add (folded)
+        keys.append ((folded, index))
+
+  displacements, slots = build_perfect_hash (keys)
+
+  print ('/*')
+  print (' * Automatically generated from the IANA charset assignments:')
+  print (' *   http://www.iana.org/assignments/character-sets')
+  print (' *')
+  print (' * by scripts/charset2conf.py --c-source, do not edit.')
+  print (' *')
+  print (' * Statistics:')
+  print (' *   Number of charsets: %d' % name_cnt)
+  print (' *   Number of names and aliases: %d' % len (keys))
+  print (' *   Hash buckets/slots: %d/%d' % (len (displacements), len (slots)))
+  print (' */')
+  print ('')
+  print ('#include <glib.h>')
+  print ('#include "charsets.h"')
+  print ('#include "charsets-table.h"')
+  print ('')
+  print ('')
+
+  for index, charset in enumerate (charsets):
+    if charset["aliases"]:
+      print ('static gchar *charset_aliases_%d[] = { %s, NULL };' %
+             (index, ', '.join (c_string (a) for a in charset["aliases"])))
+
+  print ('')
+  print ('')
+  print ('const SourceFileCharset source_file_charset_table[] =')
+  print ('{')
+  for index, charset in enumerate (charsets):
+    if charset["mime_name"]:
+      mime_name = c_string (charset["mime_name"])
+    else:
+      mime_name = 'NULL'
+    if charset["aliases"]:
+      aliases = 'charset_aliases_%d' % index
+    else:
+      aliases = 'NULL'
+    print ('  { %d, %s, %s, %s, %d },' %
+           (charset["mib_enum"], c_string (charset["name"]), mime_name,
+            aliases, len (charset["aliases"])))
+  print ('};')
+  print ('')
+  print ('const guint source_file_charset_table_length = %d;' % len (charsets))
+  print ('')
+  print ('')
+  print ('#define CHARSET_HASH_N_BUCKETS %d' % len (displacements))
+  print ('#define CHARSET_HASH_N_SLOTS   %d' % len (slots))
+  print ('')
+  print ('')
+  print ('static const guint16 charset_hash_displacements[CHARSET_HASH_N_BUCKETS] =')
+  print ('{')
+  for i in range (0, len (displacements), 12):
+    print ('  %s,' % ', '.join ('%d' % d for d in displacements[i:i + 12]))
+  print ('};')
+  print ('')
+  print ('')
+  print ('static const struct')
+  print ('{')
+  print ('  const gchar *key;')
+  print ('  gint         index;')
+  print ('} charset_hash_slots[CHARSET_HASH_N_SLOTS] =')
+  print ('{')
+  for slot in slots:
+    if slot:
+      print ('  { %s, %d },' % (c_string (slot[0]), slot[1]))
+    else:
+      print ('  { NULL, -1 },')
+  print ('};')
+  print ('')
+  print ('')
+  print ('static inline guint32')
+  print ('charset_hash (const gchar *key, guint32 seed)')
+  print ('{')
+  print ('  guint32 h = 2166136261U ^ seed;')
+  print ('')
+  print ('  for (; *key; key++)')
+  print ('    {')
+  print ('      h ^= (guchar) g_ascii_tolower (*key);')
+  print ('      h *= 16777619U;')
+  print ('    }')
+  print ('')
+  print ('  return h;')
+  print ('}')
+  print ('')
+  print ('')
+  print ('const SourceFileCharset *')
+  print ('source_file_charset_table_lookup (const gchar *charset_name)')
+  print ('{')
+  print ('  guint32 seed;')
+  print ('  guint   slot;')
+  print ('')
+  print ('  seed = charset_hash_displacements[charset_hash (charset_name, 0) % CHARSET_HASH_N_BUCKETS];')
+  print ('  slot = charset_hash (charset_name, seed) % CHARSET_HASH_N_SLOTS;')
+  print ('')
+  print ('  if (charset_hash_slots[slot].key &&')
+  print ('      g_ascii_strcasecmp (charset_hash_slots[slot].key, charset_name) == 0)')
+  print ('    return &source_file_charset_table[charset_hash_slots[slot].index];')
+  print ('')
+  print ('  return NULL;')
+  print ('}')
+
+
+if EMIT_C_SOURCE:
+  emit_c_source ()
+else:
+  emit_conf ()
@@ -0,0 +1,156 @@
+#!/usr/bin/env python
+
+"""
+Generates the transcoding tables of the single-byte charsets the library
+converts itself instead of going through iconv.
+
+Usage:
+  singlebyte2c.py IANA_CHARSETS_FILE
+
+A C source file is written to stdout. For every charset below it has a
+256-entry decode table, holding the UTF-8 bytes of each byte followed by
+their count (0 where the byte is undefined), and for encoding back, a
+two-level table from non-ASCII code points to bytes: which 256 code
+point page, if any, each high byte of a code point selects, and the
+pages themselves, with 0 for code points the charset doesn't have. The mappings come from
+Python's codecs, and the IANA file is only used for the names, so the
+table is keyed by MIBenum like the charset table. Only charsets whose
+lower half is ASCII are allowed.
+"""
+
+from __future__ import print_function
+
+import sys
+
+
+# MIBenum -> Python codec. Left out on purpose: windows-1255 and 1258,
+# which glibc composes combining marks for, and the Mac and Thai code
+# pages, where glibc and Python disagree about a few bytes.
+CHARSETS = [
+  (3,    "ascii"),
+  (4,    "latin_1"),
+  (5,    "iso8859_2"),
+  (6,    "iso8859_3"),
+  (7,    "iso8859_4"),
+  (8,    "iso8859_5"),
+  (9,    "iso8859_6"),
+  (10,   "iso8859_7"),
+  (11,   "iso8859_8"),
+  (12,   "iso8859_9"),
+  (13,   "iso8859_10"),
+  (109,  "iso8859_13"),
+  (110,  "iso8859_14"),
+  (111,  "iso8859_15"),
+  (112,  "iso8859_16"),
+  (2009, "cp850"),
+  (2011, "cp437"),
+  (2084, "koi8_r"),
+  (2086, "cp866"),
+  (2088, "koi8_u"),
+  (2250, "cp1250"),
+  (2251, "cp1251"),
+  (2252, "cp1252"),
+  (2253, "cp1253"),
+  (2254, "cp1254"),
+  (2256, "cp1256"),
+  (2257, "cp1257"),
+]
+
+
+args = sys.argv[1:]
+if not args:
+  sys.stderr.write ("error: no data file specified\n")
+  sys.exit (1)
+
+names = {}
+name = None
+for line in open (args[0], "r"):
+  if line.startswith ("Name:"):
+    name = line.split ()[1]
+  if line.startswith ("MIBenum:"):
+    names[int (line.split (':')[1].strip ())] = name
+
+
+def decode_entry (codec, byte):
+  try:
+    ch = bytes (bytearray ([byte])).decode (codec)
+  except UnicodeDecodeError:
+    return [0, 0, 0, 0]
+  utf8 = list (bytearray (ch.encode ("utf-8")))
+  if len (ch) != 1 or len (utf8) > 3:
+    sys.stderr.write ("error: %s byte 0x%02x doesn't decode to one BMP character\n" % (codec, byte))
+    sys.exit (1)
+  return utf8 + [0] * (3 - len (utf8)) + [len (utf8)]
+
+
+print ('/*')
+print (' * Automatically generated from Python\'s codecs and the IANA charset')
+print (' * assignments by scripts/singlebyte2c.py, do not edit.')
+print (' *')
+print (' * Number of charsets: %d' % len (CHARSETS))
+print (' */')
+print ('')
+print ('#include <glib.h>')
+print ('#include "singlebyte-table.h"')
+
+for mib, codec in CHARSETS:
+  if mib not in names:
+    sys.stderr.write ("error: no charset with MIBenum %d\n" % mib)
+    sys.exit (1)
+
+  entries = [ decode_entry (codec, byte) for byte in range (256) ]
+  for byte in range (128):
+    if entries[byte] != [byte, 0, 0, 1]:
+      sys.stderr.write ("error: %s isn't ASCII in its lower half\n" % codec)
+      sys.exit (1)
+
+  encode = {}
+  for byte in range (128, 256):
+    if entries[byte][3]:
+      ch = ord (bytes (bytearray ([byte])).decode (codec))
+      # the first byte wins if two decode the same, as in iconv
+      encode.setdefault (ch, byte)
+
+  pages = sorted (set (ch >> 8 for ch in encode))
+  index = [0] * 256
+  for i, page in enumerate (pages):
+    index[page] = i + 1
+
+  print ('')
+  print ('')
+  print ('/* %s, from %s */' % (names[mib], codec))
+  print ('static const guint8 decode_%d[256][4] =' % mib)
+  print ('{')
+  for row in range (0, 256, 4):
+    print ('  %s,' % ', '.join ('{ 0x%02x, 0x%02x, 0x%02x, %d }' % tuple (e)
+                               for e in entries[row:row + 4]))
+  print ('};')
+  print ('')
+  print ('static const guint8 encode_index_%d[256] =' % mib)
+  print ('{')
+  for row in range (0, 256, 16):
+    print ('  %s,' % ', '.join ('%d' % i for i in index[row:row + 16]))
+  print ('};')
+  print ('')
+  # page 0 is never looked at, it's only there so there's always a page
+  print ('static const guint8 encode_pages_%d[%d][256] =' % (mib, len (pages) + 1))
+  print ('{')
+  print ('  { 0 },')
+  for page in pages:
+    print ('  /* U+%02x00 */' % page)
+    print ('  {')
+    row = [ encode.get ((page << 8) | low, 0) for low in range (256) ]
+    for i in range (0, 256, 16):
+      print ('    %s,' % ', '.join ('0x%02x' % b for b in row[i:i + 16]))
+    print ('  },')
+  print ('};')
+
+print ('')
+print ('')
+print ('const struct _SourceFileSingleByte source_file_single_byte_tables[] =')
+print ('{')
+for mib, codec in CHARSETS:
+  print ('  { %d, decode_%d, encode_index_%d, encode_pages_%d },' % (mib, mib, mib, mib))
+print ('};')
+print ('')
+print ('const guint source_file_single_byte_tables_length = %d;' % len (CHARSETS))
@@ -0,0 +1,1598 @@
+/*
+ * Automatically generated from the IANA charset assignments:
+ *   http://www.iana.org/assignments/character-sets
+ *
+ * by scripts/charset2conf.py --c-source, do not edit.
+ *
+ * Statistics:
+ *   Number of charsets: 257
+ *   Number of names and aliases: 831
+ *   Hash buckets/slots: 207/1024
+ */
+
+#include <glib.h>
+#include "charsets.h"
+#include "charsets-table.h"
+
+
+static gchar *charset_aliases_0[] = { "iso-ir-6", "ANSI_X3.4-1986", "ISO_646.irv:1991", "ASCII", "ISO646-US", "US-ASCII", "us", "IBM367", "cp367", "csASCII", NULL };
+static gchar *charset_aliases_1[] = { "iso-ir-100", "ISO_8859-1", "ISO-8859-1", "latin1", "l1", "IBM819", "CP819", "csISOLatin1", NULL };
+static gchar *charset_aliases_2[] = { "iso-ir-101", "ISO_8859-2", "ISO-8859-2", "latin2", "l2", "csISOLatin2", NULL };
+static gchar *charset_aliases_3[] = { "iso-ir-109", "ISO_8859-3", "ISO-8859-3", "latin3", "l3", "csISOLatin3", NULL };
+static gchar *charset_aliases_4[] = { "iso-ir-110", "ISO_8859-4", "ISO-8859-4", "latin4", "l4", "csISOLatin4", NULL };
+static gchar *charset_aliases_5[] = { "iso-ir-144", "ISO_8859-5", "ISO-8859-5", "cyrillic", "csISOLatinCyrillic", NULL };
+static gchar *charset_aliases_6[] = { "iso-ir-127", "ISO_8859-6", "ISO-8859-6", "ECMA-114", "ASMO-708", "arabic", "csISOLatinArabic", NULL };
+static gchar *charset_aliases_7[] = { "iso-ir-126", "ISO_8859-7", "ISO-8859-7", "ELOT_928", "ECMA-118", "greek", "greek8", "csISOLatinGreek", NULL };
+static gchar *charset_aliases_8[] = { "iso-ir-138", "ISO_8859-8", "ISO-8859-8", "hebrew", "csISOLatinHebrew", NULL };
+static gchar *charset_aliases_9[] = { "iso-ir-148", "ISO_8859-9", "ISO-8859-9", "latin5", "l5", "csISOLatin5", NULL };
+static gchar *charset_aliases_10[] = { "iso-ir-157", "l6", "ISO_8859-10:1992", "csISOLatin6", "latin6", NULL };
+static gchar *charset_aliases_11[] = { "iso-ir-142", "csISOTextComm", NULL };
+static gchar *charset_aliases_12[] = { "X0201", "csHalfWidthKatakana", NULL };
+static gchar *charset_aliases_13[] = { "csJISEncoding", NULL };
+static gchar *charset_aliases_14[] = { "MS_Kanji", "csShiftJIS", NULL };
+static gchar *charset_aliases_15[] = { "csEUCPkdFmtJapanese", "EUC-JP", NULL };
+static gchar *charset_aliases_16[] = { "csEUCFixWidJapanese", NULL };
+static gchar *charset_aliases_17[] = { "iso-ir-4", "ISO646-GB", "gb", "uk", "csISO4UnitedKingdom", NULL };
+static gchar *charset_aliases_18[] = { "iso-ir-11", "ISO646-SE2", "se2", "csISO11SwedishForNames", NULL };
+static gchar *charset_aliases_19[] = { "iso-ir-15", "ISO646-IT", "csISO15Italian", NULL };
+static gchar *charset_aliases_20[] = { "iso-ir-17", "ISO646-ES", "csISO17Spanish", NULL };
+static gchar *charset_aliases_21[] = { "iso-ir-21", "de", "ISO646-DE", "csISO21German", NULL };
+static gchar *charset_aliases_22[] = { "iso-ir-60", "ISO646-NO", "no", "csISO60DanishNorwegian", "csISO60Norwegian1", NULL };
+static gchar *charset_aliases_23[] = { "iso-ir-69", "ISO646-FR", "fr", "csISO69French", NULL };
+static gchar *charset_aliases_24[] = { "csISO10646UTF1", NULL };
+static gchar *charset_aliases_25[] = { "ref", "csISO646basic1983", NULL };
+static gchar *charset_aliases_26[] = { "csINVARIANT", NULL };
+static gchar *charset_aliases_27[] = { "iso-ir-2", "irv", "csISO2IntlRefVersion", NULL };
+static gchar *charset_aliases_28[] = { "iso-ir-8-1", "csNATSSEFI", NULL };
+static gchar *charset_aliases_29[] = { "iso-ir-8-2", "csNATSSEFIADD", NULL };
+static gchar *charset_aliases_30[] = { "iso-ir-9-1", "csNATSDANO", NULL };
+static gchar *charset_aliases_31[] = { "iso-ir-9-2", "csNATSDANOADD", NULL };
+static gchar *charset_aliases_32[] = { "iso-ir-10", "FI", "ISO646-FI", "ISO646-SE", "se", "csISO10Swedish", NULL };
+static gchar *charset_aliases_33[] = { "iso-ir-149", "KS_C_5601-1989", "KSC_5601", "korean", "csKSC56011987", NULL };
+static gchar *charset_aliases_34[] = { "csISO2022KR", NULL };
+static gchar *charset_aliases_35[] = { "csEUCKR", NULL };
+static gchar *charset_aliases_36[] = { "csISO2022JP", NULL };
+static gchar *charset_aliases_37[] = { "csISO2022JP2", NULL };
+static gchar *charset_aliases_38[] = { "JIS_C6220-1969", "iso-ir-13", "katakana", "x0201-7", "csISO13JISC6220jp", NULL };
+static gchar *charset_aliases_39[] = { "iso-ir-14", "jp", "ISO646-JP", "csISO14JISC6220ro", NULL };
+static gchar *charset_aliases_40[] = { "iso-ir-16", "ISO646-PT", "csISO16Portuguese", NULL };
+static gchar *charset_aliases_41[] = { "iso-ir-18", "csISO18Greek7Old", NULL };
+static gchar *charset_aliases_42[] = { "iso-ir-19", "csISO19LatinGreek", NULL };
+static gchar *charset_aliases_43[] = { "iso-ir-25", "ISO646-FR1", "csISO25French", NULL };
+static gchar *charset_aliases_44[] = { "iso-ir-27", "csISO27LatinGreek1", NULL };
+static gchar *charset_aliases_45[] = { "iso-ir-37", "csISO5427Cyrillic", NULL };
+static gchar *charset_aliases_46[] = { "iso-ir-42", "csISO42JISC62261978", NULL };
+static gchar *charset_aliases_47[] = { "iso-ir-47", "csISO47BSViewdata", NULL };
+static gchar *charset_aliases_48[] = { "iso-ir-49", "csISO49INIS", NULL };
+static gchar *charset_aliases_49[] = { "iso-ir-50", "csISO50INIS8", NULL };
+static gchar *charset_aliases_50[] = { "iso-ir-51", "csISO51INISCyrillic", NULL };
+static gchar *charset_aliases_51[] = { "iso-ir-54", "ISO5427Cyrillic1981", NULL };
+static gchar *charset_aliases_52[] = { "iso-ir-55", "csISO5428Greek", NULL };
+static gchar *charset_aliases_53[] = { "iso-ir-57", "cn", "ISO646-CN", "csISO57GB1988", NULL };
+static gchar *charset_aliases_54[] = { "iso-ir-58", "chinese", "csISO58GB231280", NULL };
+static gchar *charset_aliases_55[] = { "ISO646-NO2", "iso-ir-61", "no2", "csISO61Norwegian2", NULL };
+static gchar *charset_aliases_56[] = { "iso-ir-70", "csISO70VideotexSupp1", NULL };
+static gchar *charset_aliases_57[] = { "iso-ir-84", "ISO646-PT2", "csISO84Portuguese2", NULL };
+static gchar *charset_aliases_58[] = { "iso-ir-85", "ISO646-ES2", "csISO85Spanish2", NULL };
+static gchar *charset_aliases_59[] = { "iso-ir-86", "ISO646-HU", "hu", "csISO86Hungarian", NULL };
+static gchar *charset_aliases_60[] = { "iso-ir-87", "x0208", "JIS_X0208-1983", "csISO87JISX0208", NULL };
+static gchar *charset_aliases_61[] = { "iso-ir-88", "csISO88Greek7", NULL };
+static gchar *charset_aliases_62[] = { "ISO_9036", "arabic7", "iso-ir-89", "csISO89ASMO449", NULL };
+static gchar *charset_aliases_63[] = { "csISO90", NULL };
+static gchar *charset_aliases_64[] = { "iso-ir-91", "jp-ocr-a", "csISO91JISC62291984a", NULL };
+static gchar *charset_aliases_65[] = { "iso-ir-92", "ISO646-JP-OCR-B", "jp-ocr-b", "csISO92JISC62991984b", NULL };
+static gchar *charset_aliases_66[] = { "iso-ir-93", "jp-ocr-b-add", "csISO93JIS62291984badd", NULL };
+static gchar *charset_aliases_67[] = { "iso-ir-94", "jp-ocr-hand", "csISO94JIS62291984hand", NULL };
+static gchar *charset_aliases_68[] = { "iso-ir-95", "jp-ocr-hand-add", "csISO95JIS62291984handadd", NULL };
+static gchar *charset_aliases_69[] = { "iso-ir-96", "csISO96JISC62291984kana", NULL };
+static gchar *charset_aliases_70[] = { "iso-ir-98", "e13b", "csISO2033", NULL };
+static gchar *charset_aliases_71[] = { "iso-ir-99", "CSA_T500-1983", "NAPLPS", "csISO99NAPLPS", NULL };
+static gchar *charset_aliases_72[] = { "iso-ir-102", "csISO102T617bit", NULL };
+static gchar *charset_aliases_73[] = { "T.61", "iso-ir-103", "csISO103T618bit", NULL };
+static gchar *charset_aliases_74[] = { "iso-ir-111", "KOI8-E", "csISO111ECMACyrillic", NULL };
+static gchar *charset_aliases_75[] = { "iso-ir-121", "ISO646-CA", "csa7-1", "ca", "csISO121Canadian1", NULL };
+static gchar *charset_aliases_76[] = { "iso-ir-122", "ISO646-CA2", "csa7-2", "csISO122Canadian2", NULL };
+static gchar *charset_aliases_77[] = { "iso-ir-123", "csISO123CSAZ24341985gr", NULL };
+static gchar *charset_aliases_78[] = { "csISO88596E", "ISO-8859-6-E", NULL };
+static gchar *charset_aliases_79[] = { "csISO88596I", "ISO-8859-6-I", NULL };
+static gchar *charset_aliases_80[] = { "iso-ir-128", "csISO128T101G2", NULL };
+static gchar *charset_aliases_81[] = { "csISO88598E", "ISO-8859-8-E", NULL };
+static gchar *charset_aliases_82[] = { "csISO88598I", "ISO-8859-8-I", NULL };
+static gchar *charset_aliases_83[] = { "iso-ir-139", "csISO139CSN369103", NULL };
+static gchar *charset_aliases_84[] = { "iso-ir-141", "ISO646-YU", "js", "yu", "csISO141JUSIB1002", NULL };
+static gchar *charset_aliases_85[] = { "iso-ir-143", "csISO143IECP271", NULL };
+static gchar *charset_aliases_86[] = { "iso-ir-146", "serbian", "csISO146Serbian", NULL };
+static gchar *charset_aliases_87[] = { "macedonian", "iso-ir-147", "csISO147Macedonian", NULL };
+static gchar *charset_aliases_88[] = { "iso-ir-150", "csISO150", "csISO150GreekCCITT", NULL };
+static gchar *charset_aliases_89[] = { "cuba", "iso-ir-151", "ISO646-CU", "csISO151Cuba", NULL };
+static gchar *charset_aliases_90[] = { "iso-ir-152", "csISO6937Add", NULL };
+static gchar *charset_aliases_91[] = { "ST_SEV_358-88", "iso-ir-153", "csISO153GOST1976874", NULL };
+static gchar *charset_aliases_92[] = { "iso-ir-154", "latin1-2-5", "csISO8859Supp", NULL };
+static gchar *charset_aliases_93[] = { "iso-ir-155", "csISO10367Box", NULL };
+static gchar *charset_aliases_94[] = { "lap", "iso-ir-158", "csISO158Lap", NULL };
+static gchar *charset_aliases_95[] = { "x0212", "iso-ir-159", "csISO159JISX02121990", NULL };
+static gchar *charset_aliases_96[] = { "DS2089", "ISO646-DK", "dk", "csISO646Danish", NULL };
+static gchar *charset_aliases_97[] = { "csUSDK", NULL };
+static gchar *charset_aliases_98[] = { "csDKUS", NULL };
+static gchar *charset_aliases_99[] = { "ISO646-KR", "csKSC5636", NULL };
+static gchar *charset_aliases_100[] = { "csUnicode11UTF7", NULL };
+static gchar *charset_aliases_105[] = { "iso-ir-199", "ISO_8859-14:1998", "ISO_8859-14", "latin8", "iso-celtic", "l8", NULL };
+static gchar *charset_aliases_106[] = { "ISO_8859-15", "Latin-9", NULL };
+static gchar *charset_aliases_107[] = { "iso-ir-226", "ISO_8859-16:2001", "ISO_8859-16", "latin10", "l10", NULL };
+static gchar *charset_aliases_108[] = { "CP936", "MS936", "windows-936", NULL };
+static gchar *charset_aliases_113[] = { "ISO_11548-1", "ISO_TR_11548-1", "csISO115481", NULL };
+static gchar *charset_aliases_114[] = { "STRK1048-2002", "RK1048", "csKZ1048", NULL };
+static gchar *charset_aliases_115[] = { "csUnicode", NULL };
+static gchar *charset_aliases_116[] = { "csUCS4", NULL };
+static gchar *charset_aliases_117[] = { "csUnicodeASCII", NULL };
+static gchar *charset_aliases_118[] = { "csUnicodeLatin1", "ISO-10646", NULL };
+static gchar *charset_aliases_120[] = { "csUnicodeIBM1261", NULL };
+static gchar *charset_aliases_121[] = { "csUnicodeIBM1268", NULL };
+static gchar *charset_aliases_122[] = { "csUnicodeIBM1276", NULL };
+static gchar *charset_aliases_123[] = { "csUnicodeIBM1264", NULL };
+static gchar *charset_aliases_124[] = { "csUnicodeIBM1265", NULL };
+static gchar *charset_aliases_125[] = { "csUnicode11", NULL };
+static gchar *charset_aliases_131[] = { "csCESU-8", NULL };
+static gchar *charset_aliases_135[] = { "csBOCU-1", NULL };
+static gchar *charset_aliases_136[] = { "csWindows30Latin1", NULL };
+static gchar *charset_aliases_137[] = { "csWindows31Latin1", NULL };
+static gchar *charset_aliases_138[] = { "csWindows31Latin2", NULL };
+static gchar *charset_aliases_139[] = { "csWindows31Latin5", NULL };
+static gchar *charset_aliases_140[] = { "roman8", "r8", "csHPRoman8", NULL };
+static gchar *charset_aliases_141[] = { "csAdobeStandardEncoding", NULL };
+static gchar *charset_aliases_142[] = { "csVenturaUS", NULL };
+static gchar *charset_aliases_143[] = { "csVenturaInternational", NULL };
+static gchar *charset_aliases_144[] = { "dec", "csDECMCS", NULL };
+static gchar *charset_aliases_145[] = { "cp850", "850", "csPC850Multilingual", NULL };
+static gchar *charset_aliases_146[] = { "csPC8DanishNorwegian", NULL };
+static gchar *charset_aliases_147[] = { "cp862", "862", "csPC862LatinHebrew", NULL };
+static gchar *charset_aliases_148[] = { "csPC8Turkish", NULL };
+static gchar *charset_aliases_149[] = { "csIBMSymbols", NULL };
+static gchar *charset_aliases_150[] = { "csIBMThai", NULL };
+static gchar *charset_aliases_151[] = { "csHPLegal", NULL };
+static gchar *charset_aliases_152[] = { "csHPPiFont", NULL };
+static gchar *charset_aliases_153[] = { "csHPMath8", NULL };
+static gchar *charset_aliases_154[] = { "csHPPSMath", NULL };
+static gchar *charset_aliases_155[] = { "csHPDesktop", NULL };
+static gchar *charset_aliases_156[] = { "csVenturaMath", NULL };
+static gchar *charset_aliases_157[] = { "csMicrosoftPublishing", NULL };
+static gchar *charset_aliases_158[] = { "csWindows31J", NULL };
+static gchar *charset_aliases_159[] = { "csGB2312", NULL };
+static gchar *charset_aliases_160[] = { "csBig5", NULL };
+static gchar *charset_aliases_161[] = { "mac", "csMacintosh", NULL };
+static gchar *charset_aliases_162[] = { "cp037", "ebcdic-cp-us", "ebcdic-cp-ca", "ebcdic-cp-wt", "ebcdic-cp-nl", "csIBM037", NULL };
+static gchar *charset_aliases_163[] = { "EBCDIC-INT", "cp038", "csIBM038", NULL };
+static gchar *charset_aliases_164[] = { "CP273", "csIBM273", NULL };
+static gchar *charset_aliases_165[] = { "EBCDIC-BE", "CP274", "csIBM274", NULL };
+static gchar *charset_aliases_166[] = { "EBCDIC-BR", "cp275", "csIBM275", NULL };
+static gchar *charset_aliases_167[] = { "EBCDIC-CP-DK", "EBCDIC-CP-NO", "csIBM277", NULL };
+static gchar *charset_aliases_168[] = { "CP278", "ebcdic-cp-fi", "ebcdic-cp-se", "csIBM278", NULL };
+static gchar *charset_aliases_169[] = { "CP280", "ebcdic-cp-it", "csIBM280", NULL };
+static gchar *charset_aliases_170[] = { "EBCDIC-JP-E", "cp281", "csIBM281", NULL };
+static gchar *charset_aliases_171[] = { "CP284", "ebcdic-cp-es", "csIBM284", NULL };
+static gchar *charset_aliases_172[] = { "CP285", "ebcdic-cp-gb", "csIBM285", NULL };
+static gchar *charset_aliases_173[] = { "cp290", "EBCDIC-JP-kana", "csIBM290", NULL };
+static gchar *charset_aliases_174[] = { "cp297", "ebcdic-cp-fr", "csIBM297", NULL };
+static gchar *charset_aliases_175[] = { "cp420", "ebcdic-cp-ar1", "csIBM420", NULL };
+static gchar *charset_aliases_176[] = { "cp423", "ebcdic-cp-gr", "csIBM423", NULL };
+static gchar *charset_aliases_177[] = { "cp424", "ebcdic-cp-he", "csIBM424", NULL };
+static gchar *charset_aliases_178[] = { "cp437", "437", "csPC8CodePage437", NULL };
+static gchar *charset_aliases_179[] = { "CP500", "ebcdic-cp-be", "ebcdic-cp-ch", "csIBM500", NULL };
+static gchar *charset_aliases_180[] = { "cp851", "851", "csIBM851", NULL };
+static gchar *charset_aliases_181[] = { "cp852", "852", "csPCp852", NULL };
+static gchar *charset_aliases_182[] = { "cp855", "855", "csIBM855", NULL };
+static gchar *charset_aliases_183[] = { "cp857", "857", "csIBM857", NULL };
+static gchar *charset_aliases_184[] = { "cp860", "860", "csIBM860", NULL };
+static gchar *charset_aliases_185[] = { "cp861", "861", "cp-is", "csIBM861", NULL };
+static gchar *charset_aliases_186[] = { "cp863", "863", "csIBM863", NULL };
+static gchar *charset_aliases_187[] = { "cp864", "csIBM864", NULL };
+static gchar *charset_aliases_188[] = { "cp865", "865", "csIBM865", NULL };
+static gchar *charset_aliases_189[] = { "CP868", "cp-ar", "csIBM868", NULL };
+static gchar *charset_aliases_190[] = { "cp869", "869", "cp-gr", "csIBM869", NULL };
+static gchar *charset_aliases_191[] = { "CP870", "ebcdic-cp-roece", "ebcdic-cp-yu", "csIBM870", NULL };
+static gchar *charset_aliases_192[] = { "CP871", "ebcdic-cp-is", "csIBM871", NULL };
+static gchar *charset_aliases_193[] = { "cp880", "EBCDIC-Cyrillic", "csIBM880", NULL };
+static gchar *charset_aliases_194[] = { "cp891", "csIBM891", NULL };
+static gchar *charset_aliases_195[] = { "cp903", "csIBM903", NULL };
+static gchar *charset_aliases_196[] = { "cp904", "904", "csIBBM904", NULL };
+static gchar *charset_aliases_197[] = { "CP905", "ebcdic-cp-tr", "csIBM905", NULL };
+static gchar *charset_aliases_198[] = { "CP918", "ebcdic-cp-ar2", "csIBM918", NULL };
+static gchar *charset_aliases_199[] = { "CP1026", "csIBM1026", NULL };
+static gchar *charset_aliases_200[] = { "csIBMEBCDICATDE", NULL };
+static gchar *charset_aliases_201[] = { "csEBCDICATDEA", NULL };
+static gchar *charset_aliases_202[] = { "csEBCDICCAFR", NULL };
+static gchar *charset_aliases_203[] = { "csEBCDICDKNO", NULL };
+static gchar *charset_aliases_204[] = { "csEBCDICDKNOA", NULL };
+static gchar *charset_aliases_205[] = { "csEBCDICFISE", NULL };
+static gchar *charset_aliases_206[] = { "csEBCDICFISEA", NULL };
+static gchar *charset_aliases_207[] = { "csEBCDICFR", NULL };
+static gchar *charset_aliases_208[] = { "csEBCDICIT", NULL };
+static gchar *charset_aliases_209[] = { "csEBCDICPT", NULL };
+static gchar *charset_aliases_210[] = { "csEBCDICES", NULL };
+static gchar *charset_aliases_211[] = { "csEBCDICESA", NULL };
+static gchar *charset_aliases_212[] = { "csEBCDICESS", NULL };
+static gchar *charset_aliases_213[] = { "csEBCDICUK", NULL };
+static gchar *charset_aliases_214[] = { "csEBCDICUS", NULL };
+static gchar *charset_aliases_215[] = { "csUnknown8BiT", NULL };
+static gchar *charset_aliases_216[] = { "csMnemonic", NULL };
+static gchar *charset_aliases_217[] = { "csMnem", NULL };
+static gchar *charset_aliases_218[] = { "csVISCII", NULL };
+static gchar *charset_aliases_219[] = { "csVIQR", NULL };
+static gchar *charset_aliases_220[] = { "csKOI8R", NULL };
+static gchar *charset_aliases_222[] = { "cp866", "866", "csIBM866", NULL };
+static gchar *charset_aliases_223[] = { "cp775", "csPC775Baltic", NULL };
+static gchar *charset_aliases_225[] = { "CCSID00858", "CP00858", "PC-Multilingual-850+euro", NULL };
+static gchar *charset_aliases_226[] = { "CCSID00924", "CP00924", "ebcdic-Latin9--euro", NULL };
+static gchar *charset_aliases_227[] = { "CCSID01140", "CP01140", "ebcdic-us-37+euro", NULL };
+static gchar *charset_aliases_228[] = { "CCSID01141", "CP01141", "ebcdic-de-273+euro", NULL };
+static gchar *charset_aliases_229[] = { "CCSID01142", "CP01142", "ebcdic-dk-277+euro", "ebcdic-no-277+euro", NULL };
+static gchar *charset_aliases_230[] = { "CCSID01143", "CP01143", "ebcdic-fi-278+euro", "ebcdic-se-278+euro", NULL };
+static gchar *charset_aliases_231[] = { "CCSID01144", "CP01144", "ebcdic-it-280+euro", NULL };
+static gchar *charset_aliases_232[] = { "CCSID01145", "CP01145", "ebcdic-es-284+euro", NULL };
+static gchar *charset_aliases_233[] = { "CCSID01146", "CP01146", "ebcdic-gb-285+euro", NULL };
+static gchar *charset_aliases_234[] = { "CCSID01147", "CP01147", "ebcdic-fr-297+euro", NULL };
+static gchar *charset_aliases_235[] = { "CCSID01148", "CP01148", "ebcdic-international-500+euro", NULL };
+static gchar *charset_aliases_236[] = { "CCSID01149", "CP01149", "ebcdic-is-871+euro", NULL };
+static gchar *charset_aliases_238[] = { "IBM-1047", NULL };
+static gchar *charset_aliases_239[] = { "csPTCP154", "PT154", "CP154", "Cyrillic-Asian", NULL };
+static gchar *charset_aliases_240[] = { "Ami1251", "Amiga1251", "Ami-1251", NULL };
+static gchar *charset_aliases_242[] = { "csBRF", NULL };
+static gchar *charset_aliases_243[] = { "csTSCII", NULL };
+static gchar *charset_aliases_244[] = { "csCP51932", NULL };
+static gchar *charset_aliases_256[] = { "csCP50220", NULL };
+
+
+const SourceFileCharset source_file_charset_table[] =
+{
+  { 3, "ANSI_X3.4-1968", "US-ASCII", charset_aliases_0, 10 },
+  { 4, "ISO_8859-1:1987", "ISO-8859-1", charset_aliases_1, 8 },
+  { 5, "ISO_8859-2:1987", "ISO-8859-2", charset_aliases_2, 6 },
+  { 6, "ISO_8859-3:1988", "ISO-8859-3", charset_aliases_3, 6 },
+  { 7, "ISO_8859-4:1988", "ISO-8859-4", charset_aliases_4, 6 },
+  { 8, "ISO_8859-5:1988", "ISO-8859-5", charset_aliases_5, 5 },
+  { 9, "ISO_8859-6:1987", "ISO-8859-6", charset_aliases_6, 7 },
+  { 10, "ISO_8859-7:1987", "ISO-8859-7", charset_aliases_7, 8 },
+  { 11, "ISO_8859-8:1988", "ISO-8859-8", charset_aliases_8, 5 },
+  { 12, "ISO_8859-9:1989", "ISO-8859-9", charset_aliases_9, 6 },
+  { 13, "ISO-8859-10", "ISO-8859-10", charset_aliases_10, 5 },
+  { 14, "ISO_6937-2-add", NULL, charset_aliases_11, 2 },
+  { 15, "JIS_X0201", NULL, charset_aliases_12, 2 },
+  { 16, "JIS_Encoding", NULL, charset_aliases_13, 1 },
+  { 17, "Shift_JIS", "Shift_JIS", charset_aliases_14, 2 },
+  { 18, "Extended_UNIX_Code_Packed_Format_for_Japanese", "EUC-JP", charset_aliases_15, 2 },
+  { 19, "Extended_UNIX_Code_Fixed_Width_for_Japanese", NULL, charset_aliases_16, 1 },
+  { 20, "BS_4730", NULL, charset_aliases_17, 5 },
+  { 21, "SEN_850200_C", NULL, charset_aliases_18, 4 },
+  { 22, "IT", NULL, charset_aliases_19, 3 },
+  { 23, "ES", NULL, charset_aliases_20, 3 },
+  { 24, "DIN_66003", NULL, charset_aliases_21, 4 },
+  { 25, "NS_4551-1", NULL, charset_aliases_22, 5 },
+  { 26, "NF_Z_62-010", NULL, charset_aliases_23, 4 },
+  { 27, "ISO-10646-UTF-1", NULL, charset_aliases_24, 1 },
+  { 28, "ISO_646.basic:1983", NULL, charset_aliases_25, 2 },
+  { 29, "INVARIANT", NULL, charset_aliases_26, 1 },
+  { 30, "ISO_646.irv:1983", NULL, charset_aliases_27, 3 },
+  { 31, "NATS-SEFI", NULL, charset_aliases_28, 2 },
+  { 32, "NATS-SEFI-ADD", NULL, charset_aliases_29, 2 },
+  { 33, "NATS-DANO", NULL, charset_aliases_30, 2 },
+  { 34, "NATS-DANO-ADD", NULL, charset_aliases_31, 2 },
+  { 35, "SEN_850200_B", NULL, charset_aliases_32, 6 },
+  { 36, "KS_C_5601-1987", NULL, charset_aliases_33, 5 },
+  { 37, "ISO-2022-KR", "ISO-2022-KR", charset_aliases_34, 1 },
+  { 38, "EUC-KR", "EUC-KR", charset_aliases_35, 1 },
+  { 39, "ISO-2022-JP", "ISO-2022-JP", charset_aliases_36, 1 },
+  { 40, "ISO-2022-JP-2", "ISO-2022-JP-2", charset_aliases_37, 1 },
+  { 41, "JIS_C6220-1969-jp", NULL, charset_aliases_38, 5 },
+  { 42, "JIS_C6220-1969-ro", NULL, charset_aliases_39, 4 },
+  { 43, "PT", NULL, charset_aliases_40, 3 },
+  { 44, "greek7-old", NULL, charset_aliases_41, 2 },
+  { 45, "latin-greek", NULL, charset_aliases_42, 2 },
+  { 46, "NF_Z_62-010_", NULL, charset_aliases_43, 3 },
+  { 47, "Latin-greek-1", NULL, charset_aliases_44, 2 },
+  { 48, "ISO_5427", NULL, charset_aliases_45, 2 },
+  { 49, "JIS_C6226-1978", NULL, charset_aliases_46, 2 },
+  { 50, "BS_viewdata", NULL, charset_aliases_47, 2 },
+  { 51, "INIS", NULL, charset_aliases_48, 2 },
+  { 52, "INIS-8", NULL, charset_aliases_49, 2 },
+  { 53, "INIS-cyrillic", NULL, charset_aliases_50, 2 },
+  { 54, "ISO_5427:1981", NULL, charset_aliases_51, 2 },
+  { 55, "ISO_5428:1980", NULL, charset_aliases_52, 2 },
+  { 56, "GB_1988-80", NULL, charset_aliases_53, 4 },
+  { 57, "GB_2312-80", NULL, charset_aliases_54, 3 },
+  { 58, "NS_4551-2", NULL, charset_aliases_55, 4 },
+  { 59, "videotex-suppl", NULL, charset_aliases_56, 2 },
+  { 60, "PT2", NULL, charset_aliases_57, 3 },
+  { 61, "ES2", NULL, charset_aliases_58, 3 },
+  { 62, "MSZ_7795.3", NULL, charset_aliases_59, 4 },
+  { 63, "JIS_C6226-1983", NULL, charset_aliases_60, 4 },
+  { 64, "greek7", NULL, charset_aliases_61, 2 },
+  { 65, "ASMO_449", NULL, charset_aliases_62, 4 },
+  { 66, "iso-ir-90", NULL, charset_aliases_63, 1 },
+  { 67, "JIS_C6229-1984-a", NULL, charset_aliases_64, 3 },
+  { 68, "JIS_C6229-1984-b", NULL, charset_aliases_65, 4 },
+  { 69, "JIS_C6229-1984-b-add", NULL, charset_aliases_66, 3 },
+  { 70, "JIS_C6229-1984-hand", NULL, charset_aliases_67, 3 },
+  { 71, "JIS_C6229-1984-hand-add", NULL, charset_aliases_68, 3 },
+  { 72, "JIS_C6229-1984-kana", NULL, charset_aliases_69, 2 },
+  { 73, "ISO_2033-1983", NULL, charset_aliases_70, 3 },
+  { 74, "ANSI_X3.110-1983", NULL, charset_aliases_71, 4 },
+  { 75, "T.61-7bit", NULL, charset_aliases_72, 2 },
+  { 76, "T.61-8bit", NULL, charset_aliases_73, 3 },
+  { 77, "ECMA-cyrillic", NULL, charset_aliases_74, 3 },
+  { 78, "CSA_Z243.4-1985-1", NULL, charset_aliases_75, 5 },
+  { 79, "CSA_Z243.4-1985-2", NULL, charset_aliases_76, 4 },
+  { 80, "CSA_Z243.4-1985-gr", NULL, charset_aliases_77, 2 },
+  { 81, "ISO_8859-6-E", "ISO-8859-6-E", charset_aliases_78, 2 },
+  { 82, "ISO_8859-6-I", "ISO-8859-6-I", charset_aliases_79, 2 },
+  { 83, "T.101-G2", NULL, charset_aliases_80, 2 },
+  { 84, "ISO_8859-8-E", "ISO-8859-8-E", charset_aliases_81, 2 },
+  { 85, "ISO_8859-8-I", "ISO-8859-8-I", charset_aliases_82, 2 },
+  { 86, "CSN_369103", NULL, charset_aliases_83, 2 },
+  { 87, "JUS_I.B1.002", NULL, charset_aliases_84, 5 },
+  { 88, "IEC_P27-1", NULL, charset_aliases_85, 2 },
+  { 89, "JUS_I.B1.003-serb", NULL, charset_aliases_86, 3 },
+  { 90, "JUS_I.B1.003-mac", NULL, charset_aliases_87, 3 },
+  { 91, "greek-ccitt", NULL, charset_aliases_88, 3 },
+  { 92, "NC_NC00-10:81", NULL, charset_aliases_89, 4 },
+  { 93, "ISO_6937-2-25", NULL, charset_aliases_90, 2 },
+  { 94, "GOST_19768-74", NULL, charset_aliases_91, 3 },
+  { 95, "ISO_8859-supp", NULL, charset_aliases_92, 3 },
+  { 96, "ISO_10367-box", NULL, charset_aliases_93, 2 },
+  { 97, "latin-lap", NULL, charset_aliases_94, 3 },
+  { 98, "JIS_X0212-1990", NULL, charset_aliases_95, 3 },
+  { 99, "DS_2089", NULL, charset_aliases_96, 4 },
+  { 100, "us-dk", NULL, charset_aliases_97, 1 },
+  { 101, "dk-us", NULL, charset_aliases_98, 1 },
+  { 102, "KSC5636", NULL, charset_aliases_99, 2 },
+  { 103, "UNICODE-1-1-UTF-7", NULL, charset_aliases_100, 1 },
+  { 104, "ISO-2022-CN", NULL, NULL, 0 },
+  { 105, "ISO-2022-CN-EXT", NULL, NULL, 0 },
+  { 106, "UTF-8", NULL, NULL, 0 },
+  { 109, "ISO-8859-13", NULL, NULL, 0 },
+  { 110, "ISO-8859-14", NULL, charset_aliases_105, 6 },
+  { 111, "ISO-8859-15", NULL, charset_aliases_106, 2 },
+  { 112, "ISO-8859-16", NULL, charset_aliases_107, 5 },
+  { 113, "GBK", NULL, charset_aliases_108, 3 },
+  { 114, "GB18030", NULL, NULL, 0 },
+  { 115, "OSD_EBCDIC_DF04_15", NULL, NULL, 0 },
+  { 116, "OSD_EBCDIC_DF03_IRV", NULL, NULL, 0 },
+  { 117, "OSD_EBCDIC_DF04_1", NULL, NULL, 0 },
+  { 118, "ISO-11548-1", NULL, charset_aliases_113, 3 },
+  { 119, "KZ-1048", NULL, charset_aliases_114, 3 },
+  { 1000, "ISO-10646-UCS-2", NULL, charset_aliases_115, 1 },
+  { 1001, "ISO-10646-UCS-4", NULL, charset_aliases_116, 1 },
+  { 1002, "ISO-10646-UCS-Basic", NULL, charset_aliases_117, 1 },
+  { 1003, "ISO-10646-Unicode-Latin1", NULL, charset_aliases_118, 2 },
+  { -1, "ISO-10646-J-1", NULL, NULL, 0 },
+  { 1005, "ISO-Unicode-IBM-1261", NULL, charset_aliases_120, 1 },
+  { 1006, "ISO-Unicode-IBM-1268", NULL, charset_aliases_121, 1 },
+  { 1007, "ISO-Unicode-IBM-1276", NULL, charset_aliases_122, 1 },
+  { 1008, "ISO-Unicode-IBM-1264", NULL, charset_aliases_123, 1 },
+  { 1009, "ISO-Unicode-IBM-1265", NULL, charset_aliases_124, 1 },
+  { 1010, "UNICODE-1-1", NULL, charset_aliases_125, 1 },
+  { 1011, "SCSU", NULL, NULL, 0 },
+  { 1012, "UTF-7", NULL, NULL, 0 },
+  { 1013, "UTF-16BE", NULL, NULL, 0 },
+  { 1014, "UTF-16LE", NULL, NULL, 0 },
+  { 1015, "UTF-16", NULL, NULL, 0 },
+  { 1016, "CESU-8", NULL, charset_aliases_131, 1 },
+  { 1017, "UTF-32", NULL, NULL, 0 },
+  { 1018, "UTF-32BE", NULL, NULL, 0 },
+  { 1019, "UTF-32LE", NULL, NULL, 0 },
+  { 1020, "BOCU-1", NULL, charset_aliases_135, 1 },
+  { 2000, "ISO-8859-1-Windows-3.0-Latin-1", NULL, charset_aliases_136, 1 },
+  { 2001, "ISO-8859-1-Windows-3.1-Latin-1", NULL, charset_aliases_137, 1 },
+  { 2002, "ISO-8859-2-Windows-Latin-2", NULL, charset_aliases_138, 1 },
+  { 2003, "ISO-8859-9-Windows-Latin-5", NULL, charset_aliases_139, 1 },
+  { 2004, "hp-roman8", NULL, charset_aliases_140, 3 },
+  { 2005, "Adobe-Standard-Encoding", NULL, charset_aliases_141, 1 },
+  { 2006, "Ventura-US", NULL, charset_aliases_142, 1 },
+  { 2007, "Ventura-International", NULL, charset_aliases_143, 1 },
+  { 2008, "DEC-MCS", NULL, charset_aliases_144, 2 },
+  { 2009, "IBM850", NULL, charset_aliases_145, 3 },
+  { 2012, "PC8-Danish-Norwegian", NULL, charset_aliases_146, 1 },
+  { 2013, "IBM862", NULL, charset_aliases_147, 3 },
+  { 2014, "PC8-Turkish", NULL, charset_aliases_148, 1 },
+  { 2015, "IBM-Symbols", NULL, charset_aliases_149, 1 },
+  { 2016, "IBM-Thai", NULL, charset_aliases_150, 1 },
+  { 2017, "HP-Legal", NULL, charset_aliases_151, 1 },
+  { 2018, "HP-Pi-font", NULL, charset_aliases_152, 1 },
+  { 2019, "HP-Math8", NULL, charset_aliases_153, 1 },
+  { 2020, "Adobe-Symbol-Encoding", NULL, charset_aliases_154, 1 },
+  { 2021, "HP-DeskTop", NULL, charset_aliases_155, 1 },
+  { 2022, "Ventura-Math", NULL, charset_aliases_156, 1 },
+  { 2023, "Microsoft-Publishing", NULL, charset_aliases_157, 1 },
+  { 2024, "Windows-31J", NULL, charset_aliases_158, 1 },
+  { 2025, "GB2312", "GB2312", charset_aliases_159, 1 },
+  { 2026, "Big5", "Big5", charset_aliases_160, 1 },
+  { 2027, "macintosh", NULL, charset_aliases_161, 2 },
+  { 2028, "IBM037", NULL, charset_aliases_162, 6 },
+  { 2029, "IBM038", NULL, charset_aliases_163, 3 },
+  { 2030, "IBM273", NULL, charset_aliases_164, 2 },
+  { 2031, "IBM274", NULL, charset_aliases_165, 3 },
+  { 2032, "IBM275", NULL, charset_aliases_166, 3 },
+  { 2033, "IBM277", NULL, charset_aliases_167, 3 },
+  { 2034, "IBM278", NULL, charset_aliases_168, 4 },
+  { 2035, "IBM280", NULL, charset_aliases_169, 3 },
+  { 2036, "IBM281", NULL, charset_aliases_170, 3 },
+  { 2037, "IBM284", NULL, charset_aliases_171, 3 },
+  { 2038, "IBM285", NULL, charset_aliases_172, 3 },
+  { 2039, "IBM290", NULL, charset_aliases_173, 3 },
+  { 2040, "IBM297", NULL, charset_aliases_174, 3 },
+  { 2041, "IBM420", NULL, charset_aliases_175, 3 },
+  { 2042, "IBM423", NULL, charset_aliases_176, 3 },
+  { 2043, "IBM424", NULL, charset_aliases_177, 3 },
+  { 2011, "IBM437", NULL, charset_aliases_178, 3 },
+  { 2044, "IBM500", NULL, charset_aliases_179, 4 },
+  { 2045, "IBM851", NULL, charset_aliases_180, 3 },
+  { 2010, "IBM852", NULL, charset_aliases_181, 3 },
+  { 2046, "IBM855", NULL, charset_aliases_182, 3 },
+  { 2047, "IBM857", NULL, charset_aliases_183, 3 },
+  { 2048, "IBM860", NULL, charset_aliases_184, 3 },
+  { 2049, "IBM861", NULL, charset_aliases_185, 4 },
+  { 2050, "IBM863", NULL, charset_aliases_186, 3 },
+  { 2051, "IBM864", NULL, charset_aliases_187, 2 },
+  { 2052, "IBM865", NULL, charset_aliases_188, 3 },
+  { 2053, "IBM868", NULL, charset_aliases_189, 3 },
+  { 2054, "IBM869", NULL, charset_aliases_190, 4 },
+  { 2055, "IBM870", NULL, charset_aliases_191, 4 },
+  { 2056, "IBM871", NULL, charset_aliases_192, 3 },
+  { 2057, "IBM880", NULL, charset_aliases_193, 3 },
+  { 2058, "IBM891", NULL, charset_aliases_194, 2 },
+  { 2059, "IBM903", NULL, charset_aliases_195, 2 },
+  { 2060, "IBM904", NULL, charset_aliases_196, 3 },
+  { 2061, "IBM905", NULL, charset_aliases_197, 3 },
+  { 2062, "IBM918", NULL, charset_aliases_198, 3 },
+  { 2063, "IBM1026", NULL, charset_aliases_199, 2 },
+  { 2064, "EBCDIC-AT-DE", NULL, charset_aliases_200, 1 },
+  { 2065, "EBCDIC-AT-DE-A", NULL, charset_aliases_201, 1 },
+  { 2066, "EBCDIC-CA-FR", NULL, charset_aliases_202, 1 },
+  { 2067, "EBCDIC-DK-NO", NULL, charset_aliases_203, 1 },
+  { 2068, "EBCDIC-DK-NO-A", NULL, charset_aliases_204, 1 },
+  { 2069, "EBCDIC-FI-SE", NULL, charset_aliases_205, 1 },
+  { 2070, "EBCDIC-FI-SE-A", NULL, charset_aliases_206, 1 },
+  { 2071, "EBCDIC-FR", NULL, charset_aliases_207, 1 },
+  { 2072, "EBCDIC-IT", NULL, charset_aliases_208, 1 },
+  { 2073, "EBCDIC-PT", NULL, charset_aliases_209, 1 },
+  { 2074, "EBCDIC-ES", NULL, charset_aliases_210, 1 },
+  { 2075, "EBCDIC-ES-A", NULL, charset_aliases_211, 1 },
+  { 2076, "EBCDIC-ES-S", NULL, charset_aliases_212, 1 },
+  { 2077, "EBCDIC-UK", NULL, charset_aliases_213, 1 },
+  { 2078, "EBCDIC-US", NULL, charset_aliases_214, 1 },
+  { 2079, "UNKNOWN-8BIT", NULL, charset_aliases_215, 1 },
+  { 2080, "MNEMONIC", NULL, charset_aliases_216, 1 },
+  { 2081, "MNEM", NULL, charset_aliases_217, 1 },
+  { 2082, "VISCII", NULL, charset_aliases_218, 1 },
+  { 2083, "VIQR", NULL, charset_aliases_219, 1 },
+  { 2084, "KOI8-R", "KOI8-R", charset_aliases_220, 1 },
+  { 2085, "HZ-GB-2312", NULL, NULL, 0 },
+  { 2086, "IBM866", NULL, charset_aliases_222, 3 },
+  { 2087, "IBM775", NULL, charset_aliases_223, 2 },
+  { 2088, "KOI8-U", NULL, NULL, 0 },
+  { 2089, "IBM00858", NULL, charset_aliases_225, 3 },
+  { 2090, "IBM00924", NULL, charset_aliases_226, 3 },
+  { 2091, "IBM01140", NULL, charset_aliases_227, 3 },
+  { 2092, "IBM01141", NULL, charset_aliases_228, 3 },
+  { 2093, "IBM01142", NULL, charset_aliases_229, 4 },
+  { 2094, "IBM01143", NULL, charset_aliases_230, 4 },
+  { 2095, "IBM01144", NULL, charset_aliases_231, 3 },
+  { 2096, "IBM01145", NULL, charset_aliases_232, 3 },
+  { 2097, "IBM01146", NULL, charset_aliases_233, 3 },
+  { 2098, "IBM01147", NULL, charset_aliases_234, 3 },
+  { 2099, "IBM01148", NULL, charset_aliases_235, 3 },
+  { 2100, "IBM01149", NULL, charset_aliases_236, 3 },
+  { 2101, "Big5-HKSCS", NULL, NULL, 0 },
+  { 2102, "IBM1047", NULL, charset_aliases_238, 1 },
+  { 2103, "PTCP154", NULL, charset_aliases_239, 4 },
+  { 2104, "Amiga-1251", NULL, charset_aliases_240, 3 },
+  { 2105, "KOI7-switched", NULL, NULL, 0 },
+  { 2106, "BRF", NULL, charset_aliases_242, 1 },
+  { 2107, "TSCII", NULL, charset_aliases_243, 1 },
+  { 2108, "CP51932", NULL, charset_aliases_244, 1 },
+  { 2109, "windows-874", NULL, NULL, 0 },
+  { 2250, "windows-1250", NULL, NULL, 0 },
+  { 2251, "windows-1251", NULL, NULL, 0 },
+  { 2252, "windows-1252", NULL, NULL, 0 },
+  { 2253, "windows-1253", NULL, NULL, 0 },
+  { 2254, "windows-1254", NULL, NULL, 0 },
+  { 2255, "windows-1255", NULL, NULL, 0 },
+  { 2256, "windows-1256", NULL, NULL, 0 },
+  { 2257, "windows-1257", NULL, NULL, 0 },
+  { 2258, "windows-1258", NULL, NULL, 0 },
+  { 2259, "TIS-620", NULL, NULL, 0 },
+  { 2260, "CP50220", NULL, charset_aliases_256, 1 },
+};
+
+const guint source_file_charset_table_length = 257;
+
+
+#define CHARSET_HASH_N_BUCKETS 207
+#define CHARSET_HASH_N_SLOTS   1024
+
+
+static const guint16 charset_hash_displacements[CHARSET_HASH_N_BUCKETS] =
+{
+  17, 3, 7, 9, 26, 1, 2, 19, 11, 7, 2, 2,
+  19, 5, 17, 11, 8, 12, 1, 19, 23, 1, 2, 3,
+  5, 1, 2, 1, 44, 8, 10, 35, 3, 3, 3, 2,
+  10, 30, 11, 43, 6, 23, 23, 29, 89, 30, 27, 16,
+  1, 3, 2, 0, 2, 50, 6, 22, 6, 4, 7, 1,
+  2, 23, 8, 10, 17, 17, 6, 6, 9, 1, 3, 3,
+  26, 9, 20, 27, 1, 13, 2, 9, 2, 4, 44, 42,
+  2, 9, 28, 2, 7, 2, 3, 1, 38, 5, 16, 2,
+  4, 29, 5, 4, 15, 2, 0, 10, 12, 10, 16, 2,
+  12, 19, 10, 3, 24, 4, 7, 2, 6, 3, 2, 3,
+  24, 49, 21, 29, 8, 8, 2, 2, 28, 9, 10, 17,
+  14, 16, 26, 4, 8, 77, 2, 4, 21, 14, 8, 9,
+  15, 28, 6, 3, 1, 58, 55, 1, 13, 3, 5, 50,
+  6, 1, 3, 65, 20, 2, 2, 21, 6, 44, 20, 17,
+  4, 2, 61, 2, 20, 4, 13, 4, 2, 11, 1, 19,
+  5, 17, 13, 3, 5, 0, 7, 11, 43, 5, 1, 3,
+  12, 5, 43, 5, 2, 3, 0, 22, 31, 135, 18, 59,
+  1, 38, 5,
+};
+
+
+static const struct
+{
+  const gchar *key;
+  gint         index;
+} charset_hash_slots[CHARSET_HASH_N_SLOTS] =
+{
+  { NULL, -1 },
+  { "csibm860", 184 },
+  { NULL, -1 },
+  { NULL, -1 },
+  { "csiso8859supp", 92 },
+  { "cp868", 189 },
+  { "t.101-g2", 80 },
+  { NULL, -1 },
+  { NULL, -1 },
+  { "jis_encoding", 13 },
+  { "jp-ocr-hand-add", 68 },
+  { "csiso18greek7old", 41 },
+  { "hebrew", 8 },
+  { NULL, -1 },
+  { "utf-32", 132 },
+  { "windows-1257", 253 },
+  { "csiso128t101g2", 80 },
+  { NULL, -1 },
+  { "iso-ir-84", 57 },
+  { "iso-ir-100", 1 },
+  { NULL, -1 },
+  { "iso_8859-6:1987", 6 },
+  { "csibm284", 171 },
+  { "csventurainternational", 143 },
+  { "iso_8859-16:2001", 107 },
+  { "iso_646.irv:1983", 27 },
+  { "iso-ir-149", 33 },
+  { "csibmthai", 150 },
+  { "windows-1252", 248 },
+  { "iso-ir-55", 52 },
+  { "csa_z243.4-1985-2", 76 },
+  { "iso-ir-147", 87 },
+  { NULL, -1 },
+  { "ebcdic-ca-fr", 202 },
+  { NULL, -1 },
+  { "ibm903", 195 },
+  { "ebcdic-cp-it", 169 },
+  { "iso_6937-2-25", 90 },
+  { "cp01142", 229 },
+  { "csiso90", 63 },
+  { "jus_i.b1.003-mac", 87 },
+  { "ibm863", 186 },
+  { "ibm281", 170 },
+  { "csunicodeascii", 117 },
+  { "csibm870", 191 },
+  { "jus_i.b1.003-serb", 86 },
+  { "iso646-fr", 23 },
+  { "csibm037", 162 },
+  { "scsu", 126 },
+  { "iso_8859-3", 3 },
+  { "ca", 75 },
+  { "iso-ir-96", 69 },
+  { NULL, -1 },
+  { "cp280", 169 },
+  { NULL, -1 },
+  { "dec", 144 },
+  { "cp01149", 236 },
+  { NULL, -1 },
+  { "greek7-old", 41 },
+  { NULL, -1 },
+  { "iso-ir-91", 64 },
+  { NULL, -1 },
+  { "csunicode11", 125 },
+  { "ebcdic-cp-ca", 162 },
+  { "iso-unicode-ibm-1268", 121 },
+  { "csiso50inis8", 49 },
+  { "iso_11548-1", 113 },
+  { NULL, -1 },
+  { "iso-ir-42", 46 },
+  { NULL, -1 },
+  { NULL, -1 },
+  { "csebcdicfr", 207 },
+  { NULL, -1 },
+  { "csiso21german", 21 },
+  { "ibm01143", 230 },
+  { NULL, -1 },
+  { "csiso13jisc6220jp", 38 },
+  { "ebcdic-international-500+euro", 235 },
+  { "ebcdic-dk-no-a", 204 },
+  { NULL, -1 },
+  { "iso-ir-151", 89 },
+  { "cshalfwidthkatakana", 12 },
+  { NULL, -1 },
+  { "tis-620", 255 },
+  { "iso-8859-8", 8 },
+  { "csiso27latingreek1", 44 },
+  { "iso646-es", 20 },
+  { NULL, -1 },
+  { "csisolatin5", 9 },
+  { NULL, -1 },
+  { "ptcp154", 239 },
+  { "csibm905", 197 },
+  { "cp-gr", 190 },
+  { "iso_8859-8", 8 },
+  { "iso_8859-supp", 92 },
+  { NULL, -1 },
+  { NULL, -1 },
+  { "cp423", 176 },
+  { "cp903", 195 },
+  { "it", 19 },
+  { "csviscii", 218 },
+  { "cp038", 163 },
+  { "csibmsymbols", 149 },
+  { "iso_8859-3:1988", 3 },
+  { NULL, -1 },
+  { NULL, -1 },
+  { "ebcdic-cp-ch", 179 },
+  { "csibm424", 177 },
+  { "cswindows30latin1", 136 },
+  { "csibm423", 176 },
+  { "jis_c6226-1983", 60 },
+  { "gost_19768-74", 91 },
+  { "ebcdic-cp-ar2", 198 },
+  { "iso_2033-1983", 70 },
+  { "ventura-international", 143 },
+  { "ecma-cyrillic", 74 },
+  { "csnatssefiadd", 29 },
+  { "macedonian", 87 },
+  { "cscp51932", 244 },
+  { "extended_unix_code_packed_format_for_japanese", 15 },
+  { "latin-lap", 94 },
+  { "ebcdic-no-277+euro", 229 },
+  { NULL, -1 },
+  { "iso-unicode-ibm-1265", 124 },
+  { NULL, -1 },
+  { "ibm852", 181 },
+  { "ebcdic-cp-gb", 172 },
+  { "csiso91jisc62291984a", 64 },
+  { "lap", 94 },
+  { NULL, -1 },
+  { "adobe-symbol-encoding", 154 },
+  { "cp904", 196 },
+  { "csdecmcs", 144 },
+  { "cseuckr", 35 },
+  { "nf_z_62-010", 23 },
+  { "hp-pi-font", 152 },
+  { "ibm775", 223 },
+  { "csiso159jisx02121990", 95 },
+  { "iso646-de", 21 },
+  { "asmo-708", 6 },
+  { "ebcdic-cp-fi", 168 },
+  { "greek8", 7 },
+  { "csiso88598e", 81 },
+  { "iso-8859-9", 9 },
+  { "cp869", 190 },
+  { "bs_viewdata", 47 },
+  { "ebcdic-jp-e", 170 },
+  { "iso_tr_11548-1", 113 },
+  { "cp861", 185 },
+  { "cspc8danishnorwegian", 146 },
+  { "iso-ir-121", 75 },
+  { "ms_kanji", 14 },
+  { "ebcdic-at-de-a", 201 },
+  { "csiso85spanish2", 58 },
+  { "us-dk", 97 },
+  { "gb18030", 109 },
+  { "csiso646danish", 96 },
+  { NULL, -1 },
+  { "ibm857", 183 },
+  { NULL, -1 },
+  { "csiso2022kr", 34 },
+  { "ibm280", 169 },
+  { "yu", 84 },
+  { "iso-ir-25", 43 },
+  { "utf-16le", 129 },
+  { "ebcdic-es-284+euro", 232 },
+  { "iso-ir-16", 40 },
+  { "ccsid01141", 228 },
+  { "csebcdicess", 212 },
+  { NULL, -1 },
+  { "iso-ir-98", 70 },
+  { "se2", 18 },
+  { "cp864", 187 },
+  { "csebcdicpt", 209 },
+  { "jis_c6229-1984-kana", 69 },
+  { "t.61", 73 },
+  { "ebcdic-cp-es", 171 },
+  { NULL, -1 },
+  { NULL, -1 },
+  { "naplps", 71 },
+  { "iso-ir-2", 27 },
+  { "iso_8859-9", 9 },
+  { NULL, -1 },
+  { "csibm285", 172 },
+  { "csadobestandardencoding", 141 },
+  { "iso_8859-8-i", 82 },
+  { "iso-ir-11", 18 },
+  { "csebcdicfisea", 206 },
+  { NULL, -1 },
+  { "fi", 32 },
+  { "ebcdic-cp-tr", 197 },
+  { "dk", 96 },
+  { "ebcdic-cyrillic", 193 },
+  { "csnatsdanoadd", 31 },
+  { NULL, -1 },
+  { "csiso61norwegian2", 55 },
+  { "jp-ocr-hand", 67 },
+  { "utf-32le", 134 },
+  { "ventura-math", 156 },
+  { "csiso646basic1983", 25 },
+  { "csibm869", 190 },
+  { "iso-ir-143", 85 },
+  { "csiso93jis62291984badd", 66 },
+  { "rk1048", 114 },
+  { "ibm274", 165 },
+  { "windows-1254", 250 },
+  { NULL, -1 },
+  { "cp274", 165 },
+  { "koi8-e", 74 },
+  { "cp275", 166 },
+  { "437", 178 },
+  { "jis_x0212-1990", 95 },
+  { NULL, -1 },
+  { "iso-8859-6-e", 78 },
+  { "iso_8859-4", 4 },
+  { "utf-32be", 133 },
+  { "ebcdic-cp-gr", 176 },
+  { NULL, -1 },
+  { NULL, -1 },
+  { "cp284", 171 },
+  { "csiso158lap", 94 },
+  { "iso_8859-5", 5 },
+  { "jp", 39 },
+  { "csiso4unitedkingdom", 17 },
+  { "iso-8859-6", 6 },
+  { "iso_8859-6", 6 },
+  { "cp819", 1 },
+  { "csebcdicdkno", 203 },
+  { "csisolatingreek", 7 },
+  { "csnatssefi", 28 },
+  { "iso646-us", 0 },
+  { "csebcdicfise", 205 },
+  { "csiso10646utf1", 24 },
+  { "iso-ir-9-2", 31 },
+  { "ebcdic-cp-se", 168 },
+  { "ebcdic-es", 210 },
+  { NULL, -1 },
+  { "viscii", 218 },
+  { "windows-1251", 247 },
+  { NULL, -1 },
+  { "csptcp154", 239 },
+  { NULL, -1 },
+  { NULL, -1 },
+  { "csibbm904", 196 },
+  { "csunicodeibm1268", 121 },
+  { "iso-ir-92", 65 },
+  { "cyrillic", 5 },
+  { "iso-ir-57", 53 },
+  { "csiso99naplps", 71 },
+  { "iso646-it", 19 },
+  { "iso-ir-10", 32 },
+  { "csibmebcdicatde", 200 },
+  { "jis_c6229-1984-hand-add", 68 },
+  { "hz-gb-2312", 221 },
+  { "csiso84portuguese2", 57 },
+  { "iso-ir-110", 4 },
+  { NULL, -1 },
+  { NULL, -1 },
+  { "ebcdic-is-871+euro", 236 },
+  { "csiso153gost1976874", 91 },
+  { NULL, -1 },
+  { "cp863", 186 },
+  { "iso646-fi", 32 },
+  { "iso-ir-8-1", 28 },
+  { "jis_c6229-1984-a", 64 },
+  { "iso-ir-27", 44 },
+  { "csiso141jusib1002", 84 },
+  { "cspc8turkish", 148 },
+  { NULL, -1 },
+  { "csbocu-1", 135 },
+  { "iso-8859-8-e", 81 },
+  { NULL, -1 },
+  { NULL, -1 },
+  { "csiso96jisc62291984kana", 69 },
+  { "iso-ir-122", 76 },
+  { NULL, -1 },
+  { "greek", 7 },
+  { NULL, -1 },
+  { "iso-11548-1", 113 },
+  { "us-ascii", 0 },
+  { NULL, -1 },
+  { "iso_8859-2", 2 },
+  { "iso-10646", 118 },
+  { "latin1-2-5", 92 },
+  { "ks_c_5601-1987", 33 },
+  { "cp285", 172 },
+  { "csiso88greek7", 61 },
+  { "csksc5636", 99 },
+  { NULL, -1 },
+  { "iso646-se2", 18 },
+  { "pc8-turkish", 148 },
+  { "latin2", 2 },
+  { "ibm01146", 233 },
+  { "ebcdic-es-a", 211 },
+  { "csisolatin4", 4 },
+  { "jis_c6229-1984-hand", 67 },
+  { NULL, -1 },
+  { "iso-unicode-ibm-1264", 123 },
+  { "iso-unicode-ibm-1276", 122 },
+  { "windows-874", 245 },
+  { "iso-8859-1-windows-3.0-latin-1", 136 },
+  { NULL, -1 },
+  { "csiso122canadian2", 76 },
+  { "csiso2033", 70 },
+  { NULL, -1 },
+  { "x0201", 12 },
+  { "iso-10646-j-1", 119 },
+  { "csbig5", 160 },
+  { NULL, -1 },
+  { "ibm-symbols", 149 },
+  { NULL, -1 },
+  { "ibm424", 177 },
+  { "863", 186 },
+  { "microsoft-publishing", 157 },
+  { NULL, -1 },
+  { NULL, -1 },
+  { "csshiftjis", 14 },
+  { "iso-ir-94", 67 },
+  { "nats-sefi", 28 },
+  { NULL, -1 },
+  { "ebcdic-it", 208 },
+  { "l2", 2 },
+  { "amiga-1251", 240 },
+  { NULL, -1 },
+  { "cp865", 188 },
+  { "ebcdic-jp-kana", 173 },
+  { "iso-ir-88", 61 },
+  { "unicode-1-1-utf-7", 100 },
+  { "iso-8859-4", 4 },
+  { NULL, -1 },
+  { "latin4", 4 },
+  { "gb_1988-80", 53 },
+  { NULL, -1 },
+  { "ibm038", 163 },
+  { NULL, -1 },
+  { "windows-1250", 246 },
+  { "iso-ir-13", 38 },
+  { "osd_ebcdic_df04_1", 112 },
+  { "csiso25french", 43 },
+  { "iso_8859-6-e", 78 },
+  { "ebcdic-dk-no", 203 },
+  { "mac", 161 },
+  { "ebcdic-cp-ar1", 175 },
+  { "ibm850", 145 },
+  { "857", 183 },
+  { NULL, -1 },
+  { "cp420", 175 },
+  { "iso-8859-14", 105 },
+  { "iso-ir-141", 84 },
+  { "iso-ir-103", 73 },
+  { "csiso60danishnorwegian", 22 },
+  { "csmicrosoftpublishing", 157 },
+  { "iso646-hu", 59 },
+  { "iso-ir-153", 91 },
+  { "ebcdic-fi-se", 205 },
+  { "csibm500", 179 },
+  { "ibm367", 0 },
+  { "korean", 33 },
+  { "iso-8859-10", 10 },
+  { "chinese", 54 },
+  { "ds2089", 96 },
+  { "cp850", 145 },
+  { "brf", 242 },
+  { NULL, -1 },
+  { NULL, -1 },
+  { "jus_i.b1.002", 84 },
+  { "csiso94jis62291984hand", 67 },
+  { "csisolatin3", 3 },
+  { NULL, -1 },
+  { "ibm423", 176 },
+  { "cp860", 184 },
+  { "iso-ir-109", 3 },
+  { "csunicodeibm1265", 124 },
+  { "ibm290", 173 },
+  { NULL, -1 },
+  { "csiso5428greek", 52 },
+  { "csmnemonic", 216 },
+  { "csiso87jisx0208", 60 },
+  { "hp-math8", 153 },
+  { NULL, -1 },
+  { "csibm274", 165 },
+  { NULL, -1 },
+  { "cp154", 239 },
+  { "macintosh", 161 },
+  { "iso_8859-15", 106 },
+  { "ccsid01147", 234 },
+  { "cp891", 194 },
+  { "ebcdic-at-de", 200 },
+  { "iso-10646-ucs-basic", 117 },
+  { "ebcdic-cp-he", 177 },
+  { "csisolatinhebrew", 8 },
+  { "jis_c6229-1984-b", 65 },
+  { "iso_5427:1981", 51 },
+  { "koi8-u", 224 },
+  { "ibm866", 222 },
+  { "ebcdic-be", 165 },
+  { "e13b", 70 },
+  { "iso-ir-144", 5 },
+  { "iso-ir-37", 45 },
+  { "cp936", 108 },
+  { "ibm01148", 235 },
+  { NULL, -1 },
+  { "cswindows31latin5", 139 },
+  { NULL, -1 },
+  { NULL, -1 },
+  { "csiso57gb1988", 53 },
+  { "csdkus", 98 },
+  { "ebcdic-cp-no", 167 },
+  { "cp01148", 235 },
+  { "iso-ir-51", 50 },
+  { "gbk", 108 },
+  { NULL, -1 },
+  { "csiso6937add", 90 },
+  { NULL, -1 },
+  { "iso-8859-1", 1 },
+  { "us", 0 },
+  { "pt2", 57 },
+  { "ibm870", 191 },
+  { "nats-sefi-add", 29 },
+  { "utf-16", 130 },
+  { "latin5", 9 },
+  { "iso-ir-85", 58 },
+  { "csiso115481", 113 },
+  { "csibm297", 174 },
+  { "csibm855", 182 },
+  { "iso_10367-box", 93 },
+  { "ansi_x3.4-1986", 0 },
+  { "windows-31j", 158 },
+  { "js", 84 },
+  { "csiso147macedonian", 87 },
+  { "latin-greek", 42 },
+  { "windows-1253", 249 },
+  { "ibm01149", 236 },
+  { "csiso2022jp2", 37 },
+  { NULL, -1 },
+  { "cswindows31latin2", 138 },
+  { "csiso92jisc62991984b", 65 },
+  { "iec_p27-1", 85 },
+  { "iso-ir-19", 42 },
+  { "ccsid00858", 225 },
+  { "iso5427cyrillic1981", 51 },
+  { NULL, -1 },
+  { "iso646-ca2", 76 },
+  { "iso-ir-50", 49 },
+  { "cp01146", 233 },
+  { "viqr", 219 },
+  { "bocu-1", 135 },
+  { "iso_5427", 45 },
+  { "csibm891", 194 },
+  { "l10", 107 },
+  { "iso646-cu", 89 },
+  { "csiso88596e", 78 },
+  { "iso-ir-154", 92 },
+  { "cp866", 222 },
+  { "iso_8859-1:1987", 1 },
+  { "nc_nc00-10:81", 89 },
+  { NULL, -1 },
+  { "ecma-118", 7 },
+  { "csibm918", 198 },
+  { "cp01144", 231 },
+  { "iso-8859-3", 3 },
+  { "iso646-pt", 40 },
+  { "csunicodeibm1261", 120 },
+  { NULL, -1 },
+  { "windows-1256", 252 },
+  { "cp297", 174 },
+  { "ibm277", 167 },
+  { "tscii", 243 },
+  { "ebcdic-fi-278+euro", 230 },
+  { "cp01141", 228 },
+  { "cspc8codepage437", 178 },
+  { "ebcdic-cp-fr", 174 },
+  { "iso-ir-60", 22 },
+  { "de", 21 },
+  { "csa7-1", 75 },
+  { NULL, -1 },
+  { "csebcdiccafr", 202 },
+  { "ibm037", 162 },
+  { NULL, -1 },
+  { NULL, -1 },
+  { "katakana", 38 },
+  { NULL, -1 },
+  { "ebcdic-pt", 209 },
+  { NULL, -1 },
+  { "cp775", 223 },
+  { NULL, -1 },
+  { "iso_8859-6-i", 79 },
+  { "videotex-suppl", 56 },
+  { NULL, -1 },
+  { "windows-1258", 254 },
+  { NULL, -1 },
+  { "iso_6937-2-add", 11 },
+  { "cp01145", 232 },
+  { "855", 182 },
+  { "cuba", 89 },
+  { "utf-7", 127 },
+  { "cp880", 193 },
+  { NULL, -1 },
+  { "iso_8859-8:1988", 8 },
+  { "inis", 48 },
+  { NULL, -1 },
+  { "cp857", 183 },
+  { NULL, -1 },
+  { NULL, -1 },
+  { "csiso151cuba", 89 },
+  { "ccsid01146", 233 },
+  { "iso-ir-150", 88 },
+  { "iso_8859-5:1988", 5 },
+  { NULL, -1 },
+  { "dk-us", 98 },
+  { "csiso111ecmacyrillic", 74 },
+  { "iso-ir-6", 0 },
+  { "cstscii", 243 },
+  { "csunicodeibm1276", 122 },
+  { "csiso49inis", 48 },
+  { "csiso17spanish", 20 },
+  { NULL, -1 },
+  { "ebcdic-fr", 207 },
+  { "windows-936", 108 },
+  { "csunknown8bit", 215 },
+  { "ccsid01140", 227 },
+  { "862", 147 },
+  { "asmo_449", 62 },
+  { "csiso123csaz24341985gr", 77 },
+  { "iso-2022-cn", 101 },
+  { NULL, -1 },
+  { "cp500", 179 },
+  { NULL, -1 },
+  { NULL, -1 },
+  { "csucs4", 116 },
+  { "iso-8859-2-windows-latin-2", 138 },
+  { "csiso5427cyrillic", 45 },
+  { "iso-10646-ucs-4", 116 },
+  { "cp871", 192 },
+  { "iso-10646-unicode-latin1", 118 },
+  { "hp-legal", 151 },
+  { "ibm891", 194 },
+  { "csmnem", 217 },
+  { "iso-ir-70", 56 },
+  { "iso-ir-18", 41 },
+  { "904", 196 },
+  { NULL, -1 },
+  { NULL, -1 },
+  { "ami1251", 240 },
+  { "cswindows31latin1", 137 },
+  { "ami-1251", 240 },
+  { "iso-ir-148", 9 },
+  { "csa_z243.4-1985-gr", 77 },
+  { "csibm038", 163 },
+  { "iso-ir-142", 11 },
+  { "iso_8859-2:1987", 2 },
+  { "cp278", 168 },
+  { NULL, -1 },
+  { "csisolatinarabic", 6 },
+  { "pc-multilingual-850+euro", 225 },
+  { "t.61-8bit", 73 },
+  { NULL, -1 },
+  { "sen_850200_c", 18 },
+  { "iso-unicode-ibm-1261", 120 },
+  { "es", 20 },
+  { NULL, -1 },
+  { NULL, -1 },
+  { "851", 180 },
+  { NULL, -1 },
+  { "ccsid01145", 232 },
+  { NULL, -1 },
+  { NULL, -1 },
+  { "csiso89asmo449", 62 },
+  { "cp51932", 244 },
+  { "csviqr", 219 },
+  { NULL, -1 },
+  { "iso-ir-47", 47 },
+  { "jis_c6220-1969", 38 },
+  { "st_sev_358-88", 91 },
+  { "csiso103t618bit", 73 },
+  { "csksc56011987", 33 },
+  { NULL, -1 },
+  { "iso-2022-cn-ext", 102 },
+  { "csibm275", 166 },
+  { "cscp50220", 256 },
+  { "ibm868", 189 },
+  { "ebcdic-gb-285+euro", 233 },
+  { "shift_jis", 14 },
+  { "iso-8859-1-windows-3.1-latin-1", 137 },
+  { "iso_8859-7:1987", 7 },
+  { NULL, -1 },
+  { "ibm918", 198 },
+  { "iso-ir-69", 23 },
+  { NULL, -1 },
+  { "greek-ccitt", 88 },
+  { "ibm01145", 232 },
+  { "se", 32 },
+  { "csiso60norwegian1", 22 },
+  { "cp367", 0 },
+  { "ibm1026", 199 },
+  { "latin3", 3 },
+  { "cp905", 197 },
+  { NULL, -1 },
+  { "no", 22 },
+  { "ebcdic-it-280+euro", 231 },
+  { "ebcdic-se-278+euro", 230 },
+  { "csiso10367box", 93 },
+  { "csunicode", 115 },
+  { "ibm1047", 238 },
+  { "ibm01144", 231 },
+  { NULL, -1 },
+  { "iso-ir-152", 90 },
+  { "elot_928", 7 },
+  { "fr", 23 },
+  { "iso-ir-226", 107 },
+  { "csibm871", 192 },
+  { "csibm420", 175 },
+  { "ibm865", 188 },
+  { "greek7", 61 },
+  { "ccsid01149", 236 },
+  { "pt154", 239 },
+  { "l1", 1 },
+  { "iso646-dk", 96 },
+  { "csebcdicus", 214 },
+  { "csebcdicesa", 211 },
+  { "ebcdic-fr-297+euro", 234 },
+  { "pc8-danish-norwegian", 146 },
+  { "ebcdic-us-37+euro", 227 },
+  { "iso646-yu", 84 },
+  { NULL, -1 },
+  { "gb_2312-80", 54 },
+  { "adobe-standard-encoding", 141 },
+  { "ebcdic-latin9--euro", 226 },
+  { "msz_7795.3", 59 },
+  { NULL, -1 },
+  { NULL, -1 },
+  { "iso_8859-14:1998", 105 },
+  { "latin8", 105 },
+  { NULL, -1 },
+  { NULL, -1 },
+  { "iso-ir-158", 94 },
+  { "ccsid01148", 235 },
+  { "iso646-kr", 99 },
+  { "ibm297", 174 },
+  { "jp-ocr-b", 65 },
+  { "csiso121canadian1", 75 },
+  { NULL, -1 },
+  { NULL, -1 },
+  { "ccsid01142", 229 },
+  { "csebcdices", 210 },
+  { "iso-ir-14", 39 },
+  { "csibm1026", 199 },
+  { "csibm903", 195 },
+  { "csiso11swedishfornames", 18 },
+  { "koi7-switched", 241 },
+  { NULL, -1 },
+  { "ibm278", 168 },
+  { "csibm866", 222 },
+  { "iso-2022-jp-2", 37 },
+  { NULL, -1 },
+  { "iso-ir-58", 54 },
+  { "ebcdic-dk-277+euro", 229 },
+  { "csiso146serbian", 86 },
+  { "din_66003", 21 },
+  { "arabic7", 62 },
+  { "csiso51iniscyrillic", 50 },
+  { "iso-ir-146", 86 },
+  { "unicode-1-1", 125 },
+  { "hp-desktop", 155 },
+  { "csa_z243.4-1985-1", 75 },
+  { "ibm869", 190 },
+  { "irv", 27 },
+  { "iso_8859-8-e", 81 },
+  { "csinvariant", 26 },
+  { "ebcdic-de-273+euro", 228 },
+  { "strk1048-2002", 114 },
+  { "jis_c6220-1969-ro", 39 },
+  { "latin6", 10 },
+  { "csiso88596i", 79 },
+  { "iso_8859-4:1988", 4 },
+  { "unknown-8bit", 215 },
+  { NULL, -1 },
+  { "iso-ir-123", 77 },
+  { "kz-1048", 114 },
+  { "iso-ir-126", 7 },
+  { "cshpmath8", 153 },
+  { "latin-9", 106 },
+  { "cp870", 191 },
+  { "ibm01142", 229 },
+  { "ibm275", 166 },
+  { NULL, -1 },
+  { "csascii", 0 },
+  { "cspc775baltic", 223 },
+  { "iso646-no2", 55 },
+  { "csibm290", 173 },
+  { "ibm-1047", 238 },
+  { "860", 184 },
+  { "jp-ocr-a", 64 },
+  { "csa7-2", 76 },
+  { "iso-ir-8-2", 29 },
+  { "csebcdicdknoa", 204 },
+  { "t.61-7bit", 72 },
+  { "865", 188 },
+  { "iso646-fr1", 43 },
+  { "ansi_x3.4-1968", 0 },
+  { NULL, -1 },
+  { "ibm861", 185 },
+  { "csisolatin2", 2 },
+  { "cp-is", 185 },
+  { NULL, -1 },
+  { "jis_x0201", 12 },
+  { "iso-ir-15", 19 },
+  { "csiso70videotexsupp1", 56 },
+  { "iso-ir-159", 95 },
+  { "iso-8859-7", 7 },
+  { "cp01143", 230 },
+  { NULL, -1 },
+  { "csn_369103", 83 },
+  { "ebcdic-cp-be", 179 },
+  { "cyrillic-asian", 239 },
+  { "ccsid00924", 226 },
+  { "csibm857", 183 },
+  { "x0212", 95 },
+  { "852", 181 },
+  { "iso-ir-49", 48 },
+  { "csiso143iecp271", 85 },
+  { "bs_4730", 17 },
+  { NULL, -1 },
+  { "iso-ir-155", 93 },
+  { "iso646-no", 22 },
+  { "iso-ir-139", 83 },
+  { "csibm880", 193 },
+  { "iso646-es2", 58 },
+  { "cskoi8r", 220 },
+  { "ebcdic-cp-is", 192 },
+  { "ebcdic-cp-wt", 162 },
+  { NULL, -1 },
+  { "csa_t500-1983", 71 },
+  { "csunicode11utf7", 100 },
+  { NULL, -1 },
+  { "iso-ir-86", 59 },
+  { NULL, -1 },
+  { "861", 185 },
+  { "iso_8859-10:1992", 10 },
+  { "csiso2022jp", 36 },
+  { NULL, -1 },
+  { "cn", 53 },
+  { "ksc_5601", 33 },
+  { "ibm500", 179 },
+  { NULL, -1 },
+  { "ccsid01143", 230 },
+  { "osd_ebcdic_df03_irv", 111 },
+  { "cshppifont", 152 },
+  { "csbrf", 242 },
+  { "cscesu-8", 131 },
+  { "ibm273", 164 },
+  { NULL, -1 },
+  { "ns_4551-2", 55 },
+  { "csisolatincyrillic", 5 },
+  { NULL, -1 },
+  { "ibm819", 1 },
+  { NULL, -1 },
+  { "iso-2022-kr", 34 },
+  { "csiso69french", 23 },
+  { "ibm862", 147 },
+  { "ebcdic-br", 166 },
+  { "ebcdic-es-s", 212 },
+  { "ns_4551-1", 22 },
+  { "ibm420", 175 },
+  { "iso-ir-101", 2 },
+  { "nats-dano-add", 31 },
+  { NULL, -1 },
+  { "inis-cyrillic", 50 },
+  { "dec-mcs", 144 },
+  { NULL, -1 },
+  { NULL, -1 },
+  { "ref", 25 },
+  { NULL, -1 },
+  { "cspc850multilingual", 145 },
+  { "csunicodelatin1", 118 },
+  { NULL, -1 },
+  { NULL, -1 },
+  { NULL, -1 },
+  { "csebcdicatdea", 201 },
+  { "iso-celtic", 105 },
+  { "nats-dano", 30 },
+  { "cp918", 198 },
+  { "ventura-us", 142 },
+  { "x0208", 60 },
+  { NULL, -1 },
+  { NULL, -1 },
+  { NULL, -1 },
+  { "iso_8859-14", 105 },
+  { NULL, -1 },
+  { "ibm855", 182 },
+  { "iso-10646-utf-1", 24 },
+  { "gb2312", 159 },
+  { NULL, -1 },
+  { "csibm278", 168 },
+  { "csiso88598i", 82 },
+  { "iso646-gb", 17 },
+  { NULL, -1 },
+  { "csibm861", 185 },
+  { "ibm880", 193 },
+  { "csiso102t617bit", 72 },
+  { "csiso14jisc6220ro", 39 },
+  { "cp852", 181 },
+  { "iso-ir-89", 62 },
+  { "ibm851", 180 },
+  { NULL, -1 },
+  { "csibm851", 180 },
+  { "l3", 3 },
+  { "csiso10swedish", 32 },
+  { "no2", 55 },
+  { "csmacintosh", 161 },
+  { NULL, -1 },
+  { "ibm285", 172 },
+  { "csebcdicit", 208 },
+  { NULL, -1 },
+  { NULL, -1 },
+  { "koi8-r", 220 },
+  { "cshproman8", 140 },
+  { "cseucpkdfmtjapanese", 15 },
+  { "ebcdic-cp-nl", 162 },
+  { "csibm865", 188 },
+  { "iso_646.irv:1991", 0 },
+  { "ibm871", 192 },
+  { "866", 222 },
+  { "ibm860", 184 },
+  { NULL, -1 },
+  { NULL, -1 },
+  { NULL, -1 },
+  { NULL, -1 },
+  { "ibm905", 197 },
+  { "iso-8859-9-windows-latin-5", 139 },
+  { "csibm864", 187 },
+  { "iso646-jp-ocr-b", 65 },
+  { "iso-ir-99", 71 },
+  { NULL, -1 },
+  { "euc-jp", 15 },
+  { "csibm277", 167 },
+  { "cp424", 177 },
+  { "csibm280", 169 },
+  { "cp290", 173 },
+  { NULL, -1 },
+  { "iso_8859-16", 107 },
+  { "ksc5636", 99 },
+  { "csventuraus", 142 },
+  { "cp00858", 225 },
+  { "iso_8859-1", 1 },
+  { "csiso95jis62291984handadd", 68 },
+  { "iso646-jp", 39 },
+  { "csiso16portuguese", 40 },
+  { NULL, -1 },
+  { "iso-ir-157", 10 },
+  { "l8", 105 },
+  { NULL, -1 },
+  { "csisotextcomm", 11 },
+  { "utf-16be", 128 },
+  { "iso-8859-15", 106 },
+  { NULL, -1 },
+  { "csventuramath", 156 },
+  { "cesu-8", 131 },
+  { NULL, -1 },
+  { "iso-8859-13", 104 },
+  { "utf-8", 103 },
+  { "x0201-7", 38 },
+  { "iso-ir-21", 21 },
+  { "iso-ir-54", 51 },
+  { "l5", 9 },
+  { NULL, -1 },
+  { "iso-ir-127", 6 },
+  { "iso-8859-6-i", 79 },
+  { NULL, -1 },
+  { NULL, -1 },
+  { "csiso47bsviewdata", 47 },
+  { "uk", 17 },
+  { "cshppsmath", 154 },
+  { "cp862", 147 },
+  { "csunicodeibm1264", 123 },
+  { "iso-ir-61", 55 },
+  { "ebcdic-uk", 213 },
+  { "ebcdic-cp-us", 162 },
+  { "osd_ebcdic_df04_15", 110 },
+  { "ebcdic-fi-se-a", 206 },
+  { "iso646-pt2", 57 },
+  { NULL, -1 },
+  { "csisolatin1", 1 },
+  { "euc-kr", 35 },
+  { "cp50220", 256 },
+  { "csiso139csn369103", 83 },
+  { "serbian", 86 },
+  { "ansi_x3.110-1983", 71 },
+  { "iso_5428:1980", 52 },
+  { "csibm273", 164 },
+  { NULL, -1 },
+  { "ibm284", 171 },
+  { "jis_c6229-1984-b-add", 66 },
+  { "ibm01140", 227 },
+  { NULL, -1 },
+  { "iso-ir-128", 80 },
+  { "pt", 40 },
+  { "jis_c6226-1978", 46 },
+  { "iso-ir-95", 68 },
+  { "windows-1255", 251 },
+  { NULL, -1 },
+  { "ecma-114", 6 },
+  { "csiso42jisc62261978", 46 },
+  { "csnatsdano", 30 },
+  { "ascii", 0 },
+  { "ds_2089", 96 },
+  { "jp-ocr-b-add", 66 },
+  { "ibm01147", 234 },
+  { "csiso86hungarian", 59 },
+  { "ibm00858", 225 },
+  { NULL, -1 },
+  { "big5-hkscs", 237 },
+  { "gb", 17 },
+  { "iso-8859-8-i", 82 },
+  { NULL, -1 },
+  { "iso_646.basic:1983", 25 },
+  { "iso-8859-5", 5 },
+  { "latin-greek-1", 44 },
+  { "csebcdicuk", 213 },
+  { "cp01147", 234 },
+  { "ebcdic-int", 163 },
+  { "roman8", 140 },
+  { "ebcdic-cp-roece", 191 },
+  { "cp1026", 199 },
+  { "iso-ir-17", 20 },
+  { NULL, -1 },
+  { "cp037", 162 },
+  { "latin10", 107 },
+  { "ibm904", 196 },
+  { "cp-ar", 189 },
+  { "es2", 58 },
+  { "csiso15italian", 19 },
+  { "mnemonic", 216 },
+  { NULL, -1 },
+  { "mnem", 217 },
+  { "sen_850200_b", 32 },
+  { "850", 145 },
+  { NULL, -1 },
+  { NULL, -1 },
+  { "ebcdic-us", 214 },
+  { "ibm864", 187 },
+  { NULL, -1 },
+  { NULL, -1 },
+  { "csiso19latingreek", 42 },
+  { "iso-ir-90", 63 },
+  { "ibm-thai", 150 },
+  { "iso-ir-93", 66 },
+  { "cp281", 170 },
+  { "iso646-se", 32 },
+  { "ebcdic-cp-dk", 167 },
+  { "iso-ir-138", 8 },
+  { "csibm281", 170 },
+  { NULL, -1 },
+  { "amiga1251", 240 },
+  { "arabic", 6 },
+  { "latin1", 1 },
+  { "iso-ir-199", 105 },
+  { NULL, -1 },
+  { "cp01140", 227 },
+  { "869", 190 },
+  { "ibm01141", 228 },
+  { NULL, -1 },
+  { "jis_c6220-1969-jp", 38 },
+  { "cspcp852", 181 },
+  { NULL, -1 },
+  { "iso-ir-111", 74 },
+  { "cp855", 182 },
+  { "ccsid01144", 231 },
+  { "inis-8", 49 },
+  { "ibm437", 178 },
+  { "l6", 10 },
+  { "iso646-cn", 53 },
+  { NULL, -1 },
+  { "cspc862latinhebrew", 147 },
+  { "r8", 140 },
+  { "iso-2022-jp", 36 },
+  { "ibm00924", 226 },
+  { "cp00924", 226 },
+  { "iso-8859-16", 107 },
+  { "cswindows31j", 158 },
+  { "csjisencoding", 13 },
+  { "cshplegal", 151 },
+  { "cp851", 180 },
+  { "iso-10646-ucs-2", 115 },
+  { "iso-8859-2", 2 },
+  { "csiso150greekccitt", 88 },
+  { NULL, -1 },
+  { "iso_8859-7", 7 },
+  { "csgb2312", 159 },
+  { "ms936", 108 },
+  { "big5", 160 },
+  { "l4", 4 },
+  { "ks_c_5601-1989", 33 },
+  { "iso646-ca", 75 },
+  { "csisolatin6", 10 },
+  { "csibm868", 189 },
+  { "cp273", 164 },
+  { "ebcdic-cp-yu", 191 },
+  { "csibm863", 186 },
+  { "hp-roman8", 140 },
+  { NULL, -1 },
+  { "iso_8859-9:1989", 9 },
+  { NULL, -1 },
+  { "csusdk", 97 },
+  { NULL, -1 },
+  { "csiso2intlrefversion", 27 },
+  { "extended_unix_code_fixed_width_for_japanese", 16 },
+  { "nf_z_62-010_", 43 },
+  { "invariant", 26 },
+  { "hu", 59 },
+  { "iso-ir-102", 72 },
+  { "cp437", 178 },
+  { "iso-ir-4", 17 },
+  { "cskz1048", 114 },
+  { NULL, -1 },
+  { "iso-ir-9-1", 30 },
+  { NULL, -1 },
+  { "cseucfixwidjapanese", 16 },
+  { "iso-ir-87", 60 },
+  { "cshpdesktop", 155 },
+  { "jis_x0208-1983", 60 },
+  { "iso_9036", 62 },
+  { "csiso58gb231280", 54 },
+  { "csiso150", 88 },
+};
+
+
+static inline guint32
+charset_hash (const gchar *key, guint32 seed)
+{
+  guint32 h = 2166136261U ^ seed;
+
+  for (; *key; key++)
+    {
+      h ^= (guchar) g_ascii_tolower (*key);
+      h *= 16777619U;
+    }
+
+  return h;
+}
+
+
+const SourceFileCharset *
+source_file_charset_table_lookup (const gchar *charset_name)
+{
+  guint32 seed;
+  guint   slot;
+
+  seed = charset_hash_displacements[charset_hash (charset_name, 0) % CHARSET_HASH_N_BUCKETS];
+  slot = charset_hash (charset_name, seed) % CHARSET_HASH_N_SLOTS;
+
+  if (charset_hash_slots[slot].key &&
+      g_ascii_strcasecmp (charset_hash_slots[slot].key, charset_name) == 0)
+    return &source_file_charset_table[charset_hash_slots[slot].index];
+
+  return NULL;
+}
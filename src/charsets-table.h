@@ -0,0 +1,11 @@
+#ifndef __SOURCECHARSETSTABLE_H__
+#define __SOURCECHARSETSTABLE_H__
+
+/* Provided by the generated charsets-table.c, see scripts/charset2conf.py */
+
+extern const SourceFileCharset source_file_charset_table[];
+extern const guint             source_file_charset_table_length;
+
+const SourceFileCharset *source_file_charset_table_lookup (const gchar *charset_name);
+
+#endif /* __SOURCECHARSETSTABLE_H__ */
@@ -1,95 +1,26 @@
+#include <string.h>
 #include <glib.h>
 #include "charsets.h"
+#include "charsets-table.h"
 
 
-static SourceFileCharset **charset_table = NULL;
-static guint charset_table_length = 0;
-
-
-#if 0
-static void
-source_file_deinit_charset_table (void)
-{
-  guint i;
-
-  for (i = 0; i < charset_table_length; i++)
-    {
-      g_free (charset_table[i]->name);
-      g_free (charset_table[i]->mime_name);
-      g_strfreev (charset_table[i]->aliases);
-      g_free (charset_table[i]);
-    }
-
-  g_free (charset_table);
-}
-#endif
-
-
-static void
-source_file_init_charset_table (const gchar *filename)
-{
-  GKeyFile *kf;
-  GError   *error;
-  gsize     i, num_charsets;
-  gchar   **groups;
-
-  if (charset_table)
-    return;
-
-  kf = g_key_file_new ();
-
-  error = NULL;
-  if (!g_key_file_load_from_file (kf, filename, G_KEY_FILE_NONE, &error))
-    {
-      g_warning ("Failed to load character set data from file '%s': %s",
-                  filename,
-                  error->message);
-      g_error_free (error);
-      g_key_file_free (kf);
-      return;
-    }
-
-  groups = g_key_file_get_groups (kf, &num_charsets);
-  charset_table = g_new0 (SourceFileCharset*, num_charsets);
-  charset_table_length = (guint) num_charsets;
-  for (i = 0; i < num_charsets; i++)
-    {
-      charset_table[i] = g_new0 (SourceFileCharset, 1);
-      charset_table[i]->name = g_strdup (groups[i]);
-      error = NULL;
-      charset_table[i]->mib_enum = g_key_file_get_integer (kf, groups[i], "mib_enum", &error);
-      if (error)
-        {
-          charset_table[i]->mib_enum = -1;
-          g_error_free (error);
-        }
-      charset_table[i]->mime_name = g_key_file_get_string (kf, groups[i], "mime_name", NULL);
-      charset_table[i]->aliases =
-        g_key_file_get_string_list (kf,
-                                    groups[i],
-                                    "aliases",
-                                    &(charset_table[i]->n_aliases),
-                                    NULL);
-
-    }
-  g_strfreev (groups);
-  g_key_file_free (kf);
-}
+G_LOCK_DEFINE_STATIC (iconv_names);
 
 
 gboolean
 source_file_charset_equals (const SourceFileCharset *charset, const gchar *charset_name)
 {
-  if (g_strcasecmp (charset->name, charset_name) == 0)
+  if (g_ascii_strcasecmp (charset->name, charset_name) == 0)
     return TRUE;
-  else if (g_strcasecmp (charset->mime_name, charset_name) == 0)
+  else if (charset->mime_name &&
+           g_ascii_strcasecmp (charset->mime_name, charset_name) == 0)
     return TRUE;
   else
     {
       gsize i;
       for (i = 0; i < charset->n_aliases; i++)
         {
-          if (g_strcasecmp (charset->aliases[i], charset_name) == 0)
+          if (g_ascii_strcasecmp (charset->aliases[i], charset_name) == 0)
             return TRUE;
         }
     }
@@ -107,17 +38,12 @@ source_file_charset_exists (const gchar *charset_name)
 const SourceFileCharset *
 source_file_lookup_charset (const gchar *charset_name)
 {
-  guint i;
-
-  source_file_init_charset_table (SOURCE_FILE_CHARSET_CONF);
-
-  for (i = 0; i < charset_table_length; i++)
-    {
-      if (source_file_charset_equals (charset_table[i], charset_name))
-        return (const SourceFileCharset *) charset_table[i];
-    }
+  if (!charset_name || !*charset_name)
+    return NULL;
 
-  return NULL;
+  /* perfect hash over the case-folded names and aliases, generated at
+   * build time from data/iana-charsets.txt */
+  return source_file_charset_table_lookup (charset_name);
 }
 
 
@@ -138,7 +64,100 @@ source_file_normalize_charset_name (const gchar *charset_name)
 }
 
 
+/*
+ * The one copy of charset_name's canonical name, which lives in the
+ * charset table, so names can be compared by pointer. Names the table
+ * doesn't know are interned as they are. Never to be freed.
+ */
+const gchar *
+source_file_intern_charset_name (const gchar *charset_name)
+{
+  const SourceFileCharset *charset;
+
+  if (!charset_name)
+    return NULL;
+
+  charset = source_file_lookup_charset (charset_name);
+
+  if (!charset)
+    return g_intern_string (charset_name);
+
+  return charset->name;
+}
+
+
+/*
+ * A name for charset_name that iconv knows: the canonical name, else the
+ * MIME name, else the first alias g_iconv_open() takes. Some canonical
+ * IANA names, like Extended_UNIX_Code_Packed_Format_for_Japanese for
+ * EUC-JP, mean nothing to glibc. Worked out once per charset; names the
+ * table doesn't know are returned as they are.
+ */
+const gchar *
+source_file_charset_iconv_name (const gchar *charset_name)
+{
+  static GHashTable       *iconv_names = NULL;
+  const SourceFileCharset *charset;
+  const gchar             *name;
+  GIConv                   cd;
+  gsize                    i;
 
+  charset = source_file_lookup_charset (charset_name);
+  if (!charset)
+    return charset_name;
+
+  G_LOCK (iconv_names);
+
+  if (!iconv_names)
+    iconv_names = g_hash_table_new (NULL, NULL);
+
+  name = g_hash_table_lookup (iconv_names, charset);
+
+  for (i = 0; !name && i < charset->n_aliases + 2; i++)
+    {
+      if (i == 0)
+        name = charset->name;
+      else if (i == 1)
+        name = charset->mime_name;
+      else
+        name = charset->aliases[i - 2];
+
+      if (!name)
+        continue;
+
+      cd = g_iconv_open ("UTF-8", name);
+      if (cd == (GIConv) -1)
+        name = NULL;
+      else
+        g_iconv_close (cd);
+    }
 
+  /* nothing works, the error will name the charset as it's known */
+  if (!name)
+    name = charset->name;
 
+  g_hash_table_insert (iconv_names, (gpointer) charset, (gpointer) name);
 
+  G_UNLOCK (iconv_names);
+
+  return name;
+}
+
+
+/* the decoder can start over anywhere in these without losing state */
+gboolean
+source_file_charset_is_stateless (const gchar *charset_name)
+{
+  static const gchar * const stateful[] =
+    { "UTF-7", "UTF-16", "UTF-32", "UCS-2", "UCS-4", "ISO-2022", "HZ", NULL };
+  gsize i;
+
+  for (i = 0; stateful[i]; i++)
+    if (g_ascii_strncasecmp (charset_name, stateful[i], strlen (stateful[i])) == 0)
+      {
+        /* the ones with a fixed byte order are fine */
+        return g_str_has_suffix (charset_name, "BE") || g_str_has_suffix (charset_name, "LE");
+      }
+
+  return TRUE;
+}
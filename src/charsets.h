@@ -17,5 +17,8 @@ const SourceFileCharset *source_file_lookup_charset (const gchar             *ch
 gboolean                 source_file_charset_equals (const SourceFileCharset *charset,
                                                      const gchar             *charset_name);
 gchar                   *source_file_normalize_charset_name (const gchar *charset_name);
+const gchar             *source_file_intern_charset_name    (const gchar *charset_name);
+const gchar             *source_file_charset_iconv_name     (const gchar *charset_name);
+gboolean                 source_file_charset_is_stateless   (const gchar *charset_name);
 
 #endif /* __SOURCECHARSETS_H__ */
@@ -0,0 +1,182 @@
+#include <string.h>
+#include <glib.h>
+#include <gio/gio.h>
+#include "charsets.h"
+#include "codec.h"
+#include "singlebyte.h"
+#include "unicode.h"
+#include "utf8scan.h"
+
+
+/*
+ * Picks a built-in transcoder between UTF-8 and another charset, if there
+ * is one: the single-byte tables in singlebyte.c or UTF-16/UTF-32 in
+ * unicode.c. Codecs are stateless functions over a constant table, so the
+ * GConverter they are used through only holds the two and has nothing to
+ * reset.
+ */
+
+
+typedef struct
+{
+  GObject             parent_instance;
+  SourceFileCodecFunc func;
+  gconstpointer       codec;
+} SourceFileCodecConverter;
+
+typedef struct
+{
+  GObjectClass parent_class;
+} SourceFileCodecConverterClass;
+
+
+static GType source_file_codec_converter_get_type   (void);
+static void  source_file_codec_converter_iface_init (GConverterIface *iface);
+
+
+G_DEFINE_TYPE_WITH_CODE (SourceFileCodecConverter, source_file_codec_converter, G_TYPE_OBJECT,
+                         G_IMPLEMENT_INTERFACE (G_TYPE_CONVERTER,
+                                                source_file_codec_converter_iface_init))
+
+
+static void
+source_file_codec_converter_class_init (SourceFileCodecConverterClass *klass)
+{
+}
+
+
+static void
+source_file_codec_converter_init (SourceFileCodecConverter *self)
+{
+}
+
+
+/* reports errors the same way GCharsetConverter does, so callers can't
+ * tell the two apart */
+static GConverterResult
+source_file_codec_converter_convert (GConverter       *converter,
+                                     const void       *inbuf,
+                                     gsize             inbuf_size,
+                                     void             *outbuf,
+                                     gsize             outbuf_size,
+                                     GConverterFlags   flags,
+                                     gsize            *bytes_read,
+                                     gsize            *bytes_written,
+                                     GError          **error)
+{
+  SourceFileCodecConverter *self = (SourceFileCodecConverter *) converter;
+  SourceFileCodecStatus     status;
+
+  status = self->func (self->codec, inbuf, inbuf_size, outbuf, outbuf_size,
+                       bytes_read, bytes_written);
+
+  if (status != SOURCE_FILE_CODEC_DONE)
+    {
+      /* the error is for the next call, which starts at the same place */
+      if (*bytes_written)
+        return G_CONVERTER_CONVERTED;
+
+      if (status == SOURCE_FILE_CODEC_NO_SPACE)
+        g_set_error_literal (error, G_IO_ERROR, G_IO_ERROR_NO_SPACE,
+                             "Not enough space in destination");
+      else if (status == SOURCE_FILE_CODEC_PARTIAL)
+        g_set_error_literal (error, G_IO_ERROR, G_IO_ERROR_PARTIAL_INPUT,
+                             "Incomplete multibyte sequence in input");
+      else
+        g_set_error_literal (error, G_IO_ERROR, G_IO_ERROR_INVALID_DATA,
+                             "Invalid byte sequence in conversion input");
+
+      return G_CONVERTER_ERROR;
+    }
+
+  if (flags & G_CONVERTER_INPUT_AT_END)
+    return G_CONVERTER_FINISHED;
+  else if (flags & G_CONVERTER_FLUSH)
+    return G_CONVERTER_FLUSHED;
+
+  return G_CONVERTER_CONVERTED;
+}
+
+
+/* nothing is kept between calls */
+static void
+source_file_codec_converter_reset (GConverter *converter)
+{
+}
+
+
+static void
+source_file_codec_converter_iface_init (GConverterIface *iface)
+{
+  iface->convert = source_file_codec_converter_convert;
+  iface->reset = source_file_codec_converter_reset;
+}
+
+
+/*
+ * Finds the codec for converting from_charset to to_charset, one of which
+ * has to be UTF-8. Returns FALSE if there's none and iconv has to do.
+ */
+gboolean
+source_file_codec_lookup (const gchar          *to_charset,
+                          const gchar          *from_charset,
+                          SourceFileCodecFunc  *func,
+                          gconstpointer        *codec)
+{
+  const SourceFileCharset *utf8;
+  const gchar             *other;
+  gboolean                 encode;
+
+  g_return_val_if_fail (to_charset && from_charset, FALSE);
+
+  utf8 = source_file_lookup_charset ("UTF-8");
+
+  if (source_file_lookup_charset (from_charset) == utf8)
+    other = to_charset, encode = TRUE;
+  else if (source_file_lookup_charset (to_charset) == utf8)
+    other = from_charset, encode = FALSE;
+  else
+    return FALSE;
+
+  if ((*codec = source_file_single_byte_lookup (other)))
+    *func = encode ? source_file_single_byte_encode : source_file_single_byte_decode;
+  else if ((*codec = source_file_unicode_lookup (other)))
+    *func = encode ? source_file_unicode_encode : source_file_unicode_decode;
+  else
+    return FALSE;
+
+  return TRUE;
+}
+
+
+/* a converter for the codec source_file_codec_lookup() finds, or NULL */
+GConverter *
+source_file_codec_converter_new (const gchar *to_charset, const gchar *from_charset)
+{
+  SourceFileCodecConverter *converter;
+  SourceFileCodecFunc       func;
+  gconstpointer             codec;
+
+  if (!source_file_codec_lookup (to_charset, from_charset, &func, &codec))
+    return NULL;
+
+  converter = g_object_new (source_file_codec_converter_get_type (), NULL);
+  converter->func = func;
+  converter->codec = codec;
+
+  return G_CONVERTER (converter);
+}
+
+
+/* SOURCE_FILE_SIMD=none turns the codecs' vector code off along with the
+ * UTF-8 scanners' */
+gboolean
+source_file_codec_use_simd (void)
+{
+  static gsize use_simd = 0;
+
+  if (g_once_init_enter (&use_simd))
+    g_once_init_leave (&use_simd, strcmp (source_file_utf8_scan_impl (), "none") != 0 ? 2 : 1);
+
+  return use_simd == 2;
+}
@@ -0,0 +1,37 @@
+#ifndef __SOURCECODEC_H__
+#define __SOURCECODEC_H__
+
+G_BEGIN_DECLS
+
+
+typedef enum
+{
+  SOURCE_FILE_CODEC_DONE,      /* all of the input was converted */
+  SOURCE_FILE_CODEC_NO_SPACE,  /* the next character doesn't fit */
+  SOURCE_FILE_CODEC_PARTIAL,   /* the input ends inside a character */
+  SOURCE_FILE_CODEC_INVALID    /* the next character can't be converted */
+} SourceFileCodecStatus;
+
+
+/* converts as much of input as it can, saying why it stopped if early */
+typedef SourceFileCodecStatus (*SourceFileCodecFunc) (gconstpointer  codec,
+                                                      const gchar   *input,
+                                                      gsize          input_length,
+                                                      gchar         *output,
+                                                      gsize          output_size,
+                                                      gsize         *n_read,
+                                                      gsize         *n_written);
+
+
+gboolean    source_file_codec_lookup        (const gchar          *to_charset,
+                                             const gchar          *from_charset,
+                                             SourceFileCodecFunc  *func,
+                                             gconstpointer        *codec);
+GConverter *source_file_codec_converter_new (const gchar          *to_charset,
+                                             const gchar          *from_charset);
+gboolean    source_file_codec_use_simd      (void);
+
+
+G_END_DECLS
+
+#endif /* __SOURCECODEC_H__ */
@@ -0,0 +1,480 @@
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <glib.h>
+#include <glib/gstdio.h>
+#include "sourcefile.h"
+#include "charsets.h"
+#include "detectcache.h"
+
+
+/*
+ * Remembers the charset and MIME type detected for a file across runs,
+ * keyed by device, inode, size, modification time and a hash of the
+ * first bytes, so reopening an unchanged file skips detection.
+ *
+ * The cache file is a header followed by fixed-size records sorted by
+ * key, then a pool of nul-terminated strings the records point into.
+ * It's mapped and binary searched in place; entries added since are
+ * kept in a hash table on top and merged in by a flush.
+ */
+
+
+#define DETECT_CACHE_MAGIC    "SFDC"
+#define DETECT_CACHE_VERSION  1
+#define DETECT_CACHE_NO_NAME  G_MAXUINT32
+#define DETECT_CACHE_HEAD_MAX 4096
+
+
+typedef struct
+{
+  gchar   magic[4];
+  guint32 version;
+  guint32 n_records;
+  guint32 pool_size;
+} DetectCacheHeader;
+
+
+typedef struct
+{
+  SourceFileDetectKey key;
+  guint32             charset;    /* offsets into the string pool */
+  guint32             mime_type;
+} DetectCacheRecord;
+
+
+typedef struct
+{
+  const gchar *charset;     /* interned, as on the SourceFile */
+  const gchar *mime_type;
+} DetectCacheEntry;
+
+
+G_LOCK_DEFINE_STATIC (detect_cache);
+static gchar                   *detect_cache_path = NULL;
+static GMappedFile             *detect_cache_mapped = NULL;
+static const DetectCacheRecord *detect_cache_records = NULL;
+static guint                    detect_cache_n_records = 0;
+static const gchar             *detect_cache_pool = NULL;
+static guint32                  detect_cache_pool_size = 0;
+static GHashTable              *detect_cache_added = NULL;
+static guint                    detect_cache_hits = 0;
+static guint                    detect_cache_misses = 0;
+
+
+static guint
+detect_key_hash (gconstpointer data)
+{
+  const SourceFileDetectKey *key = data;
+
+  return (guint) (key->inode ^ (key->inode >> 32) ^ key->size ^
+                  key->mtime ^ key->mtime_nsec ^ key->head_hash);
+}
+
+
+static gboolean
+detect_key_equal (gconstpointer a, gconstpointer b)
+{
+  return memcmp (a, b, sizeof (SourceFileDetectKey)) == 0;
+}
+
+
+static gint
+detect_key_compare (gconstpointer a, gconstpointer b)
+{
+  const guint64 *x = a, *y = b;
+  guint          i;
+
+  for (i = 0; i < sizeof (SourceFileDetectKey) / sizeof (guint64); i++)
+    {
+      if (x[i] != y[i])
+        return x[i] < y[i] ? -1 : 1;
+    }
+
+  return 0;
+}
+
+
+static void
+detect_cache_entry_free (gpointer data)
+{
+  DetectCacheEntry *entry = data;
+
+  g_slice_free (DetectCacheEntry, entry);
+}
+
+
+static const gchar *
+detect_cache_pool_string (guint32 offset)
+{
+  if (offset >= detect_cache_pool_size)
+    return NULL;
+  return detect_cache_pool + offset;
+}
+
+
+/* drops the mapped records, not the added ones; called locked */
+static void
+detect_cache_unmap (void)
+{
+  if (detect_cache_mapped)
+    g_mapped_file_unref (detect_cache_mapped);
+
+  detect_cache_mapped = NULL;
+  detect_cache_records = NULL;
+  detect_cache_n_records = 0;
+  detect_cache_pool = NULL;
+  detect_cache_pool_size = 0;
+}
+
+
+/* maps the cache file, if there is a valid one; called locked */
+static void
+detect_cache_map (void)
+{
+  const DetectCacheHeader *header;
+  GMappedFile             *mapped;
+  const gchar             *data;
+  gsize                    length, records_size;
+
+  detect_cache_unmap ();
+
+  mapped = g_mapped_file_new (detect_cache_path, FALSE, NULL);
+  if (!mapped)
+    return;
+
+  data = g_mapped_file_get_contents (mapped);
+  length = g_mapped_file_get_length (mapped);
+  header = (const DetectCacheHeader *) data;
+
+  if (length < sizeof (DetectCacheHeader) ||
+      memcmp (header->magic, DETECT_CACHE_MAGIC, 4) != 0 ||
+      header->version != DETECT_CACHE_VERSION)
+    {
+      g_mapped_file_unref (mapped);
+      return;
+    }
+
+  records_size = (gsize) header->n_records * sizeof (DetectCacheRecord);
+
+  if (length - sizeof (DetectCacheHeader) < records_size ||
+      length - sizeof (DetectCacheHeader) - records_size != header->pool_size ||
+      (header->pool_size && data[length - 1] != '\0'))
+    {
+      g_warning ("Ignoring corrupt detection cache '%s'", detect_cache_path);
+      g_mapped_file_unref (mapped);
+      return;
+    }
+
+  detect_cache_mapped = mapped;
+  detect_cache_records = (const DetectCacheRecord *) (data + sizeof (DetectCacheHeader));
+  detect_cache_n_records = header->n_records;
+  detect_cache_pool = data + sizeof (DetectCacheHeader) + records_size;
+  detect_cache_pool_size = header->pool_size;
+}
+
+
+gboolean
+source_file_detect_cache_is_enabled (void)
+{
+  gboolean enabled;
+
+  G_LOCK (detect_cache);
+  enabled = detect_cache_path != NULL;
+  G_UNLOCK (detect_cache);
+
+  return enabled;
+}
+
+
+/*
+ * Fills in key for filename, whose first head_length bytes are at head.
+ * Returns FALSE if the file can't be looked at.
+ */
+gboolean
+source_file_detect_key_init (SourceFileDetectKey *key,
+                             const gchar         *filename,
+                             const gchar         *head,
+                             gsize                head_length)
+{
+  GStatBuf st;
+  guint64  hash = G_GUINT64_CONSTANT (14695981039346656037);
+  gsize    i;
+
+  if (g_stat (filename, &st) != 0)
+    return FALSE;
+
+  /* FNV-1a, it only has to tell apart files with equal metadata */
+  for (i = 0; i < MIN (head_length, DETECT_CACHE_HEAD_MAX); i++)
+    {
+      hash ^= (guchar) head[i];
+      hash *= G_GUINT64_CONSTANT (1099511628211);
+    }
+
+  memset (key, 0, sizeof (SourceFileDetectKey));
+  key->device = st.st_dev;
+  key->inode = st.st_ino;
+  key->size = st.st_size;
+  key->mtime = st.st_mtime;
+#if defined (__APPLE__)
+  key->mtime_nsec = st.st_mtimespec.tv_nsec;
+#elif defined (__linux__) || defined (__FreeBSD__) || defined (__NetBSD__) || defined (__OpenBSD__)
+  key->mtime_nsec = st.st_mtim.tv_nsec;
+#endif
+  key->head_hash = hash;
+
+  return TRUE;
+}
+
+
+/*
+ * Looks key up, returning the interned names of what was detected for
+ * it (either may be NULL if unknown). Counts towards the hit rate.
+ */
+gboolean
+source_file_detect_cache_lookup (const SourceFileDetectKey  *key,
+                                 const gchar               **charset,
+                                 const gchar               **mime_type)
+{
+  const DetectCacheRecord *record = NULL;
+  DetectCacheEntry        *entry = NULL;
+
+  G_LOCK (detect_cache);
+
+  if (detect_cache_added)
+    entry = g_hash_table_lookup (detect_cache_added, key);
+
+  if (entry)
+    {
+      *charset = entry->charset;
+      *mime_type = entry->mime_type;
+    }
+  else if (detect_cache_records)
+    {
+      record = bsearch (key, detect_cache_records, detect_cache_n_records,
+                        sizeof (DetectCacheRecord), detect_key_compare);
+      if (record)
+        {
+          *charset = source_file_intern_charset_name (detect_cache_pool_string (record->charset));
+          *mime_type = g_intern_string (detect_cache_pool_string (record->mime_type));
+        }
+    }
+
+  if (entry || record)
+    detect_cache_hits++;
+  else
+    detect_cache_misses++;
+
+  G_UNLOCK (detect_cache);
+
+  return entry || record;
+}
+
+
+void
+source_file_detect_cache_insert (const SourceFileDetectKey *key,
+                                 const gchar               *charset,
+                                 const gchar               *mime_type)
+{
+  DetectCacheEntry *entry;
+
+  G_LOCK (detect_cache);
+
+  if (detect_cache_path)
+    {
+      if (!detect_cache_added)
+        detect_cache_added = g_hash_table_new_full (detect_key_hash, detect_key_equal,
+                                                    g_free, detect_cache_entry_free);
+
+      entry = g_slice_new0 (DetectCacheEntry);
+      entry->charset = source_file_intern_charset_name (charset);
+      entry->mime_type = g_intern_string (mime_type);
+
+      g_hash_table_replace (detect_cache_added,
+                            g_memdup2 (key, sizeof (SourceFileDetectKey)),
+                            entry);
+    }
+
+  G_UNLOCK (detect_cache);
+}
+
+
+/*
+ * Turns on the detection cache, backed by the file at path or, if NULL,
+ * "sourcefile/detect.cache" under the user cache directory
+ * ($XDG_CACHE_HOME). New results are only written out by
+ * source_file_detect_cache_flush().
+ */
+void
+source_file_detect_cache_enable (const gchar *path)
+{
+  G_LOCK (detect_cache);
+
+  g_free (detect_cache_path);
+  if (path)
+    detect_cache_path = g_strdup (path);
+  else
+    detect_cache_path = g_build_filename (g_get_user_cache_dir (),
+                                          "sourcefile", "detect.cache", NULL);
+
+  detect_cache_map ();
+
+  G_UNLOCK (detect_cache);
+}
+
+
+/* turns the cache off, dropping anything not flushed */
+void
+source_file_detect_cache_disable (void)
+{
+  G_LOCK (detect_cache);
+
+  detect_cache_unmap ();
+
+  if (detect_cache_added)
+    g_hash_table_destroy (detect_cache_added);
+  detect_cache_added = NULL;
+
+  g_free (detect_cache_path);
+  detect_cache_path = NULL;
+
+  G_UNLOCK (detect_cache);
+}
+
+
+static guint32
+detect_cache_pool_add (GString *pool, GHashTable *offsets, const gchar *name)
+{
+  gpointer offset;
+
+  if (!name)
+    return DETECT_CACHE_NO_NAME;
+
+  /* the same few charsets and types come up over and over */
+  if (!g_hash_table_lookup_extended (offsets, name, NULL, &offset))
+    {
+      offset = GUINT_TO_POINTER (pool->len);
+      g_string_append_len (pool, name, strlen (name) + 1);
+      g_hash_table_insert (offsets, (gpointer) name, offset);
+    }
+
+  return GPOINTER_TO_UINT (offset);
+}
+
+
+/*
+ * Writes the cache out, merging what was added since it was last read.
+ * Returns FALSE if it's not enabled or couldn't be written.
+ */
+gboolean
+source_file_detect_cache_flush (void)
+{
+  DetectCacheHeader  header;
+  DetectCacheRecord *records;
+  GHashTableIter     iter;
+  GHashTable        *offsets;
+  GString           *pool, *contents;
+  gpointer           key, value;
+  GError            *error = NULL;
+  gchar             *dirname;
+  guint              i, n_records = 0;
+  gboolean           success;
+
+  G_LOCK (detect_cache);
+
+  if (!detect_cache_path)
+    {
+      G_UNLOCK (detect_cache);
+      return FALSE;
+    }
+
+  if (!detect_cache_added || !g_hash_table_size (detect_cache_added))
+    {
+      G_UNLOCK (detect_cache);
+      return TRUE;
+    }
+
+  records = g_new0 (DetectCacheRecord,
+                    detect_cache_n_records + g_hash_table_size (detect_cache_added));
+  offsets = g_hash_table_new (g_str_hash, g_str_equal);
+  pool = g_string_new (NULL);
+
+  g_hash_table_iter_init (&iter, detect_cache_added);
+  while (g_hash_table_iter_next (&iter, &key, &value))
+    {
+      DetectCacheEntry *entry = value;
+
+      records[n_records].key = *(SourceFileDetectKey *) key;
+      records[n_records].charset = detect_cache_pool_add (pool, offsets, entry->charset);
+      records[n_records].mime_type = detect_cache_pool_add (pool, offsets, entry->mime_type);
+      n_records++;
+    }
+
+  for (i = 0; i < detect_cache_n_records; i++)
+    {
+      const DetectCacheRecord *old = &detect_cache_records[i];
+
+      if (g_hash_table_contains (detect_cache_added, &old->key))
+        continue;
+
+      records[n_records].key = old->key;
+      records[n_records].charset =
+        detect_cache_pool_add (pool, offsets, detect_cache_pool_string (old->charset));
+      records[n_records].mime_type =
+        detect_cache_pool_add (pool, offsets, detect_cache_pool_string (old->mime_type));
+      n_records++;
+    }
+
+  qsort (records, n_records, sizeof (DetectCacheRecord), detect_key_compare);
+
+  memcpy (header.magic, DETECT_CACHE_MAGIC, 4);
+  header.version = DETECT_CACHE_VERSION;
+  header.n_records = n_records;
+  header.pool_size = pool->len;
+
+  contents = g_string_sized_new (sizeof (header) + n_records * sizeof (DetectCacheRecord) + pool->len);
+  g_string_append_len (contents, (const gchar *) &header, sizeof (header));
+  g_string_append_len (contents, (const gchar *) records, n_records * sizeof (DetectCacheRecord));
+  g_string_append_len (contents, pool->str, pool->len);
+
+  dirname = g_path_get_dirname (detect_cache_path);
+  g_mkdir_with_parents (dirname, 0700);
+  g_free (dirname);
+
+  success = g_file_set_contents (detect_cache_path, contents->str, contents->len, &error);
+  if (success)
+    {
+      g_hash_table_remove_all (detect_cache_added);
+      detect_cache_map ();
+    }
+  else
+    {
+      g_warning ("Failed to write detection cache '%s': %s", detect_cache_path, error->message);
+      g_error_free (error);
+    }
+
+  g_string_free (contents, TRUE);
+  g_string_free (pool, TRUE);
+  g_hash_table_destroy (offsets);
+  g_free (records);
+
+  G_UNLOCK (detect_cache);
+
+  return success;
+}
+
+
+/* how many lookups were answered from the cache, and how many not */
+void
+source_file_detect_cache_get_stats (guint *hits, guint *misses)
+{
+  G_LOCK (detect_cache);
+
+  if (hits)
+    *hits = detect_cache_hits;
+  if (misses)
+    *misses = detect_cache_misses;
+
+  G_UNLOCK (detect_cache);
+}
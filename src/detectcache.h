@@ -0,0 +1,36 @@
+#ifndef __SOURCEDETECTCACHE_H__
+#define __SOURCEDETECTCACHE_H__
+
+G_BEGIN_DECLS
+
+
+typedef struct _SourceFileDetectKey SourceFileDetectKey;
+
+/* all 64 bit, so there's no padding and keys can be hashed as bytes */
+struct _SourceFileDetectKey
+{
+  guint64 device;
+  guint64 inode;
+  guint64 size;
+  guint64 mtime;
+  guint64 mtime_nsec;
+  guint64 head_hash;
+};
+
+
+gboolean source_file_detect_cache_is_enabled (void);
+gboolean source_file_detect_key_init         (SourceFileDetectKey       *key,
+                                              const gchar               *filename,
+                                              const gchar               *head,
+                                              gsize                      head_length);
+gboolean source_file_detect_cache_lookup     (const SourceFileDetectKey *key,
+                                              const gchar              **charset,
+                                              const gchar              **mime_type);
+void     source_file_detect_cache_insert     (const SourceFileDetectKey *key,
+                                              const gchar               *charset,
+                                              const gchar               *mime_type);
+
+
+G_END_DECLS
+
+#endif /* __SOURCEDETECTCACHE_H__ */
@@ -0,0 +1,489 @@
+#include <string.h>
+#include <glib.h>
+#include <gio/gio.h>
+#include "sourcefile.h"
+#include "detectcache.h"
+#include "dirwatch.h"
+
+
+/*
+ * Watches files through one monitor per parent directory instead of one
+ * per file, so inotify watches (and GFileMonitor objects) grow with the
+ * number of directories. Events are dispatched by basename to every
+ * watch on that file.
+ *
+ * Directories past the watch limit, or whose monitor can't be created,
+ * are polled instead: a timer stats a batch of their files per tick and
+ * reports anything whose inode, size or modification time changed.
+ *
+ * Monitors and the poll timer report to the thread-default main context
+ * of whoever created them.
+ */
+
+
+#define WATCH_POLL_INTERVAL 2000  /* ms */
+#define WATCH_POLL_BATCH    256   /* files stat'ed per tick */
+#define WATCH_DEFAULT_MAX   8192
+
+
+typedef struct
+{
+  guint64           id;
+  GFileMonitorEvent event;
+} WatchEvent;
+
+
+typedef struct
+{
+  gchar        *path;
+  GFileMonitor *monitor;   /* NULL if polled */
+  GHashTable   *files;     /* basename -> GList of SourceFileWatch */
+} WatchDir;
+
+
+struct _SourceFileWatch
+{
+  guint64              id;
+  WatchDir            *dir;
+  gchar               *basename;
+  gchar               *filename;
+  SourceFileWatchFunc  func;
+  gpointer             user_data;
+
+  /* last seen state, and place in watch_polled when polled */
+  SourceFileDetectKey  state;
+  gboolean             exists;
+  guint                poll_index;
+
+  /* no monitor event delivered yet, see watch_queue() */
+  gboolean             fresh;
+};
+
+
+G_LOCK_DEFINE_STATIC (watch_manager);
+static GHashTable *watch_dirs = NULL;        /* path -> WatchDir */
+static GHashTable *watch_ids = NULL;         /* id -> SourceFileWatch */
+static guint64     watch_next_id = 1;
+static guint       watch_n_monitors = 0;
+static gint        watch_max_monitors = -1;  /* -1 until initialized */
+static GPtrArray  *watch_polled = NULL;      /* SourceFileWatch in polled dirs */
+static guint       watch_poll_cursor = 0;
+static GSource    *watch_poll_source = NULL;
+
+
+/* leave most of the per-user inotify watches to everybody else */
+static gint
+watch_default_max_monitors (void)
+{
+  gchar  *contents;
+  guint64 max = 0;
+
+  if (g_file_get_contents ("/proc/sys/fs/inotify/max_user_watches", &contents, NULL, NULL))
+    {
+      max = g_ascii_strtoull (contents, NULL, 10) / 2;
+      g_free (contents);
+    }
+
+  return max ? (gint) MIN (max, G_MAXINT) : WATCH_DEFAULT_MAX;
+}
+
+
+/*
+ * Events are queued by watch id rather than pointer and delivered after
+ * the lock is dropped, so callbacks are free to add and remove watches
+ * (even the last one in a directory) while others are still pending.
+ */
+static void
+watch_queue (GArray *events, WatchDir *dir, const gchar *basename, GFileMonitorEvent event_type)
+{
+  GList              *l;
+  WatchEvent          event;
+  SourceFileWatch    *watch;
+  SourceFileDetectKey state;
+  gboolean            exists;
+
+  for (l = g_hash_table_lookup (dir->files, basename); l; l = l->next)
+    {
+      watch = l->data;
+
+      /*
+       * A watch added to a directory that is already monitored can see
+       * events queued before it existed, drop those while the file still
+       * looks the way it did when the watch was added.
+       */
+      if (watch->fresh)
+        {
+          exists = source_file_detect_key_init (&state, watch->filename, NULL, 0);
+          if (exists == watch->exists &&
+              (!exists || memcmp (&state, &watch->state, sizeof (state)) == 0))
+            continue;
+          watch->fresh = FALSE;
+        }
+
+      event.id = watch->id;
+      event.event = event_type;
+      g_array_append_val (events, event);
+    }
+}
+
+
+static void
+watch_deliver (GArray *events)
+{
+  guint i;
+
+  for (i = 0; i < events->len; i++)
+    {
+      WatchEvent         *event = &g_array_index (events, WatchEvent, i);
+      SourceFileWatch    *watch;
+      SourceFileWatchFunc func = NULL;
+      gpointer            user_data = NULL;
+
+      G_LOCK (watch_manager);
+      watch = g_hash_table_lookup (watch_ids, &event->id);
+      if (watch)
+        {
+          func = watch->func;
+          user_data = watch->user_data;
+        }
+      G_UNLOCK (watch_manager);
+
+      if (func)
+        func (event->event, user_data);
+    }
+}
+
+
+/*
+ * Monitors emit on whichever thread they were created for while the
+ * last watch in their directory can be removed from any other, so the
+ * handler gets the path and looks the directory up under the lock. A
+ * directory freed (or freed and watched again) by then is left alone.
+ */
+static void
+on_dir_monitor_changed (GFileMonitor      *monitor,
+                        GFile             *gfile,
+                        GFile             *other_file,
+                        GFileMonitorEvent  event_type,
+                        const gchar       *path)
+{
+  WatchDir *dir;
+  GArray   *events;
+  gchar    *basename, *parent;
+
+  G_LOCK (watch_manager);
+
+  dir = watch_dirs ? g_hash_table_lookup (watch_dirs, path) : NULL;
+  if (!dir || dir->monitor != monitor)
+    {
+      G_UNLOCK (watch_manager);
+      return;
+    }
+
+  events = g_array_new (FALSE, FALSE, sizeof (WatchEvent));
+
+  basename = g_file_get_basename (gfile);
+  watch_queue (events, dir, basename, event_type);
+  g_free (basename);
+
+  /* a file renamed over a watched one, as in an atomic save */
+  if (other_file)
+    {
+      parent = g_path_get_dirname (g_file_peek_path (other_file));
+      if (g_strcmp0 (parent, dir->path) == 0)
+        {
+          basename = g_file_get_basename (other_file);
+          watch_queue (events, dir, basename, event_type);
+          g_free (basename);
+        }
+      g_free (parent);
+    }
+
+  G_UNLOCK (watch_manager);
+
+  watch_deliver (events);
+  g_array_unref (events);
+}
+
+
+static void
+watch_poll_state (SourceFileWatch *watch)
+{
+  watch->exists = source_file_detect_key_init (&watch->state, watch->filename, NULL, 0);
+}
+
+
+static gboolean
+watch_poll (gpointer user_data)
+{
+  GArray *events;
+  guint   i, n;
+
+  events = g_array_new (FALSE, FALSE, sizeof (WatchEvent));
+
+  G_LOCK (watch_manager);
+
+  n = MIN (WATCH_POLL_BATCH, watch_polled->len);
+  for (i = 0; i < n; i++)
+    {
+      SourceFileWatch     *watch;
+      SourceFileDetectKey  state;
+      gboolean             exists;
+
+      if (watch_poll_cursor >= watch_polled->len)
+        watch_poll_cursor = 0;
+      watch = g_ptr_array_index (watch_polled, watch_poll_cursor++);
+
+      exists = source_file_detect_key_init (&state, watch->filename, NULL, 0);
+      if (exists != watch->exists ||
+          (exists && memcmp (&state, &watch->state, sizeof (state)) != 0))
+        {
+          WatchEvent event;
+
+          event.id = watch->id;
+          event.event = !exists ? G_FILE_MONITOR_EVENT_DELETED :
+                        !watch->exists ? G_FILE_MONITOR_EVENT_CREATED :
+                        G_FILE_MONITOR_EVENT_CHANGED;
+          g_array_append_val (events, event);
+
+          watch->state = state;
+          watch->exists = exists;
+        }
+    }
+
+  G_UNLOCK (watch_manager);
+
+  watch_deliver (events);
+  g_array_unref (events);
+
+  return TRUE;
+}
+
+
+/* called locked */
+static void
+watch_poll_add (SourceFileWatch *watch)
+{
+  GMainContext *context;
+
+  if (!watch_polled)
+    watch_polled = g_ptr_array_new ();
+
+  watch_poll_state (watch);
+  watch->poll_index = watch_polled->len;
+  g_ptr_array_add (watch_polled, watch);
+
+  if (!watch_poll_source)
+    {
+      context = g_main_context_ref_thread_default ();
+      watch_poll_source = g_timeout_source_new (WATCH_POLL_INTERVAL);
+      g_source_set_callback (watch_poll_source, watch_poll, NULL, NULL);
+      g_source_attach (watch_poll_source, context);
+      g_main_context_unref (context);
+    }
+}
+
+
+/* called locked */
+static void
+watch_poll_remove (SourceFileWatch *watch)
+{
+  SourceFileWatch *moved;
+
+  /* the last one takes its place */
+  g_ptr_array_remove_index_fast (watch_polled, watch->poll_index);
+  if (watch->poll_index < watch_polled->len)
+    {
+      moved = g_ptr_array_index (watch_polled, watch->poll_index);
+      moved->poll_index = watch->poll_index;
+    }
+
+  if (!watch_polled->len)
+    {
+      g_source_destroy (watch_poll_source);
+      g_source_unref (watch_poll_source);
+      watch_poll_source = NULL;
+    }
+}
+
+
+/* called locked */
+static WatchDir *
+watch_dir_get (const gchar *path)
+{
+  WatchDir *dir;
+  GFile    *gfile;
+
+  if (!watch_dirs)
+    watch_dirs = g_hash_table_new (g_str_hash, g_str_equal);
+
+  dir = g_hash_table_lookup (watch_dirs, path);
+  if (dir)
+    return dir;
+
+  dir = g_slice_new0 (WatchDir);
+  dir->path = g_strdup (path);
+  dir->files = g_hash_table_new (g_str_hash, g_str_equal);
+  g_hash_table_insert (watch_dirs, dir->path, dir);
+
+  if (watch_max_monitors < 0)
+    watch_max_monitors = watch_default_max_monitors ();
+
+  if (watch_n_monitors < (guint) watch_max_monitors)
+    {
+      gfile = g_file_new_for_path (path);
+      dir->monitor = g_file_monitor_directory (gfile, G_FILE_MONITOR_SEND_MOVED, NULL, NULL);
+      g_object_unref (gfile);
+
+      if (dir->monitor)
+        {
+          watch_n_monitors++;
+          g_signal_connect_data (dir->monitor, "changed",
+                                 G_CALLBACK (on_dir_monitor_changed), g_strdup (path),
+                                 (GClosureNotify) g_free, 0);
+        }
+    }
+
+  return dir;
+}
+
+
+/* called locked */
+static void
+watch_dir_free (WatchDir *dir)
+{
+  g_hash_table_remove (watch_dirs, dir->path);
+
+  if (dir->monitor)
+    {
+      g_signal_handlers_disconnect_matched (dir->monitor, G_SIGNAL_MATCH_FUNC, 0, 0, NULL,
+                                            on_dir_monitor_changed, NULL);
+      g_file_monitor_cancel (dir->monitor);
+      g_object_unref (dir->monitor);
+      watch_n_monitors--;
+    }
+
+  g_hash_table_destroy (dir->files);
+  g_free (dir->path);
+  g_slice_free (WatchDir, dir);
+}
+
+
+/* calls func whenever filename changes, until the watch is removed */
+SourceFileWatch *
+source_file_watch_add (const gchar         *filename,
+                       SourceFileWatchFunc  func,
+                       gpointer             user_data)
+{
+  SourceFileWatch *watch;
+  gchar           *path;
+  GList           *list;
+
+  g_return_val_if_fail (filename, NULL);
+  g_return_val_if_fail (func, NULL);
+
+  watch = g_slice_new0 (SourceFileWatch);
+  watch->filename = g_canonicalize_filename (filename, NULL);
+  watch->basename = g_path_get_basename (watch->filename);
+  watch->func = func;
+  watch->user_data = user_data;
+
+  path = g_path_get_dirname (watch->filename);
+
+  G_LOCK (watch_manager);
+
+  if (!watch_ids)
+    watch_ids = g_hash_table_new (g_int64_hash, g_int64_equal);
+  watch->id = watch_next_id++;
+  g_hash_table_insert (watch_ids, &watch->id, watch);
+
+  watch->dir = watch_dir_get (path);
+
+  list = g_hash_table_lookup (watch->dir->files, watch->basename);
+  if (list)
+    list = g_list_prepend (list, watch);
+  else
+    list = g_list_prepend (NULL, watch);
+  g_hash_table_replace (watch->dir->files, watch->basename, list);
+
+  if (!watch->dir->monitor)
+    watch_poll_add (watch);
+  else
+    {
+      watch_poll_state (watch);
+      watch->fresh = TRUE;
+    }
+
+  G_UNLOCK (watch_manager);
+
+  g_free (path);
+
+  return watch;
+}
+
+
+void
+source_file_watch_remove (SourceFileWatch *watch)
+{
+  GList *list;
+
+  if (!watch)
+    return;
+
+  G_LOCK (watch_manager);
+
+  g_hash_table_remove (watch_ids, &watch->id);
+
+  list = g_hash_table_lookup (watch->dir->files, watch->basename);
+  list = g_list_remove (list, watch);
+
+  /* the key is the basename of the first watch in the list */
+  g_hash_table_remove (watch->dir->files, watch->basename);
+  if (list)
+    g_hash_table_insert (watch->dir->files, ((SourceFileWatch *) list->data)->basename, list);
+
+  if (!watch->dir->monitor)
+    watch_poll_remove (watch);
+
+  if (!g_hash_table_size (watch->dir->files))
+    watch_dir_free (watch->dir);
+
+  G_UNLOCK (watch_manager);
+
+  g_free (watch->filename);
+  g_free (watch->basename);
+  g_slice_free (SourceFileWatch, watch);
+}
+
+
+/*
+ * Sets how many directories are watched with a file monitor before the
+ * rest are polled, 0 to poll everything. Defaults to half of the
+ * inotify watch limit. Directories already being watched or polled
+ * stay that way.
+ */
+void
+source_file_set_max_directory_watches (guint max_watches)
+{
+  G_LOCK (watch_manager);
+  watch_max_monitors = MIN (max_watches, G_MAXINT);
+  G_UNLOCK (watch_manager);
+}
+
+
+void
+source_file_get_watch_stats (guint *n_directories,
+                             guint *n_monitors,
+                             guint *n_polled_files)
+{
+  G_LOCK (watch_manager);
+
+  if (n_directories)
+    *n_directories = watch_dirs ? g_hash_table_size (watch_dirs) : 0;
+  if (n_monitors)
+    *n_monitors = watch_n_monitors;
+  if (n_polled_files)
+    *n_polled_files = watch_polled ? watch_polled->len : 0;
+
+  G_UNLOCK (watch_manager);
+}
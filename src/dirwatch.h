@@ -0,0 +1,21 @@
+#ifndef __SOURCEDIRWATCH_H__
+#define __SOURCEDIRWATCH_H__
+
+G_BEGIN_DECLS
+
+
+typedef struct _SourceFileWatch SourceFileWatch;
+
+typedef void (*SourceFileWatchFunc) (GFileMonitorEvent event,
+                                     gpointer          user_data);
+
+
+SourceFileWatch *source_file_watch_add    (const gchar         *filename,
+                                           SourceFileWatchFunc  func,
+                                           gpointer             user_data);
+void             source_file_watch_remove (SourceFileWatch     *watch);
+
+
+G_END_DECLS
+
+#endif /* __SOURCEDIRWATCH_H__ */
@@ -0,0 +1,340 @@
+#include <errno.h>
+#include <glib.h>
+#include <gio/gio.h>
+#include "sourcefile.h"
+#include "iconvcache.h"
+
+
+/*
+ * Opening an iconv descriptor loads and sets up conversion tables, which
+ * costs more than converting a small file does. Descriptors are kept per
+ * thread, keyed by the pair of charsets, and handed out again once
+ * released, reset to their initial shift state. Each thread keeps at most
+ * one idle descriptor per pair and ICONV_CACHE_SIZE in all; the rest are
+ * closed on release, and all of them when the thread exits.
+ *
+ * source_file_iconv_cache_flush() closes the calling thread's descriptors
+ * straight away. Other threads' can't be touched from outside, so they
+ * are dropped the next time those threads use the cache.
+ */
+
+
+#define ICONV_CACHE_SIZE 16
+
+
+typedef struct
+{
+  GHashTable *handles;     /* "to\nfrom" -> GIConv */
+  gint        generation;  /* of iconv_cache_generation, when last flushed */
+} IConvCache;
+
+
+typedef struct
+{
+  GObject  parent_instance;
+  GIConv   cd;
+  gchar   *to_charset;
+  gchar   *from_charset;
+} SourceFileIConvConverter;
+
+typedef struct
+{
+  GObjectClass parent_class;
+} SourceFileIConvConverterClass;
+
+
+static void        iconv_cache_free    (gpointer     data);
+static IConvCache *iconv_cache_get     (void);
+static gchar      *iconv_cache_key     (const gchar *to_charset,
+                                        const gchar *from_charset);
+static void        iconv_handle_close  (gpointer     data);
+
+static GType source_file_iconv_converter_get_type   (void);
+static void  source_file_iconv_converter_iface_init (GConverterIface *iface);
+
+
+static GPrivate iconv_cache_private = G_PRIVATE_INIT (iconv_cache_free);
+static gint     iconv_cache_generation = 0;
+static gint     iconv_cache_hits = 0;
+static gint     iconv_cache_misses = 0;
+
+
+G_DEFINE_TYPE_WITH_CODE (SourceFileIConvConverter, source_file_iconv_converter, G_TYPE_OBJECT,
+                         G_IMPLEMENT_INTERFACE (G_TYPE_CONVERTER,
+                                                source_file_iconv_converter_iface_init))
+
+
+static void
+iconv_cache_free (gpointer data)
+{
+  IConvCache *cache = data;
+
+  g_hash_table_destroy (cache->handles);
+  g_slice_free (IConvCache, cache);
+}
+
+
+/* the calling thread's cache, emptied first if it was flushed since */
+static IConvCache *
+iconv_cache_get (void)
+{
+  IConvCache *cache;
+  gint        generation;
+
+  generation = g_atomic_int_get (&iconv_cache_generation);
+  cache = g_private_get (&iconv_cache_private);
+
+  if (!cache)
+    {
+      cache = g_slice_new (IConvCache);
+      cache->handles = g_hash_table_new_full (g_str_hash, g_str_equal,
+                                              g_free, iconv_handle_close);
+      cache->generation = generation;
+      g_private_set (&iconv_cache_private, cache);
+    }
+  else if (cache->generation != generation)
+    {
+      g_hash_table_remove_all (cache->handles);
+      cache->generation = generation;
+    }
+
+  return cache;
+}
+
+
+static gchar *
+iconv_cache_key (const gchar *to_charset, const gchar *from_charset)
+{
+  return g_strconcat (to_charset, "\n", from_charset, NULL);
+}
+
+
+static void
+iconv_handle_close (gpointer data)
+{
+  g_iconv_close ((GIConv) data);
+}
+
+
+/*
+ * A descriptor converting from_charset to to_charset in its initial
+ * state, for the calling thread to use until it is released. Returns
+ * (GIConv) -1, the same as g_iconv_open(), if there's no such conversion.
+ */
+GIConv
+source_file_iconv_cache_acquire (const gchar *to_charset, const gchar *from_charset)
+{
+  IConvCache *cache;
+  gchar      *key;
+  gpointer    stored_key, cd;
+
+  cache = iconv_cache_get ();
+  key = iconv_cache_key (to_charset, from_charset);
+
+  if (g_hash_table_lookup_extended (cache->handles, key, &stored_key, &cd))
+    {
+      g_hash_table_steal (cache->handles, key);
+      g_free (stored_key);
+      g_free (key);
+      g_atomic_int_inc (&iconv_cache_hits);
+
+      g_iconv ((GIConv) cd, NULL, NULL, NULL, NULL);
+
+      return (GIConv) cd;
+    }
+
+  g_free (key);
+  g_atomic_int_inc (&iconv_cache_misses);
+
+  return g_iconv_open (to_charset, from_charset);
+}
+
+
+/* hands cd back for reuse; it may be released by any thread */
+void
+source_file_iconv_cache_release (const gchar *to_charset, const gchar *from_charset, GIConv cd)
+{
+  IConvCache *cache;
+  gchar      *key;
+
+  if (cd == (GIConv) -1)
+    return;
+
+  cache = iconv_cache_get ();
+  key = iconv_cache_key (to_charset, from_charset);
+
+  if (g_hash_table_size (cache->handles) >= ICONV_CACHE_SIZE ||
+      g_hash_table_contains (cache->handles, key))
+    {
+      g_free (key);
+      g_iconv_close (cd);
+      return;
+    }
+
+  g_hash_table_insert (cache->handles, key, cd);
+}
+
+
+/*
+ * Closes the descriptors cached by the calling thread, and those of every
+ * other thread the next time it looks at its cache. Descriptors in use
+ * are unaffected.
+ */
+void
+source_file_iconv_cache_flush (void)
+{
+  g_atomic_int_inc (&iconv_cache_generation);
+
+  /* the calling thread sees the new generation and empties its cache */
+  if (g_private_get (&iconv_cache_private))
+    iconv_cache_get ();
+}
+
+
+/* how many descriptors were reused from the cache, and how many opened */
+void
+source_file_iconv_cache_get_stats (guint *hits, guint *misses)
+{
+  if (hits)
+    *hits = g_atomic_int_get (&iconv_cache_hits);
+  if (misses)
+    *misses = g_atomic_int_get (&iconv_cache_misses);
+}
+
+
+static void
+source_file_iconv_converter_finalize (GObject *object)
+{
+  SourceFileIConvConverter *self = (SourceFileIConvConverter *) object;
+
+  source_file_iconv_cache_release (self->to_charset, self->from_charset, self->cd);
+  g_free (self->to_charset);
+  g_free (self->from_charset);
+
+  G_OBJECT_CLASS (source_file_iconv_converter_parent_class)->finalize (object);
+}
+
+
+static void
+source_file_iconv_converter_class_init (SourceFileIConvConverterClass *klass)
+{
+  G_OBJECT_CLASS (klass)->finalize = source_file_iconv_converter_finalize;
+}
+
+
+static void
+source_file_iconv_converter_init (SourceFileIConvConverter *self)
+{
+  self->cd = (GIConv) -1;
+}
+
+
+/* the same as GCharsetConverter without a fallback, which is what this
+ * replaces */
+static GConverterResult
+source_file_iconv_converter_convert (GConverter       *converter,
+                                     const void       *inbuf,
+                                     gsize             inbuf_size,
+                                     void             *outbuf,
+                                     gsize             outbuf_size,
+                                     GConverterFlags   flags,
+                                     gsize            *bytes_read,
+                                     gsize            *bytes_written,
+                                     GError          **error)
+{
+  SourceFileIConvConverter *self = (SourceFileIConvConverter *) converter;
+  gchar                    *in = (gchar *) inbuf, *out = outbuf;
+  gsize                     in_left = inbuf_size, out_left = outbuf_size, result;
+  gint                      saved_errno;
+
+  /* no more input, so only the shift state is left to write out; that
+   * call is the only one that finishes */
+  if (inbuf_size == 0 && !(flags & (G_CONVERTER_INPUT_AT_END | G_CONVERTER_FLUSH)))
+    {
+      *bytes_read = *bytes_written = 0;
+      g_set_error_literal (error, G_IO_ERROR, G_IO_ERROR_PARTIAL_INPUT,
+                           "Incomplete multibyte sequence in input");
+      return G_CONVERTER_ERROR;
+    }
+  else if (inbuf_size == 0)
+    result = g_iconv (self->cd, NULL, &in_left, &out, &out_left);
+  else
+    result = g_iconv (self->cd, &in, &in_left, &out, &out_left);
+
+  *bytes_read = in - (gchar *) inbuf;
+  *bytes_written = out - (gchar *) outbuf;
+
+  /* anything converted is reported first, the error comes again next time */
+  if (result == (gsize) -1 && *bytes_read == 0)
+    {
+      saved_errno = errno;
+
+      if (saved_errno == EINVAL)
+        g_set_error_literal (error, G_IO_ERROR, G_IO_ERROR_PARTIAL_INPUT,
+                             "Incomplete multibyte sequence in input");
+      else if (saved_errno == E2BIG)
+        g_set_error_literal (error, G_IO_ERROR, G_IO_ERROR_NO_SPACE,
+                             "Not enough space in destination");
+      else if (saved_errno == EILSEQ)
+        g_set_error_literal (error, G_IO_ERROR, G_IO_ERROR_INVALID_DATA,
+                             "Invalid byte sequence in conversion input");
+      else
+        g_set_error (error, G_IO_ERROR, g_io_error_from_errno (saved_errno),
+                     "Error during conversion: %s", g_strerror (saved_errno));
+
+      return G_CONVERTER_ERROR;
+    }
+
+  if (inbuf_size == 0 && (flags & G_CONVERTER_INPUT_AT_END))
+    return G_CONVERTER_FINISHED;
+  else if (inbuf_size == 0)
+    return G_CONVERTER_FLUSHED;
+
+  return G_CONVERTER_CONVERTED;
+}
+
+
+static void
+source_file_iconv_converter_reset (GConverter *converter)
+{
+  SourceFileIConvConverter *self = (SourceFileIConvConverter *) converter;
+
+  g_iconv (self->cd, NULL, NULL, NULL, NULL);
+}
+
+
+static void
+source_file_iconv_converter_iface_init (GConverterIface *iface)
+{
+  iface->convert = source_file_iconv_converter_convert;
+  iface->reset = source_file_iconv_converter_reset;
+}
+
+
+/*
+ * A GConverter over a cached descriptor, which goes back into the cache
+ * when the converter is finalized. Fails with G_IO_ERROR_NOT_SUPPORTED,
+ * as g_charset_converter_new() does.
+ */
+GConverter *
+source_file_iconv_converter_new (const gchar *to_charset, const gchar *from_charset, GError **error)
+{
+  SourceFileIConvConverter *converter;
+  GIConv                    cd;
+
+  cd = source_file_iconv_cache_acquire (to_charset, from_charset);
+  if (cd == (GIConv) -1)
+    {
+      g_set_error (error, G_IO_ERROR, G_IO_ERROR_NOT_SUPPORTED,
+                   "Conversion from character set '%s' to '%s' is not supported",
+                   from_charset, to_charset);
+      return NULL;
+    }
+
+  converter = g_object_new (source_file_iconv_converter_get_type (), NULL);
+  converter->cd = cd;
+  converter->to_charset = g_strdup (to_charset);
+  converter->from_charset = g_strdup (from_charset);
+
+  return G_CONVERTER (converter);
+}
@@ -0,0 +1,20 @@
+#ifndef __SOURCEICONVCACHE_H__
+#define __SOURCEICONVCACHE_H__
+
+G_BEGIN_DECLS
+
+
+GIConv      source_file_iconv_cache_acquire (const gchar  *to_charset,
+                                             const gchar  *from_charset);
+void        source_file_iconv_cache_release (const gchar  *to_charset,
+                                             const gchar  *from_charset,
+                                             GIConv        cd);
+
+GConverter *source_file_iconv_converter_new (const gchar  *to_charset,
+                                             const gchar  *from_charset,
+                                             GError      **error);
+
+
+G_END_DECLS
+
+#endif /* __SOURCEICONVCACHE_H__ */
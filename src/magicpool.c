@@ -0,0 +1,94 @@
+#include <glib.h>
+#include "sourcefile.h"
+#include "magicpool.h"
+
+
+/*
+ * Loading the compiled magic database is by far the most expensive part
+ * of guessing a MIME type, so loaded cookies are kept around and shared
+ * by all SourceFile instances. A cookie can't be used by two threads at
+ * once, so each caller gets one to itself until it is released back into
+ * the pool; the pool only ever grows to the number of concurrent users.
+ */
+
+#ifdef HAVE_MAGIC
+G_LOCK_DEFINE_STATIC (magic_pool);
+static GSList   *magic_pool = NULL;
+static gboolean  magic_pool_failed = FALSE;
+#endif
+
+
+#ifdef HAVE_MAGIC
+magic_t
+source_file_magic_pool_acquire (void)
+{
+  magic_t cookie = NULL;
+
+  G_LOCK (magic_pool);
+  if (magic_pool_failed)
+    {
+      G_UNLOCK (magic_pool);
+      return NULL;
+    }
+  if (magic_pool)
+    {
+      cookie = magic_pool->data;
+      magic_pool = g_slist_delete_link (magic_pool, magic_pool);
+    }
+  G_UNLOCK (magic_pool);
+
+  if (cookie)
+    return cookie;
+
+  cookie = magic_open (MAGIC_MIME_TYPE);
+  if (!cookie)
+    return NULL;
+
+  if (magic_load (cookie, NULL) != 0)
+    {
+      g_warning ("Failed to load magic database: %s", magic_error (cookie));
+      magic_close (cookie);
+      /* don't keep hitting the disk for a database that isn't there */
+      G_LOCK (magic_pool);
+      magic_pool_failed = TRUE;
+      G_UNLOCK (magic_pool);
+      return NULL;
+    }
+
+  return cookie;
+}
+
+
+void
+source_file_magic_pool_release (magic_t cookie)
+{
+  if (!cookie)
+    return;
+
+  G_LOCK (magic_pool);
+  magic_pool = g_slist_prepend (magic_pool, cookie);
+  G_UNLOCK (magic_pool);
+}
+#endif
+
+
+void
+source_file_magic_pool_clear (void)
+{
+#ifdef HAVE_MAGIC
+  GSList *pool, *iter;
+
+  /* cookies currently in use are unaffected, they go back into the
+   * (now empty) pool when released */
+  G_LOCK (magic_pool);
+  pool = magic_pool;
+  magic_pool = NULL;
+  magic_pool_failed = FALSE;
+  G_UNLOCK (magic_pool);
+
+  for (iter = pool; iter; iter = iter->next)
+    magic_close (iter->data);
+
+  g_slist_free (pool);
+#endif
+}
@@ -0,0 +1,19 @@
+#ifndef __SOURCEMAGICPOOL_H__
+#define __SOURCEMAGICPOOL_H__
+
+#ifdef HAVE_MAGIC
+#  include <magic.h>
+#endif
+
+G_BEGIN_DECLS
+
+
+#ifdef HAVE_MAGIC
+magic_t source_file_magic_pool_acquire (void);
+void    source_file_magic_pool_release (magic_t cookie);
+#endif
+
+
+G_END_DECLS
+
+#endif /* __SOURCEMAGICPOOL_H__ */
@@ -0,0 +1,176 @@
+#include <string.h>
+#include <glib.h>
+#include "charsets.h"
+#include "modeline.h"
+
+#ifdef __SSE2__
+#  include <emmintrin.h>
+#endif
+
+
+/*
+ * Finds charset declarations without a regular expression or any
+ * allocation. Every declaration has a keyword, a ':' or '=' and then the
+ * name, so only the separators are looked for, 16 bytes at a time where
+ * SSE2 is there, and the keyword is matched backwards from each:
+ *
+ *   -*- mode: c; coding: utf-8 -*-          Emacs, Python (PEP 263)
+ *   vim: set fileencoding=latin1 :          Vim, also fenc=
+ *   <?xml version="1.0" encoding="UTF-8"?>  XML
+ *   <meta charset="utf-8">                  HTML, also content="...; charset="
+ *
+ * "coding" also covers "encoding" and "fileencoding". Names are checked
+ * against the charset table straight away, and whatever isn't a charset
+ * is skipped so a later declaration still gets a chance.
+ */
+
+
+#define DECLARATION_MAX_NAME   64
+#define DECLARATION_MAX_SPACES 8
+
+
+static inline gboolean
+is_blank (gchar c)
+{
+  return c == ' ' || c == '\t';
+}
+
+
+static inline gboolean
+is_name_char (gchar c)
+{
+  return g_ascii_isalnum (c) ||
+         c == '-' || c == '_' || c == '.' || c == ':' || c == '+' || c == '(' || c == ')';
+}
+
+
+/* whether one of the keywords ends right before sep, give or take blanks */
+static inline gboolean
+match_keyword (const gchar *buffer, const gchar *sep)
+{
+  const gchar *end = sep, *keyword;
+  gsize        n;
+
+  for (n = 0; end > buffer && is_blank (end[-1]) && n < DECLARATION_MAX_SPACES; n++)
+    end--;
+
+  if (end == buffer)
+    return FALSE;
+
+  /* most separators are assignments and the like, and they're done with
+   * here: no keyword ends in their last letter */
+  switch (end[-1] | 0x20)
+    {
+    case 'g': keyword = "coding";   break;
+    case 't': keyword = "charset";  break;
+    case 'e': keyword = "codepage"; break;
+    case 'c': keyword = "fenc";     break;
+    default:  return FALSE;
+    }
+
+  n = strlen (keyword);
+
+  return (gsize) (end - buffer) >= n &&
+         g_ascii_strncasecmp (end - n, keyword, n) == 0;
+}
+
+
+/* looks name up, and again without an Emacs end-of-line suffix */
+static const SourceFileCharset *
+lookup_name (gchar *name, gsize length)
+{
+  static const gchar *suffixes[] = { "-unix", "-dos", "-mac" };
+  const SourceFileCharset *charset;
+  gsize                    i, n;
+
+  charset = source_file_lookup_charset (name);
+
+  for (i = 0; !charset && i < G_N_ELEMENTS (suffixes); i++)
+    {
+      n = strlen (suffixes[i]);
+      if (length > n && g_ascii_strcasecmp (name + length - n, suffixes[i]) == 0)
+        {
+          name[length - n] = '\0';
+          charset = source_file_lookup_charset (name);
+        }
+    }
+
+  return charset;
+}
+
+
+/* the name after sep, if it is a charset */
+static const SourceFileCharset *
+match_name (const gchar *sep, const gchar *end)
+{
+  gchar        name[DECLARATION_MAX_NAME];
+  const gchar *p = sep + 1, *start;
+  gsize        length;
+
+  while (p < end && is_blank (*p))
+    p++;
+  if (p < end && (*p == '"' || *p == '\''))
+    p++;
+  while (p < end && is_blank (*p))
+    p++;
+
+  for (start = p; p < end && is_name_char (*p); p++)
+    ;
+
+  /* Vim modelines end in ':', sentences in '.' */
+  while (p > start && (p[-1] == ':' || p[-1] == '.'))
+    p--;
+
+  length = p - start;
+  if (length < 2 || length >= DECLARATION_MAX_NAME)
+    return NULL;
+
+  memcpy (name, start, length);
+  name[length] = '\0';
+
+  return lookup_name (name, length);
+}
+
+
+const SourceFileCharset *
+source_file_scan_declaration (const gchar *buffer, gsize length)
+{
+  const gchar             *end = buffer + length;
+  const gchar             *p = buffer;
+  const SourceFileCharset *charset;
+
+  if (!buffer || !length)
+    return NULL;
+
+#ifdef __SSE2__
+  {
+    const __m128i colon = _mm_set1_epi8 (':');
+    const __m128i equals = _mm_set1_epi8 ('=');
+    __m128i       input;
+    guint         mask;
+
+    /* separators come every few bytes in code, so the mask of a whole
+     * block is gone through rather than searching again after each */
+    for (; end - p >= 16; p += 16)
+      {
+        input = _mm_loadu_si128 ((const __m128i *) p);
+        mask = _mm_movemask_epi8 (_mm_or_si128 (_mm_cmpeq_epi8 (input, colon),
+                                                _mm_cmpeq_epi8 (input, equals)));
+        for (; mask; mask &= mask - 1)
+          {
+            const gchar *sep = p + __builtin_ctz (mask);
+
+            if (match_keyword (buffer, sep) && (charset = match_name (sep, end)))
+              return charset;
+          }
+      }
+  }
+#endif
+
+  for (; p < end; p++)
+    if ((*p == ':' || *p == '=') &&
+        match_keyword (buffer, p) && (charset = match_name (p, end)))
+      return charset;
+
+  return NULL;
+}
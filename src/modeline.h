@@ -0,0 +1,13 @@
+#ifndef __SOURCEMODELINE_H__
+#define __SOURCEMODELINE_H__
+
+G_BEGIN_DECLS
+
+
+const SourceFileCharset *source_file_scan_declaration (const gchar *buffer,
+                                                       gsize        length);
+
+
+G_END_DECLS
+
+#endif /* __SOURCEMODELINE_H__ */
@@ -0,0 +1,771 @@
+#include <errno.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <glib.h>
+#include <glib/gstdio.h>
+#include <gio/gio.h>
+#include "sourcefile.h"
+#include "charsets.h"
+#include "pagedfile.h"
+#include "codec.h"
+#include "iconvcache.h"
+#include "utf8scan.h"
+
+
+/*
+ * Large files are read SOURCE_FILE_PAGE_SIZE raw bytes at a time. Pages
+ * are indexed in order the first time anything at or past them is asked
+ * for, recording where each starts in the file and in the decoded text
+ * and how many line breaks come before it, so seeking never has to look
+ * at more than one page. Decoded pages are kept in an LRU cache bounded
+ * by the memory budget. Every page ends on a character boundary and is
+ * decoded on its own, which is why only stateless charsets can be paged.
+ */
+
+
+typedef struct
+{
+  guint64  raw_offset;
+  guint64  offset;        /* in the decoded text */
+  guint64  lines_before;  /* line breaks before the page */
+  guint32  raw_length;
+  guint32  length;
+  guint32  breaks;
+  gboolean ends_with_cr;  /* the next page may start with its "\n" */
+} PagerPage;
+
+
+typedef struct
+{
+  guint  index;
+  gchar *data;
+  gsize  length;
+  GList  link;
+} PagerEntry;
+
+
+struct _SourceFilePager
+{
+  gint        fd;
+  GIConv      cd;          /* (GIConv) -1 if already UTF-8 or decode is set */
+  gchar      *charset;     /* what cd converts from */
+  SourceFileCodecFunc decode;  /* used instead of cd if set */
+  gconstpointer       codec;
+  guint64     raw_start;   /* past the byte order mark, if any */
+  guint64     raw_end;
+  gchar      *raw;
+  GArray     *pages;
+  gboolean    indexed;
+  GHashTable *cache;       /* page index -> PagerEntry */
+  GQueue      lru;         /* most recently used first */
+  gsize       cached;
+  gsize       budget;
+};
+
+
+static inline PagerPage *
+pager_page (SourceFilePager *pager, guint index)
+{
+  return &g_array_index (pager->pages, PagerPage, index);
+}
+
+
+/* counts line breaks the same way the line index does, "\r\n" being one */
+static guint32
+pager_count_breaks (const gchar *data, gsize length, gboolean prev_cr)
+{
+  guint32 breaks = 0;
+  gsize   i = 0;
+
+  if (prev_cr && length && data[0] == '\n')
+    i = 1;
+
+  while (i < length)
+    {
+      i += source_file_find_line_break (data + i, length - i);
+      if (i == length)
+        break;
+
+      if (data[i] == '\r' && i + 1 < length && data[i + 1] == '\n')
+        i++;
+      i++;
+      breaks++;
+    }
+
+  return breaks;
+}
+
+
+static gboolean
+pager_pread (SourceFilePager *pager, guint64 offset, gsize length, gsize *n_read, GError **error)
+{
+  gssize n;
+
+  *n_read = 0;
+
+  while (*n_read < length)
+    {
+      n = pread (pager->fd, pager->raw + *n_read, length - *n_read, offset + *n_read);
+      if (n < 0 && errno == EINTR)
+        continue;
+      if (n < 0)
+        {
+          g_set_error (error, G_IO_ERROR, g_io_error_from_errno (errno),
+                       "Failed to read file: %s", g_strerror (errno));
+          return FALSE;
+        }
+      if (n == 0)
+        break;
+      *n_read += n;
+    }
+
+  return TRUE;
+}
+
+
+/*
+ * Reads and decodes up to length raw bytes at offset. Unless exact is
+ * set or the end of the file was reached, a character cut in half at the
+ * end is left out of consumed, for the next page to start with.
+ */
+static gboolean
+pager_decode (SourceFilePager  *pager,
+              guint64           offset,
+              gsize             length,
+              gboolean          exact,
+              gchar           **data,
+              gsize            *data_length,
+              gsize            *consumed,
+              GError          **error)
+{
+  gsize  n_read, tail, in_left, out_left, alloc;
+  gchar *in, *out;
+
+  if (!pager_pread (pager, offset, length, &n_read, error))
+    return FALSE;
+
+  exact = exact || offset + n_read >= pager->raw_end;
+
+  /* no built-in codec makes more than three bytes of one */
+  if (pager->decode)
+    {
+      SourceFileCodecStatus status;
+
+      *data = g_malloc (3 * n_read + 1);
+      status = pager->decode (pager->codec, pager->raw, n_read, *data, 3 * n_read,
+                              consumed, data_length);
+      if (!(status == SOURCE_FILE_CODEC_DONE ||
+            (status == SOURCE_FILE_CODEC_PARTIAL && !exact)) ||
+          (!*consumed && n_read))
+        {
+          g_free (*data);
+          goto illegal;
+        }
+      *data = g_realloc (*data, MAX (*data_length, 1));
+      return TRUE;
+    }
+
+  if (pager->cd == (GIConv) -1)
+    {
+      tail = exact ? 0 : source_file_utf8_incomplete_tail (pager->raw, n_read);
+      if (!source_file_utf8_validate (pager->raw, n_read - tail))
+        goto illegal;
+
+      *data = g_memdup2 (pager->raw, n_read - tail);
+      *data_length = n_read - tail;
+      *consumed = n_read - tail;
+      return TRUE;
+    }
+
+  g_iconv (pager->cd, NULL, NULL, NULL, NULL);
+
+  alloc = 2 * n_read + 16;
+  *data = g_malloc (alloc);
+  in = pager->raw;
+  in_left = n_read;
+  out = *data;
+  out_left = alloc;
+
+  while (in_left > 0 &&
+         g_iconv (pager->cd, &in, &in_left, &out, &out_left) == (gsize) -1)
+    {
+      if (errno == E2BIG)
+        {
+          gsize used = out - *data;
+
+          alloc *= 2;
+          *data = g_realloc (*data, alloc);
+          out = *data + used;
+          out_left = alloc - used;
+        }
+      else if (errno == EINVAL && !exact)
+        break;
+      else
+        {
+          g_free (*data);
+          goto illegal;
+        }
+    }
+
+  *data_length = out - *data;
+  *consumed = n_read - in_left;
+
+  if (!*consumed && n_read)
+    {
+      g_free (*data);
+      goto illegal;
+    }
+
+  return TRUE;
+
+illegal:
+  g_set_error (error, G_CONVERT_ERROR, G_CONVERT_ERROR_ILLEGAL_SEQUENCE,
+               "Invalid byte sequence in conversion input");
+  return FALSE;
+}
+
+
+static void
+pager_entry_free (PagerEntry *entry)
+{
+  g_free (entry->data);
+  g_slice_free (PagerEntry, entry);
+}
+
+
+/* drops the least recently used pages until within budget, but the last one */
+static void
+pager_evict (SourceFilePager *pager)
+{
+  PagerEntry *entry;
+
+  while (pager->cached > pager->budget && pager->lru.length > 1)
+    {
+      entry = g_queue_pop_tail_link (&pager->lru)->data;
+      g_hash_table_remove (pager->cache, GUINT_TO_POINTER (entry->index));
+      pager->cached -= entry->length;
+      pager_entry_free (entry);
+    }
+}
+
+
+static void
+pager_cache_insert (SourceFilePager *pager, guint index, gchar *data, gsize length)
+{
+  PagerEntry *entry;
+
+  entry = g_slice_new0 (PagerEntry);
+  entry->index = index;
+  entry->data = data;
+  entry->length = length;
+  entry->link.data = entry;
+
+  g_hash_table_insert (pager->cache, GUINT_TO_POINTER (index), entry);
+  g_queue_push_head_link (&pager->lru, &entry->link);
+  pager->cached += length;
+
+  pager_evict (pager);
+}
+
+
+/* indexes the page after the last one indexed, if there is one */
+static gboolean
+pager_index_next (SourceFilePager *pager, GError **error)
+{
+  PagerPage  page = { 0, };
+  PagerPage *prev = NULL;
+  gchar     *data;
+  gsize      length, consumed;
+
+  if (pager->pages->len)
+    {
+      prev = pager_page (pager, pager->pages->len - 1);
+      page.raw_offset = prev->raw_offset + prev->raw_length;
+      page.offset = prev->offset + prev->length;
+      page.lines_before = prev->lines_before + prev->breaks;
+    }
+  else
+    page.raw_offset = pager->raw_start;
+
+  if (page.raw_offset >= pager->raw_end)
+    {
+      pager->indexed = TRUE;
+      return TRUE;
+    }
+
+  if (!pager_decode (pager, page.raw_offset,
+                     MIN (SOURCE_FILE_PAGE_SIZE, pager->raw_end - page.raw_offset),
+                     FALSE, &data, &length, &consumed, error))
+    return FALSE;
+
+  page.raw_length = consumed;
+  page.length = length;
+  page.breaks = pager_count_breaks (data, length, prev && prev->ends_with_cr);
+  page.ends_with_cr = length && data[length - 1] == '\r';
+
+  g_array_append_val (pager->pages, page);
+  pager_cache_insert (pager, pager->pages->len - 1, data, length);
+
+  if (page.raw_offset + consumed >= pager->raw_end)
+    pager->indexed = TRUE;
+
+  return TRUE;
+}
+
+
+/* the decoded page, valid until the next page is asked for */
+static const gchar *
+pager_get_page (SourceFilePager *pager, guint index, GError **error)
+{
+  PagerEntry *entry;
+  PagerPage  *page;
+  gchar      *data;
+  gsize       length, consumed;
+
+  entry = g_hash_table_lookup (pager->cache, GUINT_TO_POINTER (index));
+  if (entry)
+    {
+      g_queue_unlink (&pager->lru, &entry->link);
+      g_queue_push_head_link (&pager->lru, &entry->link);
+      return entry->data;
+    }
+
+  page = pager_page (pager, index);
+  if (!pager_decode (pager, page->raw_offset, page->raw_length, TRUE,
+                     &data, &length, &consumed, error))
+    return NULL;
+
+  /* changed underneath us */
+  if (consumed != page->raw_length || length != page->length)
+    {
+      g_free (data);
+      g_set_error (error, G_IO_ERROR, G_IO_ERROR_FAILED,
+                   "File changed while being paged");
+      return NULL;
+    }
+
+  pager_cache_insert (pager, index, data, length);
+
+  return data;
+}
+
+
+/* the page holding offset, or pages->len if it's past the end */
+static gboolean
+pager_find_offset (SourceFilePager *pager, guint64 offset, guint *index, GError **error)
+{
+  PagerPage *last;
+  guint      lo = 0, hi, mid;
+
+  for (;;)
+    {
+      last = pager->pages->len ? pager_page (pager, pager->pages->len - 1) : NULL;
+      if (pager->indexed || (last && offset < last->offset + last->length))
+        break;
+      if (!pager_index_next (pager, error))
+        return FALSE;
+    }
+
+  if (!last || offset >= last->offset + last->length)
+    {
+      *index = pager->pages->len;
+      return TRUE;
+    }
+
+  /* the last page starting at or before offset */
+  hi = pager->pages->len;
+  while (hi - lo > 1)
+    {
+      mid = lo + (hi - lo) / 2;
+      if (pager_page (pager, mid)->offset <= offset)
+        lo = mid;
+      else
+        hi = mid;
+    }
+
+  *index = lo;
+
+  return TRUE;
+}
+
+
+SourceFilePager *
+source_file_pager_new (const gchar  *filename,
+                       const gchar  *charset,
+                       gsize         budget,
+                       GError      **error)
+{
+  SourceFilePager *pager;
+  GStatBuf         st;
+  guchar           bom[4] = { 0, };
+  gchar           *explicit = NULL;
+  gint             fd;
+
+  fd = g_open (filename, O_RDONLY, 0);
+  if (fd < 0 || fstat (fd, &st) != 0)
+    {
+      gint saved_errno = errno;
+
+      g_set_error (error, G_IO_ERROR, g_io_error_from_errno (saved_errno),
+                   "Failed to open file '%s': %s", filename, g_strerror (saved_errno));
+      if (fd >= 0)
+        close (fd);
+      return NULL;
+    }
+
+  pager = g_slice_new0 (SourceFilePager);
+  pager->fd = fd;
+  pager->cd = (GIConv) -1;
+  pager->raw_end = st.st_size;
+  pager->budget = budget;
+  pager->raw = g_malloc (SOURCE_FILE_PAGE_SIZE);
+  pager->pages = g_array_new (FALSE, FALSE, sizeof (PagerPage));
+  pager->cache = g_hash_table_new (NULL, NULL);
+  g_queue_init (&pager->lru);
+
+  /* UTF-16 and UTF-32 only need their byte order pinned down */
+  if (charset && !source_file_charset_is_stateless (charset))
+    {
+      if (pread (fd, bom, sizeof (bom), 0) < 0)
+        memset (bom, 0, sizeof (bom));
+
+      if (g_ascii_strcasecmp (charset, "UTF-32") == 0 &&
+          memcmp (bom, "\xff\xfe\x00\x00", 4) == 0)
+        explicit = g_strdup ("UTF-32LE"), pager->raw_start = 4;
+      else if (g_ascii_strcasecmp (charset, "UTF-32") == 0 &&
+               memcmp (bom, "\x00\x00\xfe\xff", 4) == 0)
+        explicit = g_strdup ("UTF-32BE"), pager->raw_start = 4;
+      else if (g_ascii_strcasecmp (charset, "UTF-16") == 0 &&
+               memcmp (bom, "\xff\xfe", 2) == 0)
+        explicit = g_strdup ("UTF-16LE"), pager->raw_start = 2;
+      else if (g_ascii_strcasecmp (charset, "UTF-16") == 0 &&
+               memcmp (bom, "\xfe\xff", 2) == 0)
+        explicit = g_strdup ("UTF-16BE"), pager->raw_start = 2;
+      else
+        {
+          g_set_error (error, G_IO_ERROR, G_IO_ERROR_NOT_SUPPORTED,
+                       "Files in charset '%s' can't be paged", charset);
+          source_file_pager_free (pager);
+          return NULL;
+        }
+
+      charset = explicit;
+    }
+
+  if (charset && !source_file_codec_lookup ("UTF-8", charset, &pager->decode, &pager->codec))
+    {
+      pager->charset = g_strdup (source_file_charset_iconv_name (charset));
+      pager->cd = source_file_iconv_cache_acquire ("UTF-8", pager->charset);
+      if (pager->cd == (GIConv) -1)
+        {
+          g_set_error (error, G_CONVERT_ERROR, G_CONVERT_ERROR_NO_CONVERSION,
+                       "Conversion from character set '%s' to 'UTF-8' is not supported",
+                       charset);
+          g_free (explicit);
+          source_file_pager_free (pager);
+          return NULL;
+        }
+    }
+
+  g_free (explicit);
+
+  return pager;
+}
+
+
+void
+source_file_pager_free (SourceFilePager *pager)
+{
+  GList *l;
+
+  if (!pager)
+    return;
+
+  for (l = pager->lru.head; l; )
+    {
+      PagerEntry *entry = l->data;
+
+      l = l->next;
+      pager_entry_free (entry);
+    }
+
+  g_hash_table_unref (pager->cache);
+  g_array_unref (pager->pages);
+  g_free (pager->raw);
+
+  source_file_iconv_cache_release ("UTF-8", pager->charset, pager->cd);
+  g_free (pager->charset);
+  close (pager->fd);
+
+  g_slice_free (SourceFilePager, pager);
+}
+
+
+void
+source_file_pager_set_budget (SourceFilePager *pager, gsize budget)
+{
+  pager->budget = budget;
+  pager_evict (pager);
+}
+
+
+/* appends up to length bytes of decoded text at offset to dest */
+gboolean
+source_file_pager_read (SourceFilePager  *pager,
+                        guint64           offset,
+                        gsize             length,
+                        GString          *dest,
+                        GError          **error)
+{
+  const gchar *data;
+  PagerPage   *page;
+  guint        index;
+  gsize        n;
+
+  while (length > 0)
+    {
+      if (!pager_find_offset (pager, offset, &index, error))
+        return FALSE;
+      if (index == pager->pages->len)
+        break;
+
+      data = pager_get_page (pager, index, error);
+      if (!data)
+        return FALSE;
+
+      page = pager_page (pager, index);
+      n = MIN (length, page->offset + page->length - offset);
+      g_string_append_len (dest, data + (offset - page->offset), n);
+      offset += n;
+      length -= n;
+    }
+
+  return TRUE;
+}
+
+
+/*
+ * Finds where line starts in the decoded text. Returns FALSE without
+ * setting error if there's no such line.
+ */
+gboolean
+source_file_pager_line_offset (SourceFilePager  *pager,
+                               guint64           line,
+                               guint64          *offset,
+                               GError          **error)
+{
+  const gchar *data;
+  PagerPage   *page, *last;
+  guint        lo = 0, hi, mid, index;
+  guint64      k;
+  gsize        i = 0;
+
+  if (line == 0)
+    {
+      *offset = 0;
+      return TRUE;
+    }
+
+  for (;;)
+    {
+      last = pager->pages->len ? pager_page (pager, pager->pages->len - 1) : NULL;
+      if (pager->indexed || (last && line <= last->lines_before + last->breaks))
+        break;
+      if (!pager_index_next (pager, error))
+        return FALSE;
+    }
+
+  if (!last || line > last->lines_before + last->breaks)
+    return FALSE;
+
+  /* the last page with fewer than line breaks before it */
+  hi = pager->pages->len;
+  while (hi - lo > 1)
+    {
+      mid = lo + (hi - lo) / 2;
+      if (pager_page (pager, mid)->lines_before < line)
+        lo = mid;
+      else
+        hi = mid;
+    }
+  index = lo;
+
+  data = pager_get_page (pager, index, error);
+  if (!data)
+    return FALSE;
+
+  page = pager_page (pager, index);
+  k = line - page->lines_before;
+
+  if (index > 0 && pager_page (pager, index - 1)->ends_with_cr &&
+      page->length && data[0] == '\n')
+    i = 1;
+
+  while (k > 0)
+    {
+      i += source_file_find_line_break (data + i, page->length - i);
+      if (data[i] == '\r' && i + 1 < page->length && data[i + 1] == '\n')
+        i++;
+      i++;
+      k--;
+    }
+
+  *offset = page->offset + i;
+
+  /* a "\r\n" split between this page and the next */
+  if (i == page->length && page->ends_with_cr)
+    {
+      GString *next = g_string_new (NULL);
+
+      if (!source_file_pager_read (pager, *offset, 1, next, error))
+        {
+          g_string_free (next, TRUE);
+          return FALSE;
+        }
+      if (next->len && next->str[0] == '\n')
+        (*offset)++;
+      g_string_free (next, TRUE);
+    }
+
+  return TRUE;
+}
+
+
+/*
+ * Appends up to n_lines lines from first on to lines, as GStrings without
+ * their line breaks. Only the pages they are in are read.
+ */
+gboolean
+source_file_pager_read_lines (SourceFilePager  *pager,
+                              guint64           first,
+                              guint             n_lines,
+                              GPtrArray        *lines,
+                              GError          **error)
+{
+  const gchar *data;
+  PagerPage   *page;
+  GString     *line;
+  GError      *tmp_error = NULL;
+  guint64      offset;
+  guint        index, count = 0;
+  gsize        i, j;
+  gboolean     skip_lf = FALSE;
+
+  if (!n_lines)
+    return TRUE;
+
+  if (!source_file_pager_line_offset (pager, first, &offset, &tmp_error))
+    {
+      if (!tmp_error)
+        return TRUE;
+      g_propagate_error (error, tmp_error);
+      return FALSE;
+    }
+
+  line = g_string_new (NULL);
+
+  while (count < n_lines)
+    {
+      if (!pager_find_offset (pager, offset, &index, error))
+        goto failed;
+
+      /* the last line has no break to end it */
+      if (index == pager->pages->len)
+        {
+          g_ptr_array_add (lines, line);
+          return TRUE;
+        }
+
+      data = pager_get_page (pager, index, error);
+      if (!data)
+        goto failed;
+
+      page = pager_page (pager, index);
+      i = offset - page->offset;
+
+      if (skip_lf && i < page->length && data[i] == '\n')
+        i++;
+      skip_lf = FALSE;
+
+      while (i < page->length && count < n_lines)
+        {
+          j = i + source_file_find_line_break (data + i, page->length - i);
+          g_string_append_len (line, data + i, j - i);
+          i = j;
+          if (j == page->length)
+            break;
+
+          g_ptr_array_add (lines, line);
+          line = g_string_new (NULL);
+          count++;
+
+          if (data[j] == '\r')
+            {
+              if (j + 1 == page->length)
+                skip_lf = TRUE;
+              else if (data[j + 1] == '\n')
+                j++;
+            }
+          i = j + 1;
+        }
+
+      offset = page->offset + i;
+    }
+
+  g_string_free (line, TRUE);
+
+  return TRUE;
+
+failed:
+  g_string_free (line, TRUE);
+  return FALSE;
+}
+
+
+static void
+pager_index_all (SourceFilePager *pager)
+{
+  GError *error = NULL;
+
+  while (!pager->indexed)
+    if (!pager_index_next (pager, &error))
+      {
+        g_warning ("Failed to index file: %s", error->message);
+        g_error_free (error);
+        break;
+      }
+}
+
+
+/* the decoded length, which takes reading the whole file the first time */
+guint64
+source_file_pager_get_length (SourceFilePager *pager)
+{
+  PagerPage *last;
+
+  pager_index_all (pager);
+
+  if (!pager->pages->len)
+    return 0;
+
+  last = pager_page (pager, pager->pages->len - 1);
+
+  return last->offset + last->length;
+}
+
+
+guint64
+source_file_pager_get_line_count (SourceFilePager *pager)
+{
+  PagerPage *last;
+
+  pager_index_all (pager);
+
+  if (!pager->pages->len)
+    return 1;
+
+  last = pager_page (pager, pager->pages->len - 1);
+
+  return last->lines_before + last->breaks + 1;
+}
@@ -0,0 +1,40 @@
+#ifndef __SOURCEPAGEDFILE_H__
+#define __SOURCEPAGEDFILE_H__
+
+G_BEGIN_DECLS
+
+
+typedef struct _SourceFilePager SourceFilePager;
+
+
+SourceFilePager *source_file_pager_new            (const gchar      *filename,
+                                                   const gchar      *charset,
+                                                   gsize             budget,
+                                                   GError          **error);
+void             source_file_pager_free           (SourceFilePager  *pager);
+
+void             source_file_pager_set_budget     (SourceFilePager  *pager,
+                                                   gsize             budget);
+
+gboolean         source_file_pager_read           (SourceFilePager  *pager,
+                                                   guint64           offset,
+                                                   gsize             length,
+                                                   GString          *dest,
+                                                   GError          **error);
+gboolean         source_file_pager_line_offset    (SourceFilePager  *pager,
+                                                   guint64           line,
+                                                   guint64          *offset,
+                                                   GError          **error);
+gboolean         source_file_pager_read_lines     (SourceFilePager  *pager,
+                                                   guint64           first,
+                                                   guint             n_lines,
+                                                   GPtrArray        *lines,
+                                                   GError          **error);
+
+guint64          source_file_pager_get_length     (SourceFilePager  *pager);
+guint64          source_file_pager_get_line_count (SourceFilePager  *pager);
+
+
+G_END_DECLS
+
+#endif /* __SOURCEPAGEDFILE_H__ */
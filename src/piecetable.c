@@ -0,0 +1,397 @@
+#include <string.h>
+#include <glib.h>
+#include "piecetable.h"
+
+
+/*
+ * A piece table: the contents are a sequence of pieces, each a span of
+ * either the original (never modified) text or of an append-only buffer
+ * holding everything inserted since. The pieces are kept in a treap
+ * ordered by position and annotated with subtree lengths, so finding
+ * an offset, splitting a piece and joining the halves back together are
+ * all O(log n) in the number of pieces, and an edit never touches more
+ * text than it inserts.
+ */
+
+
+typedef struct _Piece Piece;
+
+struct _Piece
+{
+  Piece    *left;
+  Piece    *right;
+  gsize     start;     /* into the original or the added text */
+  gsize     length;
+  gsize     total;     /* length of the whole subtree */
+  guint32   priority;
+  gboolean  added;
+};
+
+
+struct _SourceFilePieceTable
+{
+  Piece          *root;
+  const gchar    *original;
+  GDestroyNotify  destroy;
+  gpointer        destroy_data;
+  GString        *added;
+  guint32         seed;
+};
+
+
+static inline gsize
+piece_total (Piece *piece)
+{
+  return piece ? piece->total : 0;
+}
+
+
+static inline void
+piece_update (Piece *piece)
+{
+  piece->total = piece_total (piece->left) + piece->length + piece_total (piece->right);
+}
+
+
+static guint32
+piece_table_random (SourceFilePieceTable *table)
+{
+  /* xorshift32, plenty for balancing and needs no locking */
+  table->seed ^= table->seed << 13;
+  table->seed ^= table->seed >> 17;
+  table->seed ^= table->seed << 5;
+  return table->seed;
+}
+
+
+static Piece *
+piece_new (SourceFilePieceTable *table, gboolean added, gsize start, gsize length)
+{
+  Piece *piece;
+
+  piece = g_slice_new0 (Piece);
+  piece->added = added;
+  piece->start = start;
+  piece->length = length;
+  piece->total = length;
+  piece->priority = piece_table_random (table);
+
+  return piece;
+}
+
+
+static void
+piece_free_tree (Piece *piece)
+{
+  while (piece)
+    {
+      Piece *right = piece->right;
+
+      piece_free_tree (piece->left);
+      g_slice_free (Piece, piece);
+      piece = right;
+    }
+}
+
+
+static Piece *
+piece_merge (Piece *left, Piece *right)
+{
+  if (!left)
+    return right;
+  if (!right)
+    return left;
+
+  if (left->priority >= right->priority)
+    {
+      left->right = piece_merge (left->right, right);
+      piece_update (left);
+      return left;
+    }
+  else
+    {
+      right->left = piece_merge (left, right->left);
+      piece_update (right);
+      return right;
+    }
+}
+
+
+/* splits piece so that *left holds exactly the first offset bytes */
+static void
+piece_split (SourceFilePieceTable  *table,
+             Piece                 *piece,
+             gsize                  offset,
+             Piece                **left,
+             Piece                **right)
+{
+  gsize left_total;
+
+  if (!piece)
+    {
+      *left = *right = NULL;
+      return;
+    }
+
+  left_total = piece_total (piece->left);
+
+  if (offset <= left_total)
+    {
+      piece_split (table, piece->left, offset, left, &piece->left);
+      piece_update (piece);
+      *right = piece;
+    }
+  else if (offset >= left_total + piece->length)
+    {
+      piece_split (table, piece->right, offset - left_total - piece->length,
+                   &piece->right, right);
+      piece_update (piece);
+      *left = piece;
+    }
+  else
+    {
+      gsize  n = offset - left_total;
+      Piece *tail;
+
+      /* same priority as the piece it came from keeps the heap order */
+      tail = piece_new (table, piece->added, piece->start + n, piece->length - n);
+      tail->priority = piece->priority;
+      tail->right = piece->right;
+      piece_update (tail);
+
+      piece->length = n;
+      piece->right = NULL;
+      piece_update (piece);
+
+      *left = piece;
+      *right = tail;
+    }
+}
+
+
+/* if the last piece ends where the added text does, grow it by n */
+static gboolean
+piece_extend_last (SourceFilePieceTable *table, Piece *piece, gsize n)
+{
+  if (!piece)
+    return FALSE;
+
+  if (piece->right)
+    {
+      if (!piece_extend_last (table, piece->right, n))
+        return FALSE;
+    }
+  else if (!piece->added || piece->start + piece->length != table->added->len - n)
+    return FALSE;
+  else
+    piece->length += n;
+
+  piece->total += n;
+  return TRUE;
+}
+
+
+static gchar *
+piece_copy_tree (SourceFilePieceTable *table, Piece *piece, gchar *dest)
+{
+  while (piece)
+    {
+      dest = piece_copy_tree (table, piece->left, dest);
+      memcpy (dest,
+              (piece->added ? table->added->str : table->original) + piece->start,
+              piece->length);
+      dest += piece->length;
+      piece = piece->right;
+    }
+
+  return dest;
+}
+
+
+/*
+ * Creates a table over the length bytes at original, which must stay
+ * valid and unchanged until destroy is called with destroy_data.
+ */
+SourceFilePieceTable *
+source_file_piece_table_new (const gchar    *original,
+                             gsize           length,
+                             GDestroyNotify  destroy,
+                             gpointer        destroy_data)
+{
+  SourceFilePieceTable *table;
+
+  table = g_slice_new0 (SourceFilePieceTable);
+  table->added = g_string_new (NULL);
+  table->seed = g_random_int () | 1;
+
+  source_file_piece_table_rebase (table, original, destroy, destroy_data);
+  if (length)
+    table->root = piece_new (table, FALSE, 0, length);
+
+  return table;
+}
+
+
+void
+source_file_piece_table_free (SourceFilePieceTable *table)
+{
+  if (!table)
+    return;
+
+  piece_free_tree (table->root);
+  if (table->destroy)
+    table->destroy (table->destroy_data);
+  g_string_free (table->added, TRUE);
+  g_slice_free (SourceFilePieceTable, table);
+}
+
+
+gsize
+source_file_piece_table_length (SourceFilePieceTable *table)
+{
+  return piece_total (table->root);
+}
+
+
+void
+source_file_piece_table_insert (SourceFilePieceTable *table,
+                                gsize                 offset,
+                                const gchar          *text,
+                                gsize                 length)
+{
+  Piece *left, *right;
+
+  g_return_if_fail (offset <= source_file_piece_table_length (table));
+
+  if (!length)
+    return;
+
+  g_string_append_len (table->added, text, length);
+
+  piece_split (table, table->root, offset, &left, &right);
+
+  /* consecutive typing keeps extending the same piece */
+  if (!piece_extend_last (table, left, length))
+    left = piece_merge (left, piece_new (table, TRUE, table->added->len - length, length));
+
+  table->root = piece_merge (left, right);
+}
+
+
+void
+source_file_piece_table_delete (SourceFilePieceTable *table,
+                                gsize                 offset,
+                                gsize                 length)
+{
+  Piece *left, *middle, *right;
+
+  g_return_if_fail (offset <= source_file_piece_table_length (table));
+  g_return_if_fail (length <= source_file_piece_table_length (table) - offset);
+
+  if (!length)
+    return;
+
+  piece_split (table, table->root, offset, &left, &right);
+  piece_split (table, right, length, &middle, &right);
+  piece_free_tree (middle);
+
+  table->root = piece_merge (left, right);
+}
+
+
+/* copies the pieces of the subtree overlapping [offset, offset + length) */
+static gchar *
+piece_copy_range (SourceFilePieceTable *table,
+                  Piece                *piece,
+                  gsize                 offset,
+                  gsize                 length,
+                  gchar                *dest)
+{
+  while (piece && length)
+    {
+      gsize left_total = piece_total (piece->left);
+      gsize n, skip;
+
+      if (offset < left_total)
+        {
+          n = MIN (length, left_total - offset);
+          dest = piece_copy_range (table, piece->left, offset, n, dest);
+          offset += n;
+          length -= n;
+        }
+
+      if (length && offset < left_total + piece->length)
+        {
+          skip = offset - left_total;
+          n = MIN (length, piece->length - skip);
+          memcpy (dest,
+                  (piece->added ? table->added->str : table->original) + piece->start + skip,
+                  n);
+          dest += n;
+          offset += n;
+          length -= n;
+        }
+
+      offset -= left_total + piece->length;
+      piece = piece->right;
+    }
+
+  return dest;
+}
+
+
+/* copies length bytes starting at offset into dest */
+void
+source_file_piece_table_copy (SourceFilePieceTable *table,
+                              gsize                 offset,
+                              gsize                 length,
+                              gchar                *dest)
+{
+  g_return_if_fail (offset <= source_file_piece_table_length (table));
+  g_return_if_fail (length <= source_file_piece_table_length (table) - offset);
+
+  piece_copy_range (table, table->root, offset, length, dest);
+}
+
+
+/* returns a newly allocated, nul-terminated copy of the contents */
+gchar *
+source_file_piece_table_flatten (SourceFilePieceTable *table)
+{
+  gchar *data, *end;
+
+  data = g_malloc (source_file_piece_table_length (table) + 1);
+  end = piece_copy_tree (table, table->root, data);
+  *end = '\0';
+
+  return data;
+}
+
+
+/*
+ * Swaps the storage behind the table for original, which must hold the
+ * current contents (usually what flatten returned), and collapses all
+ * pieces into one. The old storage and the added text are released.
+ */
+void
+source_file_piece_table_rebase (SourceFilePieceTable *table,
+                                const gchar          *original,
+                                GDestroyNotify        destroy,
+                                gpointer              destroy_data)
+{
+  gsize length = source_file_piece_table_length (table);
+
+  piece_free_tree (table->root);
+  table->root = NULL;
+
+  if (table->destroy)
+    table->destroy (table->destroy_data);
+
+  table->original = original;
+  table->destroy = destroy;
+  table->destroy_data = destroy_data;
+  g_string_truncate (table->added, 0);
+
+  if (length)
+    table->root = piece_new (table, FALSE, 0, length);
+}
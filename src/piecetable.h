@@ -0,0 +1,39 @@
+#ifndef __SOURCEPIECETABLE_H__
+#define __SOURCEPIECETABLE_H__
+
+G_BEGIN_DECLS
+
+
+typedef struct _SourceFilePieceTable SourceFilePieceTable;
+
+
+SourceFilePieceTable *source_file_piece_table_new     (const gchar          *original,
+                                                       gsize                 length,
+                                                       GDestroyNotify        destroy,
+                                                       gpointer              destroy_data);
+void                  source_file_piece_table_free    (SourceFilePieceTable *table);
+
+gsize                 source_file_piece_table_length  (SourceFilePieceTable *table);
+
+void                  source_file_piece_table_insert  (SourceFilePieceTable *table,
+                                                       gsize                 offset,
+                                                       const gchar          *text,
+                                                       gsize                 length);
+void                  source_file_piece_table_delete  (SourceFilePieceTable *table,
+                                                       gsize                 offset,
+                                                       gsize                 length);
+
+void                  source_file_piece_table_copy    (SourceFilePieceTable *table,
+                                                       gsize                 offset,
+                                                       gsize                 length,
+                                                       gchar                *dest);
+gchar                *source_file_piece_table_flatten (SourceFilePieceTable *table);
+void                  source_file_piece_table_rebase  (SourceFilePieceTable *table,
+                                                       const gchar          *original,
+                                                       GDestroyNotify        destroy,
+                                                       gpointer              destroy_data);
+
+
+G_END_DECLS
+
+#endif /* __SOURCEPIECETABLE_H__ */
@@ -0,0 +1,4508 @@
+/*
+ * Automatically generated from Python's codecs and the IANA charset
+ * assignments by scripts/singlebyte2c.py, do not edit.
+ *
+ * Number of charsets: 27
+ */
+
+#include <glib.h>
+#include "singlebyte-table.h"
+
+
+/* ANSI_X3.4-1968, from ascii */
+static const guint8 decode_3[256][4] =
+{
+  { 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+  { 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+  { 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+  { 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+  { 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+  { 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+  { 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+  { 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+  { 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+  { 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+  { 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+  { 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+  { 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+  { 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+  { 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+  { 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+  { 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+  { 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+  { 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+  { 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+  { 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+  { 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+  { 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+  { 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+  { 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+  { 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+  { 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+  { 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+  { 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+  { 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+  { 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+  { 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+};
+
+static const guint8 encode_index_3[256] =
+{
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const guint8 encode_pages_3[1][256] =
+{
+  { 0 },
+};
+
+
+/* ISO_8859-1:1987, from latin_1 */
+static const guint8 decode_4[256][4] =
+{
+  { 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+  { 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+  { 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+  { 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+  { 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+  { 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+  { 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+  { 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+  { 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+  { 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+  { 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+  { 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+  { 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+  { 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+  { 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+  { 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+  { 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+  { 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+  { 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+  { 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+  { 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+  { 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+  { 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+  { 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+  { 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+  { 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+  { 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+  { 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+  { 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+  { 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+  { 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+  { 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+  { 0xc2, 0x80, 0x00, 2 }, { 0xc2, 0x81, 0x00, 2 }, { 0xc2, 0x82, 0x00, 2 }, { 0xc2, 0x83, 0x00, 2 },
+  { 0xc2, 0x84, 0x00, 2 }, { 0xc2, 0x85, 0x00, 2 }, { 0xc2, 0x86, 0x00, 2 }, { 0xc2, 0x87, 0x00, 2 },
+  { 0xc2, 0x88, 0x00, 2 }, { 0xc2, 0x89, 0x00, 2 }, { 0xc2, 0x8a, 0x00, 2 }, { 0xc2, 0x8b, 0x00, 2 },
+  { 0xc2, 0x8c, 0x00, 2 }, { 0xc2, 0x8d, 0x00, 2 }, { 0xc2, 0x8e, 0x00, 2 }, { 0xc2, 0x8f, 0x00, 2 },
+  { 0xc2, 0x90, 0x00, 2 }, { 0xc2, 0x91, 0x00, 2 }, { 0xc2, 0x92, 0x00, 2 }, { 0xc2, 0x93, 0x00, 2 },
+  { 0xc2, 0x94, 0x00, 2 }, { 0xc2, 0x95, 0x00, 2 }, { 0xc2, 0x96, 0x00, 2 }, { 0xc2, 0x97, 0x00, 2 },
+  { 0xc2, 0x98, 0x00, 2 }, { 0xc2, 0x99, 0x00, 2 }, { 0xc2, 0x9a, 0x00, 2 }, { 0xc2, 0x9b, 0x00, 2 },
+  { 0xc2, 0x9c, 0x00, 2 }, { 0xc2, 0x9d, 0x00, 2 }, { 0xc2, 0x9e, 0x00, 2 }, { 0xc2, 0x9f, 0x00, 2 },
+  { 0xc2, 0xa0, 0x00, 2 }, { 0xc2, 0xa1, 0x00, 2 }, { 0xc2, 0xa2, 0x00, 2 }, { 0xc2, 0xa3, 0x00, 2 },
+  { 0xc2, 0xa4, 0x00, 2 }, { 0xc2, 0xa5, 0x00, 2 }, { 0xc2, 0xa6, 0x00, 2 }, { 0xc2, 0xa7, 0x00, 2 },
+  { 0xc2, 0xa8, 0x00, 2 }, { 0xc2, 0xa9, 0x00, 2 }, { 0xc2, 0xaa, 0x00, 2 }, { 0xc2, 0xab, 0x00, 2 },
+  { 0xc2, 0xac, 0x00, 2 }, { 0xc2, 0xad, 0x00, 2 }, { 0xc2, 0xae, 0x00, 2 }, { 0xc2, 0xaf, 0x00, 2 },
+  { 0xc2, 0xb0, 0x00, 2 }, { 0xc2, 0xb1, 0x00, 2 }, { 0xc2, 0xb2, 0x00, 2 }, { 0xc2, 0xb3, 0x00, 2 },
+  { 0xc2, 0xb4, 0x00, 2 }, { 0xc2, 0xb5, 0x00, 2 }, { 0xc2, 0xb6, 0x00, 2 }, { 0xc2, 0xb7, 0x00, 2 },
+  { 0xc2, 0xb8, 0x00, 2 }, { 0xc2, 0xb9, 0x00, 2 }, { 0xc2, 0xba, 0x00, 2 }, { 0xc2, 0xbb, 0x00, 2 },
+  { 0xc2, 0xbc, 0x00, 2 }, { 0xc2, 0xbd, 0x00, 2 }, { 0xc2, 0xbe, 0x00, 2 }, { 0xc2, 0xbf, 0x00, 2 },
+  { 0xc3, 0x80, 0x00, 2 }, { 0xc3, 0x81, 0x00, 2 }, { 0xc3, 0x82, 0x00, 2 }, { 0xc3, 0x83, 0x00, 2 },
+  { 0xc3, 0x84, 0x00, 2 }, { 0xc3, 0x85, 0x00, 2 }, { 0xc3, 0x86, 0x00, 2 }, { 0xc3, 0x87, 0x00, 2 },
+  { 0xc3, 0x88, 0x00, 2 }, { 0xc3, 0x89, 0x00, 2 }, { 0xc3, 0x8a, 0x00, 2 }, { 0xc3, 0x8b, 0x00, 2 },
+  { 0xc3, 0x8c, 0x00, 2 }, { 0xc3, 0x8d, 0x00, 2 }, { 0xc3, 0x8e, 0x00, 2 }, { 0xc3, 0x8f, 0x00, 2 },
+  { 0xc3, 0x90, 0x00, 2 }, { 0xc3, 0x91, 0x00, 2 }, { 0xc3, 0x92, 0x00, 2 }, { 0xc3, 0x93, 0x00, 2 },
+  { 0xc3, 0x94, 0x00, 2 }, { 0xc3, 0x95, 0x00, 2 }, { 0xc3, 0x96, 0x00, 2 }, { 0xc3, 0x97, 0x00, 2 },
+  { 0xc3, 0x98, 0x00, 2 }, { 0xc3, 0x99, 0x00, 2 }, { 0xc3, 0x9a, 0x00, 2 }, { 0xc3, 0x9b, 0x00, 2 },
+  { 0xc3, 0x9c, 0x00, 2 }, { 0xc3, 0x9d, 0x00, 2 }, { 0xc3, 0x9e, 0x00, 2 }, { 0xc3, 0x9f, 0x00, 2 },
+  { 0xc3, 0xa0, 0x00, 2 }, { 0xc3, 0xa1, 0x00, 2 }, { 0xc3, 0xa2, 0x00, 2 }, { 0xc3, 0xa3, 0x00, 2 },
+  { 0xc3, 0xa4, 0x00, 2 }, { 0xc3, 0xa5, 0x00, 2 }, { 0xc3, 0xa6, 0x00, 2 }, { 0xc3, 0xa7, 0x00, 2 },
+  { 0xc3, 0xa8, 0x00, 2 }, { 0xc3, 0xa9, 0x00, 2 }, { 0xc3, 0xaa, 0x00, 2 }, { 0xc3, 0xab, 0x00, 2 },
+  { 0xc3, 0xac, 0x00, 2 }, { 0xc3, 0xad, 0x00, 2 }, { 0xc3, 0xae, 0x00, 2 }, { 0xc3, 0xaf, 0x00, 2 },
+  { 0xc3, 0xb0, 0x00, 2 }, { 0xc3, 0xb1, 0x00, 2 }, { 0xc3, 0xb2, 0x00, 2 }, { 0xc3, 0xb3, 0x00, 2 },
+  { 0xc3, 0xb4, 0x00, 2 }, { 0xc3, 0xb5, 0x00, 2 }, { 0xc3, 0xb6, 0x00, 2 }, { 0xc3, 0xb7, 0x00, 2 },
+  { 0xc3, 0xb8, 0x00, 2 }, { 0xc3, 0xb9, 0x00, 2 }, { 0xc3, 0xba, 0x00, 2 }, { 0xc3, 0xbb, 0x00, 2 },
+  { 0xc3, 0xbc, 0x00, 2 }, { 0xc3, 0xbd, 0x00, 2 }, { 0xc3, 0xbe, 0x00, 2 }, { 0xc3, 0xbf, 0x00, 2 },
+};
+
+static const guint8 encode_index_4[256] =
+{
+  1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const guint8 encode_pages_4[2][256] =
+{
+  { 0 },
+  /* U+0000 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f,
+    0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf,
+    0xb0, 0xb1, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xbb, 0xbc, 0xbd, 0xbe, 0xbf,
+    0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+    0xd0, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xdb, 0xdc, 0xdd, 0xde, 0xdf,
+    0xe0, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff,
+  },
+};
+
+
+/* ISO_8859-2:1987, from iso8859_2 */
+static const guint8 decode_5[256][4] =
+{
+  { 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+  { 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+  { 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+  { 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+  { 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+  { 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+  { 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+  { 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+  { 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+  { 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+  { 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+  { 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+  { 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+  { 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+  { 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+  { 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+  { 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+  { 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+  { 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+  { 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+  { 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+  { 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+  { 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+  { 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+  { 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+  { 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+  { 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+  { 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+  { 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+  { 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+  { 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+  { 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+  { 0xc2, 0x80, 0x00, 2 }, { 0xc2, 0x81, 0x00, 2 }, { 0xc2, 0x82, 0x00, 2 }, { 0xc2, 0x83, 0x00, 2 },
+  { 0xc2, 0x84, 0x00, 2 }, { 0xc2, 0x85, 0x00, 2 }, { 0xc2, 0x86, 0x00, 2 }, { 0xc2, 0x87, 0x00, 2 },
+  { 0xc2, 0x88, 0x00, 2 }, { 0xc2, 0x89, 0x00, 2 }, { 0xc2, 0x8a, 0x00, 2 }, { 0xc2, 0x8b, 0x00, 2 },
+  { 0xc2, 0x8c, 0x00, 2 }, { 0xc2, 0x8d, 0x00, 2 }, { 0xc2, 0x8e, 0x00, 2 }, { 0xc2, 0x8f, 0x00, 2 },
+  { 0xc2, 0x90, 0x00, 2 }, { 0xc2, 0x91, 0x00, 2 }, { 0xc2, 0x92, 0x00, 2 }, { 0xc2, 0x93, 0x00, 2 },
+  { 0xc2, 0x94, 0x00, 2 }, { 0xc2, 0x95, 0x00, 2 }, { 0xc2, 0x96, 0x00, 2 }, { 0xc2, 0x97, 0x00, 2 },
+  { 0xc2, 0x98, 0x00, 2 }, { 0xc2, 0x99, 0x00, 2 }, { 0xc2, 0x9a, 0x00, 2 }, { 0xc2, 0x9b, 0x00, 2 },
+  { 0xc2, 0x9c, 0x00, 2 }, { 0xc2, 0x9d, 0x00, 2 }, { 0xc2, 0x9e, 0x00, 2 }, { 0xc2, 0x9f, 0x00, 2 },
+  { 0xc2, 0xa0, 0x00, 2 }, { 0xc4, 0x84, 0x00, 2 }, { 0xcb, 0x98, 0x00, 2 }, { 0xc5, 0x81, 0x00, 2 },
+  { 0xc2, 0xa4, 0x00, 2 }, { 0xc4, 0xbd, 0x00, 2 }, { 0xc5, 0x9a, 0x00, 2 }, { 0xc2, 0xa7, 0x00, 2 },
+  { 0xc2, 0xa8, 0x00, 2 }, { 0xc5, 0xa0, 0x00, 2 }, { 0xc5, 0x9e, 0x00, 2 }, { 0xc5, 0xa4, 0x00, 2 },
+  { 0xc5, 0xb9, 0x00, 2 }, { 0xc2, 0xad, 0x00, 2 }, { 0xc5, 0xbd, 0x00, 2 }, { 0xc5, 0xbb, 0x00, 2 },
+  { 0xc2, 0xb0, 0x00, 2 }, { 0xc4, 0x85, 0x00, 2 }, { 0xcb, 0x9b, 0x00, 2 }, { 0xc5, 0x82, 0x00, 2 },
+  { 0xc2, 0xb4, 0x00, 2 }, { 0xc4, 0xbe, 0x00, 2 }, { 0xc5, 0x9b, 0x00, 2 }, { 0xcb, 0x87, 0x00, 2 },
+  { 0xc2, 0xb8, 0x00, 2 }, { 0xc5, 0xa1, 0x00, 2 }, { 0xc5, 0x9f, 0x00, 2 }, { 0xc5, 0xa5, 0x00, 2 },
+  { 0xc5, 0xba, 0x00, 2 }, { 0xcb, 0x9d, 0x00, 2 }, { 0xc5, 0xbe, 0x00, 2 }, { 0xc5, 0xbc, 0x00, 2 },
+  { 0xc5, 0x94, 0x00, 2 }, { 0xc3, 0x81, 0x00, 2 }, { 0xc3, 0x82, 0x00, 2 }, { 0xc4, 0x82, 0x00, 2 },
+  { 0xc3, 0x84, 0x00, 2 }, { 0xc4, 0xb9, 0x00, 2 }, { 0xc4, 0x86, 0x00, 2 }, { 0xc3, 0x87, 0x00, 2 },
+  { 0xc4, 0x8c, 0x00, 2 }, { 0xc3, 0x89, 0x00, 2 }, { 0xc4, 0x98, 0x00, 2 }, { 0xc3, 0x8b, 0x00, 2 },
+  { 0xc4, 0x9a, 0x00, 2 }, { 0xc3, 0x8d, 0x00, 2 }, { 0xc3, 0x8e, 0x00, 2 }, { 0xc4, 0x8e, 0x00, 2 },
+  { 0xc4, 0x90, 0x00, 2 }, { 0xc5, 0x83, 0x00, 2 }, { 0xc5, 0x87, 0x00, 2 }, { 0xc3, 0x93, 0x00, 2 },
+  { 0xc3, 0x94, 0x00, 2 }, { 0xc5, 0x90, 0x00, 2 }, { 0xc3, 0x96, 0x00, 2 }, { 0xc3, 0x97, 0x00, 2 },
+  { 0xc5, 0x98, 0x00, 2 }, { 0xc5, 0xae, 0x00, 2 }, { 0xc3, 0x9a, 0x00, 2 }, { 0xc5, 0xb0, 0x00, 2 },
+  { 0xc3, 0x9c, 0x00, 2 }, { 0xc3, 0x9d, 0x00, 2 }, { 0xc5, 0xa2, 0x00, 2 }, { 0xc3, 0x9f, 0x00, 2 },
+  { 0xc5, 0x95, 0x00, 2 }, { 0xc3, 0xa1, 0x00, 2 }, { 0xc3, 0xa2, 0x00, 2 }, { 0xc4, 0x83, 0x00, 2 },
+  { 0xc3, 0xa4, 0x00, 2 }, { 0xc4, 0xba, 0x00, 2 }, { 0xc4, 0x87, 0x00, 2 }, { 0xc3, 0xa7, 0x00, 2 },
+  { 0xc4, 0x8d, 0x00, 2 }, { 0xc3, 0xa9, 0x00, 2 }, { 0xc4, 0x99, 0x00, 2 }, { 0xc3, 0xab, 0x00, 2 },
+  { 0xc4, 0x9b, 0x00, 2 }, { 0xc3, 0xad, 0x00, 2 }, { 0xc3, 0xae, 0x00, 2 }, { 0xc4, 0x8f, 0x00, 2 },
+  { 0xc4, 0x91, 0x00, 2 }, { 0xc5, 0x84, 0x00, 2 }, { 0xc5, 0x88, 0x00, 2 }, { 0xc3, 0xb3, 0x00, 2 },
+  { 0xc3, 0xb4, 0x00, 2 }, { 0xc5, 0x91, 0x00, 2 }, { 0xc3, 0xb6, 0x00, 2 }, { 0xc3, 0xb7, 0x00, 2 },
+  { 0xc5, 0x99, 0x00, 2 }, { 0xc5, 0xaf, 0x00, 2 }, { 0xc3, 0xba, 0x00, 2 }, { 0xc5, 0xb1, 0x00, 2 },
+  { 0xc3, 0xbc, 0x00, 2 }, { 0xc3, 0xbd, 0x00, 2 }, { 0xc5, 0xa3, 0x00, 2 }, { 0xcb, 0x99, 0x00, 2 },
+};
+
+static const guint8 encode_index_5[256] =
+{
+  1, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const guint8 encode_pages_5[4][256] =
+{
+  { 0 },
+  /* U+0000 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f,
+    0xa0, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0xa7, 0xa8, 0x00, 0x00, 0x00, 0x00, 0xad, 0x00, 0x00,
+    0xb0, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xc1, 0xc2, 0x00, 0xc4, 0x00, 0x00, 0xc7, 0x00, 0xc9, 0x00, 0xcb, 0x00, 0xcd, 0xce, 0x00,
+    0x00, 0x00, 0x00, 0xd3, 0xd4, 0x00, 0xd6, 0xd7, 0x00, 0x00, 0xda, 0x00, 0xdc, 0xdd, 0x00, 0xdf,
+    0x00, 0xe1, 0xe2, 0x00, 0xe4, 0x00, 0x00, 0xe7, 0x00, 0xe9, 0x00, 0xeb, 0x00, 0xed, 0xee, 0x00,
+    0x00, 0x00, 0x00, 0xf3, 0xf4, 0x00, 0xf6, 0xf7, 0x00, 0x00, 0xfa, 0x00, 0xfc, 0xfd, 0x00, 0x00,
+  },
+  /* U+0100 */
+  {
+    0x00, 0x00, 0xc3, 0xe3, 0xa1, 0xb1, 0xc6, 0xe6, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xe8, 0xcf, 0xef,
+    0xd0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0xea, 0xcc, 0xec, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xe5, 0x00, 0x00, 0xa5, 0xb5, 0x00,
+    0x00, 0xa3, 0xb3, 0xd1, 0xf1, 0x00, 0x00, 0xd2, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xd5, 0xf5, 0x00, 0x00, 0xc0, 0xe0, 0x00, 0x00, 0xd8, 0xf8, 0xa6, 0xb6, 0x00, 0x00, 0xaa, 0xba,
+    0xa9, 0xb9, 0xde, 0xfe, 0xab, 0xbb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0xf9,
+    0xdb, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0xbc, 0xaf, 0xbf, 0xae, 0xbe, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+0200 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xff, 0x00, 0xb2, 0x00, 0xbd, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+};
+
+
+/* ISO_8859-3:1988, from iso8859_3 */
+static const guint8 decode_6[256][4] =
+{
+  { 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+  { 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+  { 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+  { 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+  { 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+  { 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+  { 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+  { 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+  { 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+  { 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+  { 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+  { 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+  { 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+  { 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+  { 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+  { 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+  { 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+  { 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+  { 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+  { 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+  { 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+  { 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+  { 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+  { 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+  { 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+  { 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+  { 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+  { 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+  { 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+  { 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+  { 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+  { 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+  { 0xc2, 0x80, 0x00, 2 }, { 0xc2, 0x81, 0x00, 2 }, { 0xc2, 0x82, 0x00, 2 }, { 0xc2, 0x83, 0x00, 2 },
+  { 0xc2, 0x84, 0x00, 2 }, { 0xc2, 0x85, 0x00, 2 }, { 0xc2, 0x86, 0x00, 2 }, { 0xc2, 0x87, 0x00, 2 },
+  { 0xc2, 0x88, 0x00, 2 }, { 0xc2, 0x89, 0x00, 2 }, { 0xc2, 0x8a, 0x00, 2 }, { 0xc2, 0x8b, 0x00, 2 },
+  { 0xc2, 0x8c, 0x00, 2 }, { 0xc2, 0x8d, 0x00, 2 }, { 0xc2, 0x8e, 0x00, 2 }, { 0xc2, 0x8f, 0x00, 2 },
+  { 0xc2, 0x90, 0x00, 2 }, { 0xc2, 0x91, 0x00, 2 }, { 0xc2, 0x92, 0x00, 2 }, { 0xc2, 0x93, 0x00, 2 },
+  { 0xc2, 0x94, 0x00, 2 }, { 0xc2, 0x95, 0x00, 2 }, { 0xc2, 0x96, 0x00, 2 }, { 0xc2, 0x97, 0x00, 2 },
+  { 0xc2, 0x98, 0x00, 2 }, { 0xc2, 0x99, 0x00, 2 }, { 0xc2, 0x9a, 0x00, 2 }, { 0xc2, 0x9b, 0x00, 2 },
+  { 0xc2, 0x9c, 0x00, 2 }, { 0xc2, 0x9d, 0x00, 2 }, { 0xc2, 0x9e, 0x00, 2 }, { 0xc2, 0x9f, 0x00, 2 },
+  { 0xc2, 0xa0, 0x00, 2 }, { 0xc4, 0xa6, 0x00, 2 }, { 0xcb, 0x98, 0x00, 2 }, { 0xc2, 0xa3, 0x00, 2 },
+  { 0xc2, 0xa4, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 }, { 0xc4, 0xa4, 0x00, 2 }, { 0xc2, 0xa7, 0x00, 2 },
+  { 0xc2, 0xa8, 0x00, 2 }, { 0xc4, 0xb0, 0x00, 2 }, { 0xc5, 0x9e, 0x00, 2 }, { 0xc4, 0x9e, 0x00, 2 },
+  { 0xc4, 0xb4, 0x00, 2 }, { 0xc2, 0xad, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 }, { 0xc5, 0xbb, 0x00, 2 },
+  { 0xc2, 0xb0, 0x00, 2 }, { 0xc4, 0xa7, 0x00, 2 }, { 0xc2, 0xb2, 0x00, 2 }, { 0xc2, 0xb3, 0x00, 2 },
+  { 0xc2, 0xb4, 0x00, 2 }, { 0xc2, 0xb5, 0x00, 2 }, { 0xc4, 0xa5, 0x00, 2 }, { 0xc2, 0xb7, 0x00, 2 },
+  { 0xc2, 0xb8, 0x00, 2 }, { 0xc4, 0xb1, 0x00, 2 }, { 0xc5, 0x9f, 0x00, 2 }, { 0xc4, 0x9f, 0x00, 2 },
+  { 0xc4, 0xb5, 0x00, 2 }, { 0xc2, 0xbd, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 }, { 0xc5, 0xbc, 0x00, 2 },
+  { 0xc3, 0x80, 0x00, 2 }, { 0xc3, 0x81, 0x00, 2 }, { 0xc3, 0x82, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 },
+  { 0xc3, 0x84, 0x00, 2 }, { 0xc4, 0x8a, 0x00, 2 }, { 0xc4, 0x88, 0x00, 2 }, { 0xc3, 0x87, 0x00, 2 },
+  { 0xc3, 0x88, 0x00, 2 }, { 0xc3, 0x89, 0x00, 2 }, { 0xc3, 0x8a, 0x00, 2 }, { 0xc3, 0x8b, 0x00, 2 },
+  { 0xc3, 0x8c, 0x00, 2 }, { 0xc3, 0x8d, 0x00, 2 }, { 0xc3, 0x8e, 0x00, 2 }, { 0xc3, 0x8f, 0x00, 2 },
+  { 0x00, 0x00, 0x00, 0 }, { 0xc3, 0x91, 0x00, 2 }, { 0xc3, 0x92, 0x00, 2 }, { 0xc3, 0x93, 0x00, 2 },
+  { 0xc3, 0x94, 0x00, 2 }, { 0xc4, 0xa0, 0x00, 2 }, { 0xc3, 0x96, 0x00, 2 }, { 0xc3, 0x97, 0x00, 2 },
+  { 0xc4, 0x9c, 0x00, 2 }, { 0xc3, 0x99, 0x00, 2 }, { 0xc3, 0x9a, 0x00, 2 }, { 0xc3, 0x9b, 0x00, 2 },
+  { 0xc3, 0x9c, 0x00, 2 }, { 0xc5, 0xac, 0x00, 2 }, { 0xc5, 0x9c, 0x00, 2 }, { 0xc3, 0x9f, 0x00, 2 },
+  { 0xc3, 0xa0, 0x00, 2 }, { 0xc3, 0xa1, 0x00, 2 }, { 0xc3, 0xa2, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 },
+  { 0xc3, 0xa4, 0x00, 2 }, { 0xc4, 0x8b, 0x00, 2 }, { 0xc4, 0x89, 0x00, 2 }, { 0xc3, 0xa7, 0x00, 2 },
+  { 0xc3, 0xa8, 0x00, 2 }, { 0xc3, 0xa9, 0x00, 2 }, { 0xc3, 0xaa, 0x00, 2 }, { 0xc3, 0xab, 0x00, 2 },
+  { 0xc3, 0xac, 0x00, 2 }, { 0xc3, 0xad, 0x00, 2 }, { 0xc3, 0xae, 0x00, 2 }, { 0xc3, 0xaf, 0x00, 2 },
+  { 0x00, 0x00, 0x00, 0 }, { 0xc3, 0xb1, 0x00, 2 }, { 0xc3, 0xb2, 0x00, 2 }, { 0xc3, 0xb3, 0x00, 2 },
+  { 0xc3, 0xb4, 0x00, 2 }, { 0xc4, 0xa1, 0x00, 2 }, { 0xc3, 0xb6, 0x00, 2 }, { 0xc3, 0xb7, 0x00, 2 },
+  { 0xc4, 0x9d, 0x00, 2 }, { 0xc3, 0xb9, 0x00, 2 }, { 0xc3, 0xba, 0x00, 2 }, { 0xc3, 0xbb, 0x00, 2 },
+  { 0xc3, 0xbc, 0x00, 2 }, { 0xc5, 0xad, 0x00, 2 }, { 0xc5, 0x9d, 0x00, 2 }, { 0xcb, 0x99, 0x00, 2 },
+};
+
+static const guint8 encode_index_6[256] =
+{
+  1, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const guint8 encode_pages_6[4][256] =
+{
+  { 0 },
+  /* U+0000 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f,
+    0xa0, 0x00, 0x00, 0xa3, 0xa4, 0x00, 0x00, 0xa7, 0xa8, 0x00, 0x00, 0x00, 0x00, 0xad, 0x00, 0x00,
+    0xb0, 0x00, 0xb2, 0xb3, 0xb4, 0xb5, 0x00, 0xb7, 0xb8, 0x00, 0x00, 0x00, 0x00, 0xbd, 0x00, 0x00,
+    0xc0, 0xc1, 0xc2, 0x00, 0xc4, 0x00, 0x00, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+    0x00, 0xd1, 0xd2, 0xd3, 0xd4, 0x00, 0xd6, 0xd7, 0x00, 0xd9, 0xda, 0xdb, 0xdc, 0x00, 0x00, 0xdf,
+    0xe0, 0xe1, 0xe2, 0x00, 0xe4, 0x00, 0x00, 0xe7, 0xe8, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef,
+    0x00, 0xf1, 0xf2, 0xf3, 0xf4, 0x00, 0xf6, 0xf7, 0x00, 0xf9, 0xfa, 0xfb, 0xfc, 0x00, 0x00, 0x00,
+  },
+  /* U+0100 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xe6, 0xc5, 0xe5, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xf8, 0xab, 0xbb,
+    0xd5, 0xf5, 0x00, 0x00, 0xa6, 0xb6, 0xa1, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xa9, 0xb9, 0x00, 0x00, 0xac, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xfe, 0xaa, 0xba,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdd, 0xfd, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0xbf, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+0200 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+};
+
+
+/* ISO_8859-4:1988, from iso8859_4 */
+static const guint8 decode_7[256][4] =
+{
+  { 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+  { 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+  { 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+  { 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+  { 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+  { 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+  { 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+  { 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+  { 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+  { 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+  { 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+  { 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+  { 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+  { 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+  { 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+  { 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+  { 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+  { 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+  { 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+  { 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+  { 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+  { 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+  { 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+  { 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+  { 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+  { 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+  { 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+  { 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+  { 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+  { 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+  { 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+  { 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+  { 0xc2, 0x80, 0x00, 2 }, { 0xc2, 0x81, 0x00, 2 }, { 0xc2, 0x82, 0x00, 2 }, { 0xc2, 0x83, 0x00, 2 },
+  { 0xc2, 0x84, 0x00, 2 }, { 0xc2, 0x85, 0x00, 2 }, { 0xc2, 0x86, 0x00, 2 }, { 0xc2, 0x87, 0x00, 2 },
+  { 0xc2, 0x88, 0x00, 2 }, { 0xc2, 0x89, 0x00, 2 }, { 0xc2, 0x8a, 0x00, 2 }, { 0xc2, 0x8b, 0x00, 2 },
+  { 0xc2, 0x8c, 0x00, 2 }, { 0xc2, 0x8d, 0x00, 2 }, { 0xc2, 0x8e, 0x00, 2 }, { 0xc2, 0x8f, 0x00, 2 },
+  { 0xc2, 0x90, 0x00, 2 }, { 0xc2, 0x91, 0x00, 2 }, { 0xc2, 0x92, 0x00, 2 }, { 0xc2, 0x93, 0x00, 2 },
+  { 0xc2, 0x94, 0x00, 2 }, { 0xc2, 0x95, 0x00, 2 }, { 0xc2, 0x96, 0x00, 2 }, { 0xc2, 0x97, 0x00, 2 },
+  { 0xc2, 0x98, 0x00, 2 }, { 0xc2, 0x99, 0x00, 2 }, { 0xc2, 0x9a, 0x00, 2 }, { 0xc2, 0x9b, 0x00, 2 },
+  { 0xc2, 0x9c, 0x00, 2 }, { 0xc2, 0x9d, 0x00, 2 }, { 0xc2, 0x9e, 0x00, 2 }, { 0xc2, 0x9f, 0x00, 2 },
+  { 0xc2, 0xa0, 0x00, 2 }, { 0xc4, 0x84, 0x00, 2 }, { 0xc4, 0xb8, 0x00, 2 }, { 0xc5, 0x96, 0x00, 2 },
+  { 0xc2, 0xa4, 0x00, 2 }, { 0xc4, 0xa8, 0x00, 2 }, { 0xc4, 0xbb, 0x00, 2 }, { 0xc2, 0xa7, 0x00, 2 },
+  { 0xc2, 0xa8, 0x00, 2 }, { 0xc5, 0xa0, 0x00, 2 }, { 0xc4, 0x92, 0x00, 2 }, { 0xc4, 0xa2, 0x00, 2 },
+  { 0xc5, 0xa6, 0x00, 2 }, { 0xc2, 0xad, 0x00, 2 }, { 0xc5, 0xbd, 0x00, 2 }, { 0xc2, 0xaf, 0x00, 2 },
+  { 0xc2, 0xb0, 0x00, 2 }, { 0xc4, 0x85, 0x00, 2 }, { 0xcb, 0x9b, 0x00, 2 }, { 0xc5, 0x97, 0x00, 2 },
+  { 0xc2, 0xb4, 0x00, 2 }, { 0xc4, 0xa9, 0x00, 2 }, { 0xc4, 0xbc, 0x00, 2 }, { 0xcb, 0x87, 0x00, 2 },
+  { 0xc2, 0xb8, 0x00, 2 }, { 0xc5, 0xa1, 0x00, 2 }, { 0xc4, 0x93, 0x00, 2 }, { 0xc4, 0xa3, 0x00, 2 },
+  { 0xc5, 0xa7, 0x00, 2 }, { 0xc5, 0x8a, 0x00, 2 }, { 0xc5, 0xbe, 0x00, 2 }, { 0xc5, 0x8b, 0x00, 2 },
+  { 0xc4, 0x80, 0x00, 2 }, { 0xc3, 0x81, 0x00, 2 }, { 0xc3, 0x82, 0x00, 2 }, { 0xc3, 0x83, 0x00, 2 },
+  { 0xc3, 0x84, 0x00, 2 }, { 0xc3, 0x85, 0x00, 2 }, { 0xc3, 0x86, 0x00, 2 }, { 0xc4, 0xae, 0x00, 2 },
+  { 0xc4, 0x8c, 0x00, 2 }, { 0xc3, 0x89, 0x00, 2 }, { 0xc4, 0x98, 0x00, 2 }, { 0xc3, 0x8b, 0x00, 2 },
+  { 0xc4, 0x96, 0x00, 2 }, { 0xc3, 0x8d, 0x00, 2 }, { 0xc3, 0x8e, 0x00, 2 }, { 0xc4, 0xaa, 0x00, 2 },
+  { 0xc4, 0x90, 0x00, 2 }, { 0xc5, 0x85, 0x00, 2 }, { 0xc5, 0x8c, 0x00, 2 }, { 0xc4, 0xb6, 0x00, 2 },
+  { 0xc3, 0x94, 0x00, 2 }, { 0xc3, 0x95, 0x00, 2 }, { 0xc3, 0x96, 0x00, 2 }, { 0xc3, 0x97, 0x00, 2 },
+  { 0xc3, 0x98, 0x00, 2 }, { 0xc5, 0xb2, 0x00, 2 }, { 0xc3, 0x9a, 0x00, 2 }, { 0xc3, 0x9b, 0x00, 2 },
+  { 0xc3, 0x9c, 0x00, 2 }, { 0xc5, 0xa8, 0x00, 2 }, { 0xc5, 0xaa, 0x00, 2 }, { 0xc3, 0x9f, 0x00, 2 },
+  { 0xc4, 0x81, 0x00, 2 }, { 0xc3, 0xa1, 0x00, 2 }, { 0xc3, 0xa2, 0x00, 2 }, { 0xc3, 0xa3, 0x00, 2 },
+  { 0xc3, 0xa4, 0x00, 2 }, { 0xc3, 0xa5, 0x00, 2 }, { 0xc3, 0xa6, 0x00, 2 }, { 0xc4, 0xaf, 0x00, 2 },
+  { 0xc4, 0x8d, 0x00, 2 }, { 0xc3, 0xa9, 0x00, 2 }, { 0xc4, 0x99, 0x00, 2 }, { 0xc3, 0xab, 0x00, 2 },
+  { 0xc4, 0x97, 0x00, 2 }, { 0xc3, 0xad, 0x00, 2 }, { 0xc3, 0xae, 0x00, 2 }, { 0xc4, 0xab, 0x00, 2 },
+  { 0xc4, 0x91, 0x00, 2 }, { 0xc5, 0x86, 0x00, 2 }, { 0xc5, 0x8d, 0x00, 2 }, { 0xc4, 0xb7, 0x00, 2 },
+  { 0xc3, 0xb4, 0x00, 2 }, { 0xc3, 0xb5, 0x00, 2 }, { 0xc3, 0xb6, 0x00, 2 }, { 0xc3, 0xb7, 0x00, 2 },
+  { 0xc3, 0xb8, 0x00, 2 }, { 0xc5, 0xb3, 0x00, 2 }, { 0xc3, 0xba, 0x00, 2 }, { 0xc3, 0xbb, 0x00, 2 },
+  { 0xc3, 0xbc, 0x00, 2 }, { 0xc5, 0xa9, 0x00, 2 }, { 0xc5, 0xab, 0x00, 2 }, { 0xcb, 0x99, 0x00, 2 },
+};
+
+static const guint8 encode_index_7[256] =
+{
+  1, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const guint8 encode_pages_7[4][256] =
+{
+  { 0 },
+  /* U+0000 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f,
+    0xa0, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0xa7, 0xa8, 0x00, 0x00, 0x00, 0x00, 0xad, 0x00, 0xaf,
+    0xb0, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0x00, 0x00, 0xc9, 0x00, 0xcb, 0x00, 0xcd, 0xce, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0x00, 0xda, 0xdb, 0xdc, 0x00, 0x00, 0xdf,
+    0x00, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0x00, 0x00, 0xe9, 0x00, 0xeb, 0x00, 0xed, 0xee, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0x00, 0xfa, 0xfb, 0xfc, 0x00, 0x00, 0x00,
+  },
+  /* U+0100 */
+  {
+    0xc0, 0xe0, 0x00, 0x00, 0xa1, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xe8, 0x00, 0x00,
+    0xd0, 0xf0, 0xaa, 0xba, 0x00, 0x00, 0xcc, 0xec, 0xca, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xab, 0xbb, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xb5, 0xcf, 0xef, 0x00, 0x00, 0xc7, 0xe7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd3, 0xf3, 0xa2, 0x00, 0x00, 0xa6, 0xb6, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xf1, 0x00, 0x00, 0x00, 0xbd, 0xbf, 0xd2, 0xf2, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa3, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xa9, 0xb9, 0x00, 0x00, 0x00, 0x00, 0xac, 0xbc, 0xdd, 0xfd, 0xde, 0xfe, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xd9, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xae, 0xbe, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+0200 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0xb2, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+};
+
+
+/* ISO_8859-5:1988, from iso8859_5 */
+static const guint8 decode_8[256][4] =
+{
+  { 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+  { 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+  { 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+  { 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+  { 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+  { 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+  { 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+  { 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+  { 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+  { 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+  { 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+  { 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+  { 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+  { 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+  { 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+  { 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+  { 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+  { 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+  { 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+  { 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+  { 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+  { 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+  { 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+  { 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+  { 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+  { 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+  { 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+  { 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+  { 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+  { 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+  { 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+  { 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+  { 0xc2, 0x80, 0x00, 2 }, { 0xc2, 0x81, 0x00, 2 }, { 0xc2, 0x82, 0x00, 2 }, { 0xc2, 0x83, 0x00, 2 },
+  { 0xc2, 0x84, 0x00, 2 }, { 0xc2, 0x85, 0x00, 2 }, { 0xc2, 0x86, 0x00, 2 }, { 0xc2, 0x87, 0x00, 2 },
+  { 0xc2, 0x88, 0x00, 2 }, { 0xc2, 0x89, 0x00, 2 }, { 0xc2, 0x8a, 0x00, 2 }, { 0xc2, 0x8b, 0x00, 2 },
+  { 0xc2, 0x8c, 0x00, 2 }, { 0xc2, 0x8d, 0x00, 2 }, { 0xc2, 0x8e, 0x00, 2 }, { 0xc2, 0x8f, 0x00, 2 },
+  { 0xc2, 0x90, 0x00, 2 }, { 0xc2, 0x91, 0x00, 2 }, { 0xc2, 0x92, 0x00, 2 }, { 0xc2, 0x93, 0x00, 2 },
+  { 0xc2, 0x94, 0x00, 2 }, { 0xc2, 0x95, 0x00, 2 }, { 0xc2, 0x96, 0x00, 2 }, { 0xc2, 0x97, 0x00, 2 },
+  { 0xc2, 0x98, 0x00, 2 }, { 0xc2, 0x99, 0x00, 2 }, { 0xc2, 0x9a, 0x00, 2 }, { 0xc2, 0x9b, 0x00, 2 },
+  { 0xc2, 0x9c, 0x00, 2 }, { 0xc2, 0x9d, 0x00, 2 }, { 0xc2, 0x9e, 0x00, 2 }, { 0xc2, 0x9f, 0x00, 2 },
+  { 0xc2, 0xa0, 0x00, 2 }, { 0xd0, 0x81, 0x00, 2 }, { 0xd0, 0x82, 0x00, 2 }, { 0xd0, 0x83, 0x00, 2 },
+  { 0xd0, 0x84, 0x00, 2 }, { 0xd0, 0x85, 0x00, 2 }, { 0xd0, 0x86, 0x00, 2 }, { 0xd0, 0x87, 0x00, 2 },
+  { 0xd0, 0x88, 0x00, 2 }, { 0xd0, 0x89, 0x00, 2 }, { 0xd0, 0x8a, 0x00, 2 }, { 0xd0, 0x8b, 0x00, 2 },
+  { 0xd0, 0x8c, 0x00, 2 }, { 0xc2, 0xad, 0x00, 2 }, { 0xd0, 0x8e, 0x00, 2 }, { 0xd0, 0x8f, 0x00, 2 },
+  { 0xd0, 0x90, 0x00, 2 }, { 0xd0, 0x91, 0x00, 2 }, { 0xd0, 0x92, 0x00, 2 }, { 0xd0, 0x93, 0x00, 2 },
+  { 0xd0, 0x94, 0x00, 2 }, { 0xd0, 0x95, 0x00, 2 }, { 0xd0, 0x96, 0x00, 2 }, { 0xd0, 0x97, 0x00, 2 },
+  { 0xd0, 0x98, 0x00, 2 }, { 0xd0, 0x99, 0x00, 2 }, { 0xd0, 0x9a, 0x00, 2 }, { 0xd0, 0x9b, 0x00, 2 },
+  { 0xd0, 0x9c, 0x00, 2 }, { 0xd0, 0x9d, 0x00, 2 }, { 0xd0, 0x9e, 0x00, 2 }, { 0xd0, 0x9f, 0x00, 2 },
+  { 0xd0, 0xa0, 0x00, 2 }, { 0xd0, 0xa1, 0x00, 2 }, { 0xd0, 0xa2, 0x00, 2 }, { 0xd0, 0xa3, 0x00, 2 },
+  { 0xd0, 0xa4, 0x00, 2 }, { 0xd0, 0xa5, 0x00, 2 }, { 0xd0, 0xa6, 0x00, 2 }, { 0xd0, 0xa7, 0x00, 2 },
+  { 0xd0, 0xa8, 0x00, 2 }, { 0xd0, 0xa9, 0x00, 2 }, { 0xd0, 0xaa, 0x00, 2 }, { 0xd0, 0xab, 0x00, 2 },
+  { 0xd0, 0xac, 0x00, 2 }, { 0xd0, 0xad, 0x00, 2 }, { 0xd0, 0xae, 0x00, 2 }, { 0xd0, 0xaf, 0x00, 2 },
+  { 0xd0, 0xb0, 0x00, 2 }, { 0xd0, 0xb1, 0x00, 2 }, { 0xd0, 0xb2, 0x00, 2 }, { 0xd0, 0xb3, 0x00, 2 },
+  { 0xd0, 0xb4, 0x00, 2 }, { 0xd0, 0xb5, 0x00, 2 }, { 0xd0, 0xb6, 0x00, 2 }, { 0xd0, 0xb7, 0x00, 2 },
+  { 0xd0, 0xb8, 0x00, 2 }, { 0xd0, 0xb9, 0x00, 2 }, { 0xd0, 0xba, 0x00, 2 }, { 0xd0, 0xbb, 0x00, 2 },
+  { 0xd0, 0xbc, 0x00, 2 }, { 0xd0, 0xbd, 0x00, 2 }, { 0xd0, 0xbe, 0x00, 2 }, { 0xd0, 0xbf, 0x00, 2 },
+  { 0xd1, 0x80, 0x00, 2 }, { 0xd1, 0x81, 0x00, 2 }, { 0xd1, 0x82, 0x00, 2 }, { 0xd1, 0x83, 0x00, 2 },
+  { 0xd1, 0x84, 0x00, 2 }, { 0xd1, 0x85, 0x00, 2 }, { 0xd1, 0x86, 0x00, 2 }, { 0xd1, 0x87, 0x00, 2 },
+  { 0xd1, 0x88, 0x00, 2 }, { 0xd1, 0x89, 0x00, 2 }, { 0xd1, 0x8a, 0x00, 2 }, { 0xd1, 0x8b, 0x00, 2 },
+  { 0xd1, 0x8c, 0x00, 2 }, { 0xd1, 0x8d, 0x00, 2 }, { 0xd1, 0x8e, 0x00, 2 }, { 0xd1, 0x8f, 0x00, 2 },
+  { 0xe2, 0x84, 0x96, 3 }, { 0xd1, 0x91, 0x00, 2 }, { 0xd1, 0x92, 0x00, 2 }, { 0xd1, 0x93, 0x00, 2 },
+  { 0xd1, 0x94, 0x00, 2 }, { 0xd1, 0x95, 0x00, 2 }, { 0xd1, 0x96, 0x00, 2 }, { 0xd1, 0x97, 0x00, 2 },
+  { 0xd1, 0x98, 0x00, 2 }, { 0xd1, 0x99, 0x00, 2 }, { 0xd1, 0x9a, 0x00, 2 }, { 0xd1, 0x9b, 0x00, 2 },
+  { 0xd1, 0x9c, 0x00, 2 }, { 0xc2, 0xa7, 0x00, 2 }, { 0xd1, 0x9e, 0x00, 2 }, { 0xd1, 0x9f, 0x00, 2 },
+};
+
+static const guint8 encode_index_8[256] =
+{
+  1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const guint8 encode_pages_8[4][256] =
+{
+  { 0 },
+  /* U+0000 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f,
+    0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+0400 */
+  {
+    0x00, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xab, 0xac, 0x00, 0xae, 0xaf,
+    0xb0, 0xb1, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xbb, 0xbc, 0xbd, 0xbe, 0xbf,
+    0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+    0xd0, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xdb, 0xdc, 0xdd, 0xde, 0xdf,
+    0xe0, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef,
+    0x00, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0x00, 0xfe, 0xff,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+2100 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+};
+
+
+/* ISO_8859-6:1987, from iso8859_6 */
+static const guint8 decode_9[256][4] =
+{
+  { 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+  { 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+  { 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+  { 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+  { 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+  { 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+  { 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+  { 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+  { 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+  { 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+  { 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+  { 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+  { 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+  { 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+  { 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+  { 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+  { 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+  { 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+  { 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+  { 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+  { 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+  { 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+  { 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+  { 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+  { 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+  { 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+  { 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+  { 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+  { 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+  { 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+  { 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+  { 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+  { 0xc2, 0x80, 0x00, 2 }, { 0xc2, 0x81, 0x00, 2 }, { 0xc2, 0x82, 0x00, 2 }, { 0xc2, 0x83, 0x00, 2 },
+  { 0xc2, 0x84, 0x00, 2 }, { 0xc2, 0x85, 0x00, 2 }, { 0xc2, 0x86, 0x00, 2 }, { 0xc2, 0x87, 0x00, 2 },
+  { 0xc2, 0x88, 0x00, 2 }, { 0xc2, 0x89, 0x00, 2 }, { 0xc2, 0x8a, 0x00, 2 }, { 0xc2, 0x8b, 0x00, 2 },
+  { 0xc2, 0x8c, 0x00, 2 }, { 0xc2, 0x8d, 0x00, 2 }, { 0xc2, 0x8e, 0x00, 2 }, { 0xc2, 0x8f, 0x00, 2 },
+  { 0xc2, 0x90, 0x00, 2 }, { 0xc2, 0x91, 0x00, 2 }, { 0xc2, 0x92, 0x00, 2 }, { 0xc2, 0x93, 0x00, 2 },
+  { 0xc2, 0x94, 0x00, 2 }, { 0xc2, 0x95, 0x00, 2 }, { 0xc2, 0x96, 0x00, 2 }, { 0xc2, 0x97, 0x00, 2 },
+  { 0xc2, 0x98, 0x00, 2 }, { 0xc2, 0x99, 0x00, 2 }, { 0xc2, 0x9a, 0x00, 2 }, { 0xc2, 0x9b, 0x00, 2 },
+  { 0xc2, 0x9c, 0x00, 2 }, { 0xc2, 0x9d, 0x00, 2 }, { 0xc2, 0x9e, 0x00, 2 }, { 0xc2, 0x9f, 0x00, 2 },
+  { 0xc2, 0xa0, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0xc2, 0xa4, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0xd8, 0x8c, 0x00, 2 }, { 0xc2, 0xad, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0xd8, 0x9b, 0x00, 2 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0xd8, 0x9f, 0x00, 2 },
+  { 0x00, 0x00, 0x00, 0 }, { 0xd8, 0xa1, 0x00, 2 }, { 0xd8, 0xa2, 0x00, 2 }, { 0xd8, 0xa3, 0x00, 2 },
+  { 0xd8, 0xa4, 0x00, 2 }, { 0xd8, 0xa5, 0x00, 2 }, { 0xd8, 0xa6, 0x00, 2 }, { 0xd8, 0xa7, 0x00, 2 },
+  { 0xd8, 0xa8, 0x00, 2 }, { 0xd8, 0xa9, 0x00, 2 }, { 0xd8, 0xaa, 0x00, 2 }, { 0xd8, 0xab, 0x00, 2 },
+  { 0xd8, 0xac, 0x00, 2 }, { 0xd8, 0xad, 0x00, 2 }, { 0xd8, 0xae, 0x00, 2 }, { 0xd8, 0xaf, 0x00, 2 },
+  { 0xd8, 0xb0, 0x00, 2 }, { 0xd8, 0xb1, 0x00, 2 }, { 0xd8, 0xb2, 0x00, 2 }, { 0xd8, 0xb3, 0x00, 2 },
+  { 0xd8, 0xb4, 0x00, 2 }, { 0xd8, 0xb5, 0x00, 2 }, { 0xd8, 0xb6, 0x00, 2 }, { 0xd8, 0xb7, 0x00, 2 },
+  { 0xd8, 0xb8, 0x00, 2 }, { 0xd8, 0xb9, 0x00, 2 }, { 0xd8, 0xba, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0xd9, 0x80, 0x00, 2 }, { 0xd9, 0x81, 0x00, 2 }, { 0xd9, 0x82, 0x00, 2 }, { 0xd9, 0x83, 0x00, 2 },
+  { 0xd9, 0x84, 0x00, 2 }, { 0xd9, 0x85, 0x00, 2 }, { 0xd9, 0x86, 0x00, 2 }, { 0xd9, 0x87, 0x00, 2 },
+  { 0xd9, 0x88, 0x00, 2 }, { 0xd9, 0x89, 0x00, 2 }, { 0xd9, 0x8a, 0x00, 2 }, { 0xd9, 0x8b, 0x00, 2 },
+  { 0xd9, 0x8c, 0x00, 2 }, { 0xd9, 0x8d, 0x00, 2 }, { 0xd9, 0x8e, 0x00, 2 }, { 0xd9, 0x8f, 0x00, 2 },
+  { 0xd9, 0x90, 0x00, 2 }, { 0xd9, 0x91, 0x00, 2 }, { 0xd9, 0x92, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+};
+
+static const guint8 encode_index_9[256] =
+{
+  1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const guint8 encode_pages_9[3][256] =
+{
+  { 0 },
+  /* U+0000 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f,
+    0xa0, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+0600 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x00, 0xbf,
+    0x00, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+    0xd0, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xe0, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef,
+    0xf0, 0xf1, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+};
+
+
+/* ISO_8859-7:1987, from iso8859_7 */
+static const guint8 decode_10[256][4] =
+{
+  { 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+  { 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+  { 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+  { 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+  { 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+  { 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+  { 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+  { 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+  { 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+  { 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+  { 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+  { 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+  { 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+  { 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+  { 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+  { 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+  { 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+  { 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+  { 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+  { 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+  { 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+  { 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+  { 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+  { 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+  { 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+  { 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+  { 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+  { 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+  { 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+  { 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+  { 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+  { 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+  { 0xc2, 0x80, 0x00, 2 }, { 0xc2, 0x81, 0x00, 2 }, { 0xc2, 0x82, 0x00, 2 }, { 0xc2, 0x83, 0x00, 2 },
+  { 0xc2, 0x84, 0x00, 2 }, { 0xc2, 0x85, 0x00, 2 }, { 0xc2, 0x86, 0x00, 2 }, { 0xc2, 0x87, 0x00, 2 },
+  { 0xc2, 0x88, 0x00, 2 }, { 0xc2, 0x89, 0x00, 2 }, { 0xc2, 0x8a, 0x00, 2 }, { 0xc2, 0x8b, 0x00, 2 },
+  { 0xc2, 0x8c, 0x00, 2 }, { 0xc2, 0x8d, 0x00, 2 }, { 0xc2, 0x8e, 0x00, 2 }, { 0xc2, 0x8f, 0x00, 2 },
+  { 0xc2, 0x90, 0x00, 2 }, { 0xc2, 0x91, 0x00, 2 }, { 0xc2, 0x92, 0x00, 2 }, { 0xc2, 0x93, 0x00, 2 },
+  { 0xc2, 0x94, 0x00, 2 }, { 0xc2, 0x95, 0x00, 2 }, { 0xc2, 0x96, 0x00, 2 }, { 0xc2, 0x97, 0x00, 2 },
+  { 0xc2, 0x98, 0x00, 2 }, { 0xc2, 0x99, 0x00, 2 }, { 0xc2, 0x9a, 0x00, 2 }, { 0xc2, 0x9b, 0x00, 2 },
+  { 0xc2, 0x9c, 0x00, 2 }, { 0xc2, 0x9d, 0x00, 2 }, { 0xc2, 0x9e, 0x00, 2 }, { 0xc2, 0x9f, 0x00, 2 },
+  { 0xc2, 0xa0, 0x00, 2 }, { 0xe2, 0x80, 0x98, 3 }, { 0xe2, 0x80, 0x99, 3 }, { 0xc2, 0xa3, 0x00, 2 },
+  { 0xe2, 0x82, 0xac, 3 }, { 0xe2, 0x82, 0xaf, 3 }, { 0xc2, 0xa6, 0x00, 2 }, { 0xc2, 0xa7, 0x00, 2 },
+  { 0xc2, 0xa8, 0x00, 2 }, { 0xc2, 0xa9, 0x00, 2 }, { 0xcd, 0xba, 0x00, 2 }, { 0xc2, 0xab, 0x00, 2 },
+  { 0xc2, 0xac, 0x00, 2 }, { 0xc2, 0xad, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 }, { 0xe2, 0x80, 0x95, 3 },
+  { 0xc2, 0xb0, 0x00, 2 }, { 0xc2, 0xb1, 0x00, 2 }, { 0xc2, 0xb2, 0x00, 2 }, { 0xc2, 0xb3, 0x00, 2 },
+  { 0xce, 0x84, 0x00, 2 }, { 0xce, 0x85, 0x00, 2 }, { 0xce, 0x86, 0x00, 2 }, { 0xc2, 0xb7, 0x00, 2 },
+  { 0xce, 0x88, 0x00, 2 }, { 0xce, 0x89, 0x00, 2 }, { 0xce, 0x8a, 0x00, 2 }, { 0xc2, 0xbb, 0x00, 2 },
+  { 0xce, 0x8c, 0x00, 2 }, { 0xc2, 0xbd, 0x00, 2 }, { 0xce, 0x8e, 0x00, 2 }, { 0xce, 0x8f, 0x00, 2 },
+  { 0xce, 0x90, 0x00, 2 }, { 0xce, 0x91, 0x00, 2 }, { 0xce, 0x92, 0x00, 2 }, { 0xce, 0x93, 0x00, 2 },
+  { 0xce, 0x94, 0x00, 2 }, { 0xce, 0x95, 0x00, 2 }, { 0xce, 0x96, 0x00, 2 }, { 0xce, 0x97, 0x00, 2 },
+  { 0xce, 0x98, 0x00, 2 }, { 0xce, 0x99, 0x00, 2 }, { 0xce, 0x9a, 0x00, 2 }, { 0xce, 0x9b, 0x00, 2 },
+  { 0xce, 0x9c, 0x00, 2 }, { 0xce, 0x9d, 0x00, 2 }, { 0xce, 0x9e, 0x00, 2 }, { 0xce, 0x9f, 0x00, 2 },
+  { 0xce, 0xa0, 0x00, 2 }, { 0xce, 0xa1, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 }, { 0xce, 0xa3, 0x00, 2 },
+  { 0xce, 0xa4, 0x00, 2 }, { 0xce, 0xa5, 0x00, 2 }, { 0xce, 0xa6, 0x00, 2 }, { 0xce, 0xa7, 0x00, 2 },
+  { 0xce, 0xa8, 0x00, 2 }, { 0xce, 0xa9, 0x00, 2 }, { 0xce, 0xaa, 0x00, 2 }, { 0xce, 0xab, 0x00, 2 },
+  { 0xce, 0xac, 0x00, 2 }, { 0xce, 0xad, 0x00, 2 }, { 0xce, 0xae, 0x00, 2 }, { 0xce, 0xaf, 0x00, 2 },
+  { 0xce, 0xb0, 0x00, 2 }, { 0xce, 0xb1, 0x00, 2 }, { 0xce, 0xb2, 0x00, 2 }, { 0xce, 0xb3, 0x00, 2 },
+  { 0xce, 0xb4, 0x00, 2 }, { 0xce, 0xb5, 0x00, 2 }, { 0xce, 0xb6, 0x00, 2 }, { 0xce, 0xb7, 0x00, 2 },
+  { 0xce, 0xb8, 0x00, 2 }, { 0xce, 0xb9, 0x00, 2 }, { 0xce, 0xba, 0x00, 2 }, { 0xce, 0xbb, 0x00, 2 },
+  { 0xce, 0xbc, 0x00, 2 }, { 0xce, 0xbd, 0x00, 2 }, { 0xce, 0xbe, 0x00, 2 }, { 0xce, 0xbf, 0x00, 2 },
+  { 0xcf, 0x80, 0x00, 2 }, { 0xcf, 0x81, 0x00, 2 }, { 0xcf, 0x82, 0x00, 2 }, { 0xcf, 0x83, 0x00, 2 },
+  { 0xcf, 0x84, 0x00, 2 }, { 0xcf, 0x85, 0x00, 2 }, { 0xcf, 0x86, 0x00, 2 }, { 0xcf, 0x87, 0x00, 2 },
+  { 0xcf, 0x88, 0x00, 2 }, { 0xcf, 0x89, 0x00, 2 }, { 0xcf, 0x8a, 0x00, 2 }, { 0xcf, 0x8b, 0x00, 2 },
+  { 0xcf, 0x8c, 0x00, 2 }, { 0xcf, 0x8d, 0x00, 2 }, { 0xcf, 0x8e, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 },
+};
+
+static const guint8 encode_index_10[256] =
+{
+  1, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const guint8 encode_pages_10[4][256] =
+{
+  { 0 },
+  /* U+0000 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f,
+    0xa0, 0x00, 0x00, 0xa3, 0x00, 0x00, 0xa6, 0xa7, 0xa8, 0xa9, 0x00, 0xab, 0xac, 0xad, 0x00, 0x00,
+    0xb0, 0xb1, 0xb2, 0xb3, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0xbb, 0x00, 0xbd, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+0300 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xb4, 0xb5, 0xb6, 0x00, 0xb8, 0xb9, 0xba, 0x00, 0xbc, 0x00, 0xbe, 0xbf,
+    0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+    0xd0, 0xd1, 0x00, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xdb, 0xdc, 0xdd, 0xde, 0xdf,
+    0xe0, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+2000 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xaf, 0x00, 0x00, 0xa1, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0xa5,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+};
+
+
+/* ISO_8859-8:1988, from iso8859_8 */
+static const guint8 decode_11[256][4] =
+{
+  { 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+  { 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+  { 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+  { 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+  { 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+  { 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+  { 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+  { 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+  { 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+  { 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+  { 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+  { 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+  { 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+  { 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+  { 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+  { 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+  { 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+  { 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+  { 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+  { 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+  { 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+  { 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+  { 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+  { 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+  { 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+  { 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+  { 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+  { 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+  { 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+  { 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+  { 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+  { 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+  { 0xc2, 0x80, 0x00, 2 }, { 0xc2, 0x81, 0x00, 2 }, { 0xc2, 0x82, 0x00, 2 }, { 0xc2, 0x83, 0x00, 2 },
+  { 0xc2, 0x84, 0x00, 2 }, { 0xc2, 0x85, 0x00, 2 }, { 0xc2, 0x86, 0x00, 2 }, { 0xc2, 0x87, 0x00, 2 },
+  { 0xc2, 0x88, 0x00, 2 }, { 0xc2, 0x89, 0x00, 2 }, { 0xc2, 0x8a, 0x00, 2 }, { 0xc2, 0x8b, 0x00, 2 },
+  { 0xc2, 0x8c, 0x00, 2 }, { 0xc2, 0x8d, 0x00, 2 }, { 0xc2, 0x8e, 0x00, 2 }, { 0xc2, 0x8f, 0x00, 2 },
+  { 0xc2, 0x90, 0x00, 2 }, { 0xc2, 0x91, 0x00, 2 }, { 0xc2, 0x92, 0x00, 2 }, { 0xc2, 0x93, 0x00, 2 },
+  { 0xc2, 0x94, 0x00, 2 }, { 0xc2, 0x95, 0x00, 2 }, { 0xc2, 0x96, 0x00, 2 }, { 0xc2, 0x97, 0x00, 2 },
+  { 0xc2, 0x98, 0x00, 2 }, { 0xc2, 0x99, 0x00, 2 }, { 0xc2, 0x9a, 0x00, 2 }, { 0xc2, 0x9b, 0x00, 2 },
+  { 0xc2, 0x9c, 0x00, 2 }, { 0xc2, 0x9d, 0x00, 2 }, { 0xc2, 0x9e, 0x00, 2 }, { 0xc2, 0x9f, 0x00, 2 },
+  { 0xc2, 0xa0, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 }, { 0xc2, 0xa2, 0x00, 2 }, { 0xc2, 0xa3, 0x00, 2 },
+  { 0xc2, 0xa4, 0x00, 2 }, { 0xc2, 0xa5, 0x00, 2 }, { 0xc2, 0xa6, 0x00, 2 }, { 0xc2, 0xa7, 0x00, 2 },
+  { 0xc2, 0xa8, 0x00, 2 }, { 0xc2, 0xa9, 0x00, 2 }, { 0xc3, 0x97, 0x00, 2 }, { 0xc2, 0xab, 0x00, 2 },
+  { 0xc2, 0xac, 0x00, 2 }, { 0xc2, 0xad, 0x00, 2 }, { 0xc2, 0xae, 0x00, 2 }, { 0xc2, 0xaf, 0x00, 2 },
+  { 0xc2, 0xb0, 0x00, 2 }, { 0xc2, 0xb1, 0x00, 2 }, { 0xc2, 0xb2, 0x00, 2 }, { 0xc2, 0xb3, 0x00, 2 },
+  { 0xc2, 0xb4, 0x00, 2 }, { 0xc2, 0xb5, 0x00, 2 }, { 0xc2, 0xb6, 0x00, 2 }, { 0xc2, 0xb7, 0x00, 2 },
+  { 0xc2, 0xb8, 0x00, 2 }, { 0xc2, 0xb9, 0x00, 2 }, { 0xc3, 0xb7, 0x00, 2 }, { 0xc2, 0xbb, 0x00, 2 },
+  { 0xc2, 0xbc, 0x00, 2 }, { 0xc2, 0xbd, 0x00, 2 }, { 0xc2, 0xbe, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0xe2, 0x80, 0x97, 3 },
+  { 0xd7, 0x90, 0x00, 2 }, { 0xd7, 0x91, 0x00, 2 }, { 0xd7, 0x92, 0x00, 2 }, { 0xd7, 0x93, 0x00, 2 },
+  { 0xd7, 0x94, 0x00, 2 }, { 0xd7, 0x95, 0x00, 2 }, { 0xd7, 0x96, 0x00, 2 }, { 0xd7, 0x97, 0x00, 2 },
+  { 0xd7, 0x98, 0x00, 2 }, { 0xd7, 0x99, 0x00, 2 }, { 0xd7, 0x9a, 0x00, 2 }, { 0xd7, 0x9b, 0x00, 2 },
+  { 0xd7, 0x9c, 0x00, 2 }, { 0xd7, 0x9d, 0x00, 2 }, { 0xd7, 0x9e, 0x00, 2 }, { 0xd7, 0x9f, 0x00, 2 },
+  { 0xd7, 0xa0, 0x00, 2 }, { 0xd7, 0xa1, 0x00, 2 }, { 0xd7, 0xa2, 0x00, 2 }, { 0xd7, 0xa3, 0x00, 2 },
+  { 0xd7, 0xa4, 0x00, 2 }, { 0xd7, 0xa5, 0x00, 2 }, { 0xd7, 0xa6, 0x00, 2 }, { 0xd7, 0xa7, 0x00, 2 },
+  { 0xd7, 0xa8, 0x00, 2 }, { 0xd7, 0xa9, 0x00, 2 }, { 0xd7, 0xaa, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0xe2, 0x80, 0x8e, 3 }, { 0xe2, 0x80, 0x8f, 3 }, { 0x00, 0x00, 0x00, 0 },
+};
+
+static const guint8 encode_index_11[256] =
+{
+  1, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const guint8 encode_pages_11[4][256] =
+{
+  { 0 },
+  /* U+0000 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f,
+    0xa0, 0x00, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0x00, 0xab, 0xac, 0xad, 0xae, 0xaf,
+    0xb0, 0xb1, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0x00, 0xbb, 0xbc, 0xbd, 0xbe, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+0500 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xe0, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+2000 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xfe,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+};
+
+
+/* ISO_8859-9:1989, from iso8859_9 */
+static const guint8 decode_12[256][4] =
+{
+  { 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+  { 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+  { 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+  { 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+  { 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+  { 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+  { 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+  { 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+  { 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+  { 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+  { 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+  { 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+  { 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+  { 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+  { 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+  { 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+  { 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+  { 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+  { 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+  { 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+  { 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+  { 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+  { 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+  { 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+  { 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+  { 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+  { 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+  { 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+  { 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+  { 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+  { 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+  { 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+  { 0xc2, 0x80, 0x00, 2 }, { 0xc2, 0x81, 0x00, 2 }, { 0xc2, 0x82, 0x00, 2 }, { 0xc2, 0x83, 0x00, 2 },
+  { 0xc2, 0x84, 0x00, 2 }, { 0xc2, 0x85, 0x00, 2 }, { 0xc2, 0x86, 0x00, 2 }, { 0xc2, 0x87, 0x00, 2 },
+  { 0xc2, 0x88, 0x00, 2 }, { 0xc2, 0x89, 0x00, 2 }, { 0xc2, 0x8a, 0x00, 2 }, { 0xc2, 0x8b, 0x00, 2 },
+  { 0xc2, 0x8c, 0x00, 2 }, { 0xc2, 0x8d, 0x00, 2 }, { 0xc2, 0x8e, 0x00, 2 }, { 0xc2, 0x8f, 0x00, 2 },
+  { 0xc2, 0x90, 0x00, 2 }, { 0xc2, 0x91, 0x00, 2 }, { 0xc2, 0x92, 0x00, 2 }, { 0xc2, 0x93, 0x00, 2 },
+  { 0xc2, 0x94, 0x00, 2 }, { 0xc2, 0x95, 0x00, 2 }, { 0xc2, 0x96, 0x00, 2 }, { 0xc2, 0x97, 0x00, 2 },
+  { 0xc2, 0x98, 0x00, 2 }, { 0xc2, 0x99, 0x00, 2 }, { 0xc2, 0x9a, 0x00, 2 }, { 0xc2, 0x9b, 0x00, 2 },
+  { 0xc2, 0x9c, 0x00, 2 }, { 0xc2, 0x9d, 0x00, 2 }, { 0xc2, 0x9e, 0x00, 2 }, { 0xc2, 0x9f, 0x00, 2 },
+  { 0xc2, 0xa0, 0x00, 2 }, { 0xc2, 0xa1, 0x00, 2 }, { 0xc2, 0xa2, 0x00, 2 }, { 0xc2, 0xa3, 0x00, 2 },
+  { 0xc2, 0xa4, 0x00, 2 }, { 0xc2, 0xa5, 0x00, 2 }, { 0xc2, 0xa6, 0x00, 2 }, { 0xc2, 0xa7, 0x00, 2 },
+  { 0xc2, 0xa8, 0x00, 2 }, { 0xc2, 0xa9, 0x00, 2 }, { 0xc2, 0xaa, 0x00, 2 }, { 0xc2, 0xab, 0x00, 2 },
+  { 0xc2, 0xac, 0x00, 2 }, { 0xc2, 0xad, 0x00, 2 }, { 0xc2, 0xae, 0x00, 2 }, { 0xc2, 0xaf, 0x00, 2 },
+  { 0xc2, 0xb0, 0x00, 2 }, { 0xc2, 0xb1, 0x00, 2 }, { 0xc2, 0xb2, 0x00, 2 }, { 0xc2, 0xb3, 0x00, 2 },
+  { 0xc2, 0xb4, 0x00, 2 }, { 0xc2, 0xb5, 0x00, 2 }, { 0xc2, 0xb6, 0x00, 2 }, { 0xc2, 0xb7, 0x00, 2 },
+  { 0xc2, 0xb8, 0x00, 2 }, { 0xc2, 0xb9, 0x00, 2 }, { 0xc2, 0xba, 0x00, 2 }, { 0xc2, 0xbb, 0x00, 2 },
+  { 0xc2, 0xbc, 0x00, 2 }, { 0xc2, 0xbd, 0x00, 2 }, { 0xc2, 0xbe, 0x00, 2 }, { 0xc2, 0xbf, 0x00, 2 },
+  { 0xc3, 0x80, 0x00, 2 }, { 0xc3, 0x81, 0x00, 2 }, { 0xc3, 0x82, 0x00, 2 }, { 0xc3, 0x83, 0x00, 2 },
+  { 0xc3, 0x84, 0x00, 2 }, { 0xc3, 0x85, 0x00, 2 }, { 0xc3, 0x86, 0x00, 2 }, { 0xc3, 0x87, 0x00, 2 },
+  { 0xc3, 0x88, 0x00, 2 }, { 0xc3, 0x89, 0x00, 2 }, { 0xc3, 0x8a, 0x00, 2 }, { 0xc3, 0x8b, 0x00, 2 },
+  { 0xc3, 0x8c, 0x00, 2 }, { 0xc3, 0x8d, 0x00, 2 }, { 0xc3, 0x8e, 0x00, 2 }, { 0xc3, 0x8f, 0x00, 2 },
+  { 0xc4, 0x9e, 0x00, 2 }, { 0xc3, 0x91, 0x00, 2 }, { 0xc3, 0x92, 0x00, 2 }, { 0xc3, 0x93, 0x00, 2 },
+  { 0xc3, 0x94, 0x00, 2 }, { 0xc3, 0x95, 0x00, 2 }, { 0xc3, 0x96, 0x00, 2 }, { 0xc3, 0x97, 0x00, 2 },
+  { 0xc3, 0x98, 0x00, 2 }, { 0xc3, 0x99, 0x00, 2 }, { 0xc3, 0x9a, 0x00, 2 }, { 0xc3, 0x9b, 0x00, 2 },
+  { 0xc3, 0x9c, 0x00, 2 }, { 0xc4, 0xb0, 0x00, 2 }, { 0xc5, 0x9e, 0x00, 2 }, { 0xc3, 0x9f, 0x00, 2 },
+  { 0xc3, 0xa0, 0x00, 2 }, { 0xc3, 0xa1, 0x00, 2 }, { 0xc3, 0xa2, 0x00, 2 }, { 0xc3, 0xa3, 0x00, 2 },
+  { 0xc3, 0xa4, 0x00, 2 }, { 0xc3, 0xa5, 0x00, 2 }, { 0xc3, 0xa6, 0x00, 2 }, { 0xc3, 0xa7, 0x00, 2 },
+  { 0xc3, 0xa8, 0x00, 2 }, { 0xc3, 0xa9, 0x00, 2 }, { 0xc3, 0xaa, 0x00, 2 }, { 0xc3, 0xab, 0x00, 2 },
+  { 0xc3, 0xac, 0x00, 2 }, { 0xc3, 0xad, 0x00, 2 }, { 0xc3, 0xae, 0x00, 2 }, { 0xc3, 0xaf, 0x00, 2 },
+  { 0xc4, 0x9f, 0x00, 2 }, { 0xc3, 0xb1, 0x00, 2 }, { 0xc3, 0xb2, 0x00, 2 }, { 0xc3, 0xb3, 0x00, 2 },
+  { 0xc3, 0xb4, 0x00, 2 }, { 0xc3, 0xb5, 0x00, 2 }, { 0xc3, 0xb6, 0x00, 2 }, { 0xc3, 0xb7, 0x00, 2 },
+  { 0xc3, 0xb8, 0x00, 2 }, { 0xc3, 0xb9, 0x00, 2 }, { 0xc3, 0xba, 0x00, 2 }, { 0xc3, 0xbb, 0x00, 2 },
+  { 0xc3, 0xbc, 0x00, 2 }, { 0xc4, 0xb1, 0x00, 2 }, { 0xc5, 0x9f, 0x00, 2 }, { 0xc3, 0xbf, 0x00, 2 },
+};
+
+static const guint8 encode_index_12[256] =
+{
+  1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const guint8 encode_pages_12[3][256] =
+{
+  { 0 },
+  /* U+0000 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f,
+    0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf,
+    0xb0, 0xb1, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xbb, 0xbc, 0xbd, 0xbe, 0xbf,
+    0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+    0x00, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xdb, 0xdc, 0x00, 0x00, 0xdf,
+    0xe0, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef,
+    0x00, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0x00, 0x00, 0xff,
+  },
+  /* U+0100 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xf0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xdd, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xfe,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+};
+
+
+/* ISO-8859-10, from iso8859_10 */
+static const guint8 decode_13[256][4] =
+{
+  { 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+  { 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+  { 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+  { 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+  { 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+  { 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+  { 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+  { 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+  { 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+  { 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+  { 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+  { 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+  { 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+  { 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+  { 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+  { 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+  { 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+  { 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+  { 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+  { 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+  { 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+  { 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+  { 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+  { 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+  { 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+  { 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+  { 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+  { 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+  { 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+  { 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+  { 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+  { 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+  { 0xc2, 0x80, 0x00, 2 }, { 0xc2, 0x81, 0x00, 2 }, { 0xc2, 0x82, 0x00, 2 }, { 0xc2, 0x83, 0x00, 2 },
+  { 0xc2, 0x84, 0x00, 2 }, { 0xc2, 0x85, 0x00, 2 }, { 0xc2, 0x86, 0x00, 2 }, { 0xc2, 0x87, 0x00, 2 },
+  { 0xc2, 0x88, 0x00, 2 }, { 0xc2, 0x89, 0x00, 2 }, { 0xc2, 0x8a, 0x00, 2 }, { 0xc2, 0x8b, 0x00, 2 },
+  { 0xc2, 0x8c, 0x00, 2 }, { 0xc2, 0x8d, 0x00, 2 }, { 0xc2, 0x8e, 0x00, 2 }, { 0xc2, 0x8f, 0x00, 2 },
+  { 0xc2, 0x90, 0x00, 2 }, { 0xc2, 0x91, 0x00, 2 }, { 0xc2, 0x92, 0x00, 2 }, { 0xc2, 0x93, 0x00, 2 },
+  { 0xc2, 0x94, 0x00, 2 }, { 0xc2, 0x95, 0x00, 2 }, { 0xc2, 0x96, 0x00, 2 }, { 0xc2, 0x97, 0x00, 2 },
+  { 0xc2, 0x98, 0x00, 2 }, { 0xc2, 0x99, 0x00, 2 }, { 0xc2, 0x9a, 0x00, 2 }, { 0xc2, 0x9b, 0x00, 2 },
+  { 0xc2, 0x9c, 0x00, 2 }, { 0xc2, 0x9d, 0x00, 2 }, { 0xc2, 0x9e, 0x00, 2 }, { 0xc2, 0x9f, 0x00, 2 },
+  { 0xc2, 0xa0, 0x00, 2 }, { 0xc4, 0x84, 0x00, 2 }, { 0xc4, 0x92, 0x00, 2 }, { 0xc4, 0xa2, 0x00, 2 },
+  { 0xc4, 0xaa, 0x00, 2 }, { 0xc4, 0xa8, 0x00, 2 }, { 0xc4, 0xb6, 0x00, 2 }, { 0xc2, 0xa7, 0x00, 2 },
+  { 0xc4, 0xbb, 0x00, 2 }, { 0xc4, 0x90, 0x00, 2 }, { 0xc5, 0xa0, 0x00, 2 }, { 0xc5, 0xa6, 0x00, 2 },
+  { 0xc5, 0xbd, 0x00, 2 }, { 0xc2, 0xad, 0x00, 2 }, { 0xc5, 0xaa, 0x00, 2 }, { 0xc5, 0x8a, 0x00, 2 },
+  { 0xc2, 0xb0, 0x00, 2 }, { 0xc4, 0x85, 0x00, 2 }, { 0xc4, 0x93, 0x00, 2 }, { 0xc4, 0xa3, 0x00, 2 },
+  { 0xc4, 0xab, 0x00, 2 }, { 0xc4, 0xa9, 0x00, 2 }, { 0xc4, 0xb7, 0x00, 2 }, { 0xc2, 0xb7, 0x00, 2 },
+  { 0xc4, 0xbc, 0x00, 2 }, { 0xc4, 0x91, 0x00, 2 }, { 0xc5, 0xa1, 0x00, 2 }, { 0xc5, 0xa7, 0x00, 2 },
+  { 0xc5, 0xbe, 0x00, 2 }, { 0xe2, 0x80, 0x95, 3 }, { 0xc5, 0xab, 0x00, 2 }, { 0xc5, 0x8b, 0x00, 2 },
+  { 0xc4, 0x80, 0x00, 2 }, { 0xc3, 0x81, 0x00, 2 }, { 0xc3, 0x82, 0x00, 2 }, { 0xc3, 0x83, 0x00, 2 },
+  { 0xc3, 0x84, 0x00, 2 }, { 0xc3, 0x85, 0x00, 2 }, { 0xc3, 0x86, 0x00, 2 }, { 0xc4, 0xae, 0x00, 2 },
+  { 0xc4, 0x8c, 0x00, 2 }, { 0xc3, 0x89, 0x00, 2 }, { 0xc4, 0x98, 0x00, 2 }, { 0xc3, 0x8b, 0x00, 2 },
+  { 0xc4, 0x96, 0x00, 2 }, { 0xc3, 0x8d, 0x00, 2 }, { 0xc3, 0x8e, 0x00, 2 }, { 0xc3, 0x8f, 0x00, 2 },
+  { 0xc3, 0x90, 0x00, 2 }, { 0xc5, 0x85, 0x00, 2 }, { 0xc5, 0x8c, 0x00, 2 }, { 0xc3, 0x93, 0x00, 2 },
+  { 0xc3, 0x94, 0x00, 2 }, { 0xc3, 0x95, 0x00, 2 }, { 0xc3, 0x96, 0x00, 2 }, { 0xc5, 0xa8, 0x00, 2 },
+  { 0xc3, 0x98, 0x00, 2 }, { 0xc5, 0xb2, 0x00, 2 }, { 0xc3, 0x9a, 0x00, 2 }, { 0xc3, 0x9b, 0x00, 2 },
+  { 0xc3, 0x9c, 0x00, 2 }, { 0xc3, 0x9d, 0x00, 2 }, { 0xc3, 0x9e, 0x00, 2 }, { 0xc3, 0x9f, 0x00, 2 },
+  { 0xc4, 0x81, 0x00, 2 }, { 0xc3, 0xa1, 0x00, 2 }, { 0xc3, 0xa2, 0x00, 2 }, { 0xc3, 0xa3, 0x00, 2 },
+  { 0xc3, 0xa4, 0x00, 2 }, { 0xc3, 0xa5, 0x00, 2 }, { 0xc3, 0xa6, 0x00, 2 }, { 0xc4, 0xaf, 0x00, 2 },
+  { 0xc4, 0x8d, 0x00, 2 }, { 0xc3, 0xa9, 0x00, 2 }, { 0xc4, 0x99, 0x00, 2 }, { 0xc3, 0xab, 0x00, 2 },
+  { 0xc4, 0x97, 0x00, 2 }, { 0xc3, 0xad, 0x00, 2 }, { 0xc3, 0xae, 0x00, 2 }, { 0xc3, 0xaf, 0x00, 2 },
+  { 0xc3, 0xb0, 0x00, 2 }, { 0xc5, 0x86, 0x00, 2 }, { 0xc5, 0x8d, 0x00, 2 }, { 0xc3, 0xb3, 0x00, 2 },
+  { 0xc3, 0xb4, 0x00, 2 }, { 0xc3, 0xb5, 0x00, 2 }, { 0xc3, 0xb6, 0x00, 2 }, { 0xc5, 0xa9, 0x00, 2 },
+  { 0xc3, 0xb8, 0x00, 2 }, { 0xc5, 0xb3, 0x00, 2 }, { 0xc3, 0xba, 0x00, 2 }, { 0xc3, 0xbb, 0x00, 2 },
+  { 0xc3, 0xbc, 0x00, 2 }, { 0xc3, 0xbd, 0x00, 2 }, { 0xc3, 0xbe, 0x00, 2 }, { 0xc4, 0xb8, 0x00, 2 },
+};
+
+static const guint8 encode_index_13[256] =
+{
+  1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const guint8 encode_pages_13[4][256] =
+{
+  { 0 },
+  /* U+0000 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f,
+    0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0xad, 0x00, 0x00,
+    0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0x00, 0x00, 0xc9, 0x00, 0xcb, 0x00, 0xcd, 0xce, 0xcf,
+    0xd0, 0x00, 0x00, 0xd3, 0xd4, 0xd5, 0xd6, 0x00, 0xd8, 0x00, 0xda, 0xdb, 0xdc, 0xdd, 0xde, 0xdf,
+    0x00, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0x00, 0x00, 0xe9, 0x00, 0xeb, 0x00, 0xed, 0xee, 0xef,
+    0xf0, 0x00, 0x00, 0xf3, 0xf4, 0xf5, 0xf6, 0x00, 0xf8, 0x00, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0x00,
+  },
+  /* U+0100 */
+  {
+    0xc0, 0xe0, 0x00, 0x00, 0xa1, 0xb1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xe8, 0x00, 0x00,
+    0xa9, 0xb9, 0xa2, 0xb2, 0x00, 0x00, 0xcc, 0xec, 0xca, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xa3, 0xb3, 0x00, 0x00, 0x00, 0x00, 0xa5, 0xb5, 0xa4, 0xb4, 0x00, 0x00, 0xc7, 0xe7,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xb6, 0xff, 0x00, 0x00, 0xa8, 0xb8, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xf1, 0x00, 0x00, 0x00, 0xaf, 0xbf, 0xd2, 0xf2, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xaa, 0xba, 0x00, 0x00, 0x00, 0x00, 0xab, 0xbb, 0xd7, 0xf7, 0xae, 0xbe, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xd9, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xac, 0xbc, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+2000 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+};
+
+
+/* ISO-8859-13, from iso8859_13 */
+static const guint8 decode_109[256][4] =
+{
+  { 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+  { 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+  { 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+  { 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+  { 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+  { 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+  { 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+  { 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+  { 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+  { 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+  { 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+  { 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+  { 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+  { 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+  { 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+  { 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+  { 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+  { 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+  { 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+  { 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+  { 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+  { 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+  { 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+  { 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+  { 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+  { 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+  { 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+  { 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+  { 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+  { 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+  { 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+  { 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+  { 0xc2, 0x80, 0x00, 2 }, { 0xc2, 0x81, 0x00, 2 }, { 0xc2, 0x82, 0x00, 2 }, { 0xc2, 0x83, 0x00, 2 },
+  { 0xc2, 0x84, 0x00, 2 }, { 0xc2, 0x85, 0x00, 2 }, { 0xc2, 0x86, 0x00, 2 }, { 0xc2, 0x87, 0x00, 2 },
+  { 0xc2, 0x88, 0x00, 2 }, { 0xc2, 0x89, 0x00, 2 }, { 0xc2, 0x8a, 0x00, 2 }, { 0xc2, 0x8b, 0x00, 2 },
+  { 0xc2, 0x8c, 0x00, 2 }, { 0xc2, 0x8d, 0x00, 2 }, { 0xc2, 0x8e, 0x00, 2 }, { 0xc2, 0x8f, 0x00, 2 },
+  { 0xc2, 0x90, 0x00, 2 }, { 0xc2, 0x91, 0x00, 2 }, { 0xc2, 0x92, 0x00, 2 }, { 0xc2, 0x93, 0x00, 2 },
+  { 0xc2, 0x94, 0x00, 2 }, { 0xc2, 0x95, 0x00, 2 }, { 0xc2, 0x96, 0x00, 2 }, { 0xc2, 0x97, 0x00, 2 },
+  { 0xc2, 0x98, 0x00, 2 }, { 0xc2, 0x99, 0x00, 2 }, { 0xc2, 0x9a, 0x00, 2 }, { 0xc2, 0x9b, 0x00, 2 },
+  { 0xc2, 0x9c, 0x00, 2 }, { 0xc2, 0x9d, 0x00, 2 }, { 0xc2, 0x9e, 0x00, 2 }, { 0xc2, 0x9f, 0x00, 2 },
+  { 0xc2, 0xa0, 0x00, 2 }, { 0xe2, 0x80, 0x9d, 3 }, { 0xc2, 0xa2, 0x00, 2 }, { 0xc2, 0xa3, 0x00, 2 },
+  { 0xc2, 0xa4, 0x00, 2 }, { 0xe2, 0x80, 0x9e, 3 }, { 0xc2, 0xa6, 0x00, 2 }, { 0xc2, 0xa7, 0x00, 2 },
+  { 0xc3, 0x98, 0x00, 2 }, { 0xc2, 0xa9, 0x00, 2 }, { 0xc5, 0x96, 0x00, 2 }, { 0xc2, 0xab, 0x00, 2 },
+  { 0xc2, 0xac, 0x00, 2 }, { 0xc2, 0xad, 0x00, 2 }, { 0xc2, 0xae, 0x00, 2 }, { 0xc3, 0x86, 0x00, 2 },
+  { 0xc2, 0xb0, 0x00, 2 }, { 0xc2, 0xb1, 0x00, 2 }, { 0xc2, 0xb2, 0x00, 2 }, { 0xc2, 0xb3, 0x00, 2 },
+  { 0xe2, 0x80, 0x9c, 3 }, { 0xc2, 0xb5, 0x00, 2 }, { 0xc2, 0xb6, 0x00, 2 }, { 0xc2, 0xb7, 0x00, 2 },
+  { 0xc3, 0xb8, 0x00, 2 }, { 0xc2, 0xb9, 0x00, 2 }, { 0xc5, 0x97, 0x00, 2 }, { 0xc2, 0xbb, 0x00, 2 },
+  { 0xc2, 0xbc, 0x00, 2 }, { 0xc2, 0xbd, 0x00, 2 }, { 0xc2, 0xbe, 0x00, 2 }, { 0xc3, 0xa6, 0x00, 2 },
+  { 0xc4, 0x84, 0x00, 2 }, { 0xc4, 0xae, 0x00, 2 }, { 0xc4, 0x80, 0x00, 2 }, { 0xc4, 0x86, 0x00, 2 },
+  { 0xc3, 0x84, 0x00, 2 }, { 0xc3, 0x85, 0x00, 2 }, { 0xc4, 0x98, 0x00, 2 }, { 0xc4, 0x92, 0x00, 2 },
+  { 0xc4, 0x8c, 0x00, 2 }, { 0xc3, 0x89, 0x00, 2 }, { 0xc5, 0xb9, 0x00, 2 }, { 0xc4, 0x96, 0x00, 2 },
+  { 0xc4, 0xa2, 0x00, 2 }, { 0xc4, 0xb6, 0x00, 2 }, { 0xc4, 0xaa, 0x00, 2 }, { 0xc4, 0xbb, 0x00, 2 },
+  { 0xc5, 0xa0, 0x00, 2 }, { 0xc5, 0x83, 0x00, 2 }, { 0xc5, 0x85, 0x00, 2 }, { 0xc3, 0x93, 0x00, 2 },
+  { 0xc5, 0x8c, 0x00, 2 }, { 0xc3, 0x95, 0x00, 2 }, { 0xc3, 0x96, 0x00, 2 }, { 0xc3, 0x97, 0x00, 2 },
+  { 0xc5, 0xb2, 0x00, 2 }, { 0xc5, 0x81, 0x00, 2 }, { 0xc5, 0x9a, 0x00, 2 }, { 0xc5, 0xaa, 0x00, 2 },
+  { 0xc3, 0x9c, 0x00, 2 }, { 0xc5, 0xbb, 0x00, 2 }, { 0xc5, 0xbd, 0x00, 2 }, { 0xc3, 0x9f, 0x00, 2 },
+  { 0xc4, 0x85, 0x00, 2 }, { 0xc4, 0xaf, 0x00, 2 }, { 0xc4, 0x81, 0x00, 2 }, { 0xc4, 0x87, 0x00, 2 },
+  { 0xc3, 0xa4, 0x00, 2 }, { 0xc3, 0xa5, 0x00, 2 }, { 0xc4, 0x99, 0x00, 2 }, { 0xc4, 0x93, 0x00, 2 },
+  { 0xc4, 0x8d, 0x00, 2 }, { 0xc3, 0xa9, 0x00, 2 }, { 0xc5, 0xba, 0x00, 2 }, { 0xc4, 0x97, 0x00, 2 },
+  { 0xc4, 0xa3, 0x00, 2 }, { 0xc4, 0xb7, 0x00, 2 }, { 0xc4, 0xab, 0x00, 2 }, { 0xc4, 0xbc, 0x00, 2 },
+  { 0xc5, 0xa1, 0x00, 2 }, { 0xc5, 0x84, 0x00, 2 }, { 0xc5, 0x86, 0x00, 2 }, { 0xc3, 0xb3, 0x00, 2 },
+  { 0xc5, 0x8d, 0x00, 2 }, { 0xc3, 0xb5, 0x00, 2 }, { 0xc3, 0xb6, 0x00, 2 }, { 0xc3, 0xb7, 0x00, 2 },
+  { 0xc5, 0xb3, 0x00, 2 }, { 0xc5, 0x82, 0x00, 2 }, { 0xc5, 0x9b, 0x00, 2 }, { 0xc5, 0xab, 0x00, 2 },
+  { 0xc3, 0xbc, 0x00, 2 }, { 0xc5, 0xbc, 0x00, 2 }, { 0xc5, 0xbe, 0x00, 2 }, { 0xe2, 0x80, 0x99, 3 },
+};
+
+static const guint8 encode_index_109[256] =
+{
+  1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const guint8 encode_pages_109[4][256] =
+{
+  { 0 },
+  /* U+0000 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f,
+    0xa0, 0x00, 0xa2, 0xa3, 0xa4, 0x00, 0xa6, 0xa7, 0x00, 0xa9, 0x00, 0xab, 0xac, 0xad, 0xae, 0x00,
+    0xb0, 0xb1, 0xb2, 0xb3, 0x00, 0xb5, 0xb6, 0xb7, 0x00, 0xb9, 0x00, 0xbb, 0xbc, 0xbd, 0xbe, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc4, 0xc5, 0xaf, 0x00, 0x00, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xd3, 0x00, 0xd5, 0xd6, 0xd7, 0xa8, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0xdf,
+    0x00, 0x00, 0x00, 0x00, 0xe4, 0xe5, 0xbf, 0x00, 0x00, 0xe9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xf3, 0x00, 0xf5, 0xf6, 0xf7, 0xb8, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00,
+  },
+  /* U+0100 */
+  {
+    0xc2, 0xe2, 0x00, 0x00, 0xc0, 0xe0, 0xc3, 0xe3, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xe8, 0x00, 0x00,
+    0x00, 0x00, 0xc7, 0xe7, 0x00, 0x00, 0xcb, 0xeb, 0xc6, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xcc, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xee, 0x00, 0x00, 0xc1, 0xe1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xed, 0x00, 0x00, 0x00, 0xcf, 0xef, 0x00, 0x00, 0x00,
+    0x00, 0xd9, 0xf9, 0xd1, 0xf1, 0xd2, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xf4, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xba, 0x00, 0x00, 0xda, 0xfa, 0x00, 0x00, 0x00, 0x00,
+    0xd0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xfb, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xd8, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0xea, 0xdd, 0xfd, 0xde, 0xfe, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+2000 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0xb4, 0xa1, 0xa5, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+};
+
+
+/* ISO-8859-14, from iso8859_14 */
+static const guint8 decode_110[256][4] =
+{
+  { 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+  { 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+  { 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+  { 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+  { 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+  { 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+  { 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+  { 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+  { 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+  { 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+  { 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+  { 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+  { 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+  { 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+  { 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+  { 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+  { 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+  { 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+  { 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+  { 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+  { 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+  { 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+  { 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+  { 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+  { 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+  { 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+  { 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+  { 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+  { 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+  { 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+  { 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+  { 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+  { 0xc2, 0x80, 0x00, 2 }, { 0xc2, 0x81, 0x00, 2 }, { 0xc2, 0x82, 0x00, 2 }, { 0xc2, 0x83, 0x00, 2 },
+  { 0xc2, 0x84, 0x00, 2 }, { 0xc2, 0x85, 0x00, 2 }, { 0xc2, 0x86, 0x00, 2 }, { 0xc2, 0x87, 0x00, 2 },
+  { 0xc2, 0x88, 0x00, 2 }, { 0xc2, 0x89, 0x00, 2 }, { 0xc2, 0x8a, 0x00, 2 }, { 0xc2, 0x8b, 0x00, 2 },
+  { 0xc2, 0x8c, 0x00, 2 }, { 0xc2, 0x8d, 0x00, 2 }, { 0xc2, 0x8e, 0x00, 2 }, { 0xc2, 0x8f, 0x00, 2 },
+  { 0xc2, 0x90, 0x00, 2 }, { 0xc2, 0x91, 0x00, 2 }, { 0xc2, 0x92, 0x00, 2 }, { 0xc2, 0x93, 0x00, 2 },
+  { 0xc2, 0x94, 0x00, 2 }, { 0xc2, 0x95, 0x00, 2 }, { 0xc2, 0x96, 0x00, 2 }, { 0xc2, 0x97, 0x00, 2 },
+  { 0xc2, 0x98, 0x00, 2 }, { 0xc2, 0x99, 0x00, 2 }, { 0xc2, 0x9a, 0x00, 2 }, { 0xc2, 0x9b, 0x00, 2 },
+  { 0xc2, 0x9c, 0x00, 2 }, { 0xc2, 0x9d, 0x00, 2 }, { 0xc2, 0x9e, 0x00, 2 }, { 0xc2, 0x9f, 0x00, 2 },
+  { 0xc2, 0xa0, 0x00, 2 }, { 0xe1, 0xb8, 0x82, 3 }, { 0xe1, 0xb8, 0x83, 3 }, { 0xc2, 0xa3, 0x00, 2 },
+  { 0xc4, 0x8a, 0x00, 2 }, { 0xc4, 0x8b, 0x00, 2 }, { 0xe1, 0xb8, 0x8a, 3 }, { 0xc2, 0xa7, 0x00, 2 },
+  { 0xe1, 0xba, 0x80, 3 }, { 0xc2, 0xa9, 0x00, 2 }, { 0xe1, 0xba, 0x82, 3 }, { 0xe1, 0xb8, 0x8b, 3 },
+  { 0xe1, 0xbb, 0xb2, 3 }, { 0xc2, 0xad, 0x00, 2 }, { 0xc2, 0xae, 0x00, 2 }, { 0xc5, 0xb8, 0x00, 2 },
+  { 0xe1, 0xb8, 0x9e, 3 }, { 0xe1, 0xb8, 0x9f, 3 }, { 0xc4, 0xa0, 0x00, 2 }, { 0xc4, 0xa1, 0x00, 2 },
+  { 0xe1, 0xb9, 0x80, 3 }, { 0xe1, 0xb9, 0x81, 3 }, { 0xc2, 0xb6, 0x00, 2 }, { 0xe1, 0xb9, 0x96, 3 },
+  { 0xe1, 0xba, 0x81, 3 }, { 0xe1, 0xb9, 0x97, 3 }, { 0xe1, 0xba, 0x83, 3 }, { 0xe1, 0xb9, 0xa0, 3 },
+  { 0xe1, 0xbb, 0xb3, 3 }, { 0xe1, 0xba, 0x84, 3 }, { 0xe1, 0xba, 0x85, 3 }, { 0xe1, 0xb9, 0xa1, 3 },
+  { 0xc3, 0x80, 0x00, 2 }, { 0xc3, 0x81, 0x00, 2 }, { 0xc3, 0x82, 0x00, 2 }, { 0xc3, 0x83, 0x00, 2 },
+  { 0xc3, 0x84, 0x00, 2 }, { 0xc3, 0x85, 0x00, 2 }, { 0xc3, 0x86, 0x00, 2 }, { 0xc3, 0x87, 0x00, 2 },
+  { 0xc3, 0x88, 0x00, 2 }, { 0xc3, 0x89, 0x00, 2 }, { 0xc3, 0x8a, 0x00, 2 }, { 0xc3, 0x8b, 0x00, 2 },
+  { 0xc3, 0x8c, 0x00, 2 }, { 0xc3, 0x8d, 0x00, 2 }, { 0xc3, 0x8e, 0x00, 2 }, { 0xc3, 0x8f, 0x00, 2 },
+  { 0xc5, 0xb4, 0x00, 2 }, { 0xc3, 0x91, 0x00, 2 }, { 0xc3, 0x92, 0x00, 2 }, { 0xc3, 0x93, 0x00, 2 },
+  { 0xc3, 0x94, 0x00, 2 }, { 0xc3, 0x95, 0x00, 2 }, { 0xc3, 0x96, 0x00, 2 }, { 0xe1, 0xb9, 0xaa, 3 },
+  { 0xc3, 0x98, 0x00, 2 }, { 0xc3, 0x99, 0x00, 2 }, { 0xc3, 0x9a, 0x00, 2 }, { 0xc3, 0x9b, 0x00, 2 },
+  { 0xc3, 0x9c, 0x00, 2 }, { 0xc3, 0x9d, 0x00, 2 }, { 0xc5, 0xb6, 0x00, 2 }, { 0xc3, 0x9f, 0x00, 2 },
+  { 0xc3, 0xa0, 0x00, 2 }, { 0xc3, 0xa1, 0x00, 2 }, { 0xc3, 0xa2, 0x00, 2 }, { 0xc3, 0xa3, 0x00, 2 },
+  { 0xc3, 0xa4, 0x00, 2 }, { 0xc3, 0xa5, 0x00, 2 }, { 0xc3, 0xa6, 0x00, 2 }, { 0xc3, 0xa7, 0x00, 2 },
+  { 0xc3, 0xa8, 0x00, 2 }, { 0xc3, 0xa9, 0x00, 2 }, { 0xc3, 0xaa, 0x00, 2 }, { 0xc3, 0xab, 0x00, 2 },
+  { 0xc3, 0xac, 0x00, 2 }, { 0xc3, 0xad, 0x00, 2 }, { 0xc3, 0xae, 0x00, 2 }, { 0xc3, 0xaf, 0x00, 2 },
+  { 0xc5, 0xb5, 0x00, 2 }, { 0xc3, 0xb1, 0x00, 2 }, { 0xc3, 0xb2, 0x00, 2 }, { 0xc3, 0xb3, 0x00, 2 },
+  { 0xc3, 0xb4, 0x00, 2 }, { 0xc3, 0xb5, 0x00, 2 }, { 0xc3, 0xb6, 0x00, 2 }, { 0xe1, 0xb9, 0xab, 3 },
+  { 0xc3, 0xb8, 0x00, 2 }, { 0xc3, 0xb9, 0x00, 2 }, { 0xc3, 0xba, 0x00, 2 }, { 0xc3, 0xbb, 0x00, 2 },
+  { 0xc3, 0xbc, 0x00, 2 }, { 0xc3, 0xbd, 0x00, 2 }, { 0xc5, 0xb7, 0x00, 2 }, { 0xc3, 0xbf, 0x00, 2 },
+};
+
+static const guint8 encode_index_110[256] =
+{
+  1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const guint8 encode_pages_110[4][256] =
+{
+  { 0 },
+  /* U+0000 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f,
+    0xa0, 0x00, 0x00, 0xa3, 0x00, 0x00, 0x00, 0xa7, 0x00, 0xa9, 0x00, 0x00, 0x00, 0xad, 0xae, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+    0x00, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0x00, 0xd8, 0xd9, 0xda, 0xdb, 0xdc, 0xdd, 0x00, 0xdf,
+    0xe0, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef,
+    0x00, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0x00, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0x00, 0xff,
+  },
+  /* U+0100 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0xa5, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xb2, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xd0, 0xf0, 0xde, 0xfe, 0xaf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+1e00 */
+  {
+    0x00, 0x00, 0xa1, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xab, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb0, 0xb1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xb4, 0xb5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xbb, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xf7, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xa8, 0xb8, 0xaa, 0xba, 0xbd, 0xbe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xac, 0xbc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+};
+
+
+/* ISO-8859-15, from iso8859_15 */
+static const guint8 decode_111[256][4] =
+{
+  { 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+  { 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+  { 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+  { 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+  { 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+  { 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+  { 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+  { 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+  { 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+  { 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+  { 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+  { 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+  { 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+  { 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+  { 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+  { 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+  { 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+  { 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+  { 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+  { 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+  { 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+  { 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+  { 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+  { 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+  { 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+  { 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+  { 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+  { 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+  { 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+  { 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+  { 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+  { 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+  { 0xc2, 0x80, 0x00, 2 }, { 0xc2, 0x81, 0x00, 2 }, { 0xc2, 0x82, 0x00, 2 }, { 0xc2, 0x83, 0x00, 2 },
+  { 0xc2, 0x84, 0x00, 2 }, { 0xc2, 0x85, 0x00, 2 }, { 0xc2, 0x86, 0x00, 2 }, { 0xc2, 0x87, 0x00, 2 },
+  { 0xc2, 0x88, 0x00, 2 }, { 0xc2, 0x89, 0x00, 2 }, { 0xc2, 0x8a, 0x00, 2 }, { 0xc2, 0x8b, 0x00, 2 },
+  { 0xc2, 0x8c, 0x00, 2 }, { 0xc2, 0x8d, 0x00, 2 }, { 0xc2, 0x8e, 0x00, 2 }, { 0xc2, 0x8f, 0x00, 2 },
+  { 0xc2, 0x90, 0x00, 2 }, { 0xc2, 0x91, 0x00, 2 }, { 0xc2, 0x92, 0x00, 2 }, { 0xc2, 0x93, 0x00, 2 },
+  { 0xc2, 0x94, 0x00, 2 }, { 0xc2, 0x95, 0x00, 2 }, { 0xc2, 0x96, 0x00, 2 }, { 0xc2, 0x97, 0x00, 2 },
+  { 0xc2, 0x98, 0x00, 2 }, { 0xc2, 0x99, 0x00, 2 }, { 0xc2, 0x9a, 0x00, 2 }, { 0xc2, 0x9b, 0x00, 2 },
+  { 0xc2, 0x9c, 0x00, 2 }, { 0xc2, 0x9d, 0x00, 2 }, { 0xc2, 0x9e, 0x00, 2 }, { 0xc2, 0x9f, 0x00, 2 },
+  { 0xc2, 0xa0, 0x00, 2 }, { 0xc2, 0xa1, 0x00, 2 }, { 0xc2, 0xa2, 0x00, 2 }, { 0xc2, 0xa3, 0x00, 2 },
+  { 0xe2, 0x82, 0xac, 3 }, { 0xc2, 0xa5, 0x00, 2 }, { 0xc5, 0xa0, 0x00, 2 }, { 0xc2, 0xa7, 0x00, 2 },
+  { 0xc5, 0xa1, 0x00, 2 }, { 0xc2, 0xa9, 0x00, 2 }, { 0xc2, 0xaa, 0x00, 2 }, { 0xc2, 0xab, 0x00, 2 },
+  { 0xc2, 0xac, 0x00, 2 }, { 0xc2, 0xad, 0x00, 2 }, { 0xc2, 0xae, 0x00, 2 }, { 0xc2, 0xaf, 0x00, 2 },
+  { 0xc2, 0xb0, 0x00, 2 }, { 0xc2, 0xb1, 0x00, 2 }, { 0xc2, 0xb2, 0x00, 2 }, { 0xc2, 0xb3, 0x00, 2 },
+  { 0xc5, 0xbd, 0x00, 2 }, { 0xc2, 0xb5, 0x00, 2 }, { 0xc2, 0xb6, 0x00, 2 }, { 0xc2, 0xb7, 0x00, 2 },
+  { 0xc5, 0xbe, 0x00, 2 }, { 0xc2, 0xb9, 0x00, 2 }, { 0xc2, 0xba, 0x00, 2 }, { 0xc2, 0xbb, 0x00, 2 },
+  { 0xc5, 0x92, 0x00, 2 }, { 0xc5, 0x93, 0x00, 2 }, { 0xc5, 0xb8, 0x00, 2 }, { 0xc2, 0xbf, 0x00, 2 },
+  { 0xc3, 0x80, 0x00, 2 }, { 0xc3, 0x81, 0x00, 2 }, { 0xc3, 0x82, 0x00, 2 }, { 0xc3, 0x83, 0x00, 2 },
+  { 0xc3, 0x84, 0x00, 2 }, { 0xc3, 0x85, 0x00, 2 }, { 0xc3, 0x86, 0x00, 2 }, { 0xc3, 0x87, 0x00, 2 },
+  { 0xc3, 0x88, 0x00, 2 }, { 0xc3, 0x89, 0x00, 2 }, { 0xc3, 0x8a, 0x00, 2 }, { 0xc3, 0x8b, 0x00, 2 },
+  { 0xc3, 0x8c, 0x00, 2 }, { 0xc3, 0x8d, 0x00, 2 }, { 0xc3, 0x8e, 0x00, 2 }, { 0xc3, 0x8f, 0x00, 2 },
+  { 0xc3, 0x90, 0x00, 2 }, { 0xc3, 0x91, 0x00, 2 }, { 0xc3, 0x92, 0x00, 2 }, { 0xc3, 0x93, 0x00, 2 },
+  { 0xc3, 0x94, 0x00, 2 }, { 0xc3, 0x95, 0x00, 2 }, { 0xc3, 0x96, 0x00, 2 }, { 0xc3, 0x97, 0x00, 2 },
+  { 0xc3, 0x98, 0x00, 2 }, { 0xc3, 0x99, 0x00, 2 }, { 0xc3, 0x9a, 0x00, 2 }, { 0xc3, 0x9b, 0x00, 2 },
+  { 0xc3, 0x9c, 0x00, 2 }, { 0xc3, 0x9d, 0x00, 2 }, { 0xc3, 0x9e, 0x00, 2 }, { 0xc3, 0x9f, 0x00, 2 },
+  { 0xc3, 0xa0, 0x00, 2 }, { 0xc3, 0xa1, 0x00, 2 }, { 0xc3, 0xa2, 0x00, 2 }, { 0xc3, 0xa3, 0x00, 2 },
+  { 0xc3, 0xa4, 0x00, 2 }, { 0xc3, 0xa5, 0x00, 2 }, { 0xc3, 0xa6, 0x00, 2 }, { 0xc3, 0xa7, 0x00, 2 },
+  { 0xc3, 0xa8, 0x00, 2 }, { 0xc3, 0xa9, 0x00, 2 }, { 0xc3, 0xaa, 0x00, 2 }, { 0xc3, 0xab, 0x00, 2 },
+  { 0xc3, 0xac, 0x00, 2 }, { 0xc3, 0xad, 0x00, 2 }, { 0xc3, 0xae, 0x00, 2 }, { 0xc3, 0xaf, 0x00, 2 },
+  { 0xc3, 0xb0, 0x00, 2 }, { 0xc3, 0xb1, 0x00, 2 }, { 0xc3, 0xb2, 0x00, 2 }, { 0xc3, 0xb3, 0x00, 2 },
+  { 0xc3, 0xb4, 0x00, 2 }, { 0xc3, 0xb5, 0x00, 2 }, { 0xc3, 0xb6, 0x00, 2 }, { 0xc3, 0xb7, 0x00, 2 },
+  { 0xc3, 0xb8, 0x00, 2 }, { 0xc3, 0xb9, 0x00, 2 }, { 0xc3, 0xba, 0x00, 2 }, { 0xc3, 0xbb, 0x00, 2 },
+  { 0xc3, 0xbc, 0x00, 2 }, { 0xc3, 0xbd, 0x00, 2 }, { 0xc3, 0xbe, 0x00, 2 }, { 0xc3, 0xbf, 0x00, 2 },
+};
+
+static const guint8 encode_index_111[256] =
+{
+  1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const guint8 encode_pages_111[4][256] =
+{
+  { 0 },
+  /* U+0000 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f,
+    0xa0, 0xa1, 0xa2, 0xa3, 0x00, 0xa5, 0x00, 0xa7, 0x00, 0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf,
+    0xb0, 0xb1, 0xb2, 0xb3, 0x00, 0xb5, 0xb6, 0xb7, 0x00, 0xb9, 0xba, 0xbb, 0x00, 0x00, 0x00, 0xbf,
+    0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+    0xd0, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xdb, 0xdc, 0xdd, 0xde, 0xdf,
+    0xe0, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff,
+  },
+  /* U+0100 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xbc, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xa6, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x00, 0x00, 0x00, 0x00, 0xb4, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+2000 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+};
+
+
+/* ISO-8859-16, from iso8859_16 */
+static const guint8 decode_112[256][4] =
+{
+  { 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+  { 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+  { 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+  { 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+  { 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+  { 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+  { 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+  { 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+  { 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+  { 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+  { 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+  { 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+  { 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+  { 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+  { 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+  { 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+  { 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+  { 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+  { 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+  { 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+  { 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+  { 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+  { 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+  { 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+  { 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+  { 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+  { 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+  { 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+  { 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+  { 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+  { 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+  { 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+  { 0xc2, 0x80, 0x00, 2 }, { 0xc2, 0x81, 0x00, 2 }, { 0xc2, 0x82, 0x00, 2 }, { 0xc2, 0x83, 0x00, 2 },
+  { 0xc2, 0x84, 0x00, 2 }, { 0xc2, 0x85, 0x00, 2 }, { 0xc2, 0x86, 0x00, 2 }, { 0xc2, 0x87, 0x00, 2 },
+  { 0xc2, 0x88, 0x00, 2 }, { 0xc2, 0x89, 0x00, 2 }, { 0xc2, 0x8a, 0x00, 2 }, { 0xc2, 0x8b, 0x00, 2 },
+  { 0xc2, 0x8c, 0x00, 2 }, { 0xc2, 0x8d, 0x00, 2 }, { 0xc2, 0x8e, 0x00, 2 }, { 0xc2, 0x8f, 0x00, 2 },
+  { 0xc2, 0x90, 0x00, 2 }, { 0xc2, 0x91, 0x00, 2 }, { 0xc2, 0x92, 0x00, 2 }, { 0xc2, 0x93, 0x00, 2 },
+  { 0xc2, 0x94, 0x00, 2 }, { 0xc2, 0x95, 0x00, 2 }, { 0xc2, 0x96, 0x00, 2 }, { 0xc2, 0x97, 0x00, 2 },
+  { 0xc2, 0x98, 0x00, 2 }, { 0xc2, 0x99, 0x00, 2 }, { 0xc2, 0x9a, 0x00, 2 }, { 0xc2, 0x9b, 0x00, 2 },
+  { 0xc2, 0x9c, 0x00, 2 }, { 0xc2, 0x9d, 0x00, 2 }, { 0xc2, 0x9e, 0x00, 2 }, { 0xc2, 0x9f, 0x00, 2 },
+  { 0xc2, 0xa0, 0x00, 2 }, { 0xc4, 0x84, 0x00, 2 }, { 0xc4, 0x85, 0x00, 2 }, { 0xc5, 0x81, 0x00, 2 },
+  { 0xe2, 0x82, 0xac, 3 }, { 0xe2, 0x80, 0x9e, 3 }, { 0xc5, 0xa0, 0x00, 2 }, { 0xc2, 0xa7, 0x00, 2 },
+  { 0xc5, 0xa1, 0x00, 2 }, { 0xc2, 0xa9, 0x00, 2 }, { 0xc8, 0x98, 0x00, 2 }, { 0xc2, 0xab, 0x00, 2 },
+  { 0xc5, 0xb9, 0x00, 2 }, { 0xc2, 0xad, 0x00, 2 }, { 0xc5, 0xba, 0x00, 2 }, { 0xc5, 0xbb, 0x00, 2 },
+  { 0xc2, 0xb0, 0x00, 2 }, { 0xc2, 0xb1, 0x00, 2 }, { 0xc4, 0x8c, 0x00, 2 }, { 0xc5, 0x82, 0x00, 2 },
+  { 0xc5, 0xbd, 0x00, 2 }, { 0xe2, 0x80, 0x9d, 3 }, { 0xc2, 0xb6, 0x00, 2 }, { 0xc2, 0xb7, 0x00, 2 },
+  { 0xc5, 0xbe, 0x00, 2 }, { 0xc4, 0x8d, 0x00, 2 }, { 0xc8, 0x99, 0x00, 2 }, { 0xc2, 0xbb, 0x00, 2 },
+  { 0xc5, 0x92, 0x00, 2 }, { 0xc5, 0x93, 0x00, 2 }, { 0xc5, 0xb8, 0x00, 2 }, { 0xc5, 0xbc, 0x00, 2 },
+  { 0xc3, 0x80, 0x00, 2 }, { 0xc3, 0x81, 0x00, 2 }, { 0xc3, 0x82, 0x00, 2 }, { 0xc4, 0x82, 0x00, 2 },
+  { 0xc3, 0x84, 0x00, 2 }, { 0xc4, 0x86, 0x00, 2 }, { 0xc3, 0x86, 0x00, 2 }, { 0xc3, 0x87, 0x00, 2 },
+  { 0xc3, 0x88, 0x00, 2 }, { 0xc3, 0x89, 0x00, 2 }, { 0xc3, 0x8a, 0x00, 2 }, { 0xc3, 0x8b, 0x00, 2 },
+  { 0xc3, 0x8c, 0x00, 2 }, { 0xc3, 0x8d, 0x00, 2 }, { 0xc3, 0x8e, 0x00, 2 }, { 0xc3, 0x8f, 0x00, 2 },
+  { 0xc4, 0x90, 0x00, 2 }, { 0xc5, 0x83, 0x00, 2 }, { 0xc3, 0x92, 0x00, 2 }, { 0xc3, 0x93, 0x00, 2 },
+  { 0xc3, 0x94, 0x00, 2 }, { 0xc5, 0x90, 0x00, 2 }, { 0xc3, 0x96, 0x00, 2 }, { 0xc5, 0x9a, 0x00, 2 },
+  { 0xc5, 0xb0, 0x00, 2 }, { 0xc3, 0x99, 0x00, 2 }, { 0xc3, 0x9a, 0x00, 2 }, { 0xc3, 0x9b, 0x00, 2 },
+  { 0xc3, 0x9c, 0x00, 2 }, { 0xc4, 0x98, 0x00, 2 }, { 0xc8, 0x9a, 0x00, 2 }, { 0xc3, 0x9f, 0x00, 2 },
+  { 0xc3, 0xa0, 0x00, 2 }, { 0xc3, 0xa1, 0x00, 2 }, { 0xc3, 0xa2, 0x00, 2 }, { 0xc4, 0x83, 0x00, 2 },
+  { 0xc3, 0xa4, 0x00, 2 }, { 0xc4, 0x87, 0x00, 2 }, { 0xc3, 0xa6, 0x00, 2 }, { 0xc3, 0xa7, 0x00, 2 },
+  { 0xc3, 0xa8, 0x00, 2 }, { 0xc3, 0xa9, 0x00, 2 }, { 0xc3, 0xaa, 0x00, 2 }, { 0xc3, 0xab, 0x00, 2 },
+  { 0xc3, 0xac, 0x00, 2 }, { 0xc3, 0xad, 0x00, 2 }, { 0xc3, 0xae, 0x00, 2 }, { 0xc3, 0xaf, 0x00, 2 },
+  { 0xc4, 0x91, 0x00, 2 }, { 0xc5, 0x84, 0x00, 2 }, { 0xc3, 0xb2, 0x00, 2 }, { 0xc3, 0xb3, 0x00, 2 },
+  { 0xc3, 0xb4, 0x00, 2 }, { 0xc5, 0x91, 0x00, 2 }, { 0xc3, 0xb6, 0x00, 2 }, { 0xc5, 0x9b, 0x00, 2 },
+  { 0xc5, 0xb1, 0x00, 2 }, { 0xc3, 0xb9, 0x00, 2 }, { 0xc3, 0xba, 0x00, 2 }, { 0xc3, 0xbb, 0x00, 2 },
+  { 0xc3, 0xbc, 0x00, 2 }, { 0xc4, 0x99, 0x00, 2 }, { 0xc8, 0x9b, 0x00, 2 }, { 0xc3, 0xbf, 0x00, 2 },
+};
+
+static const guint8 encode_index_112[256] =
+{
+  1, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const guint8 encode_pages_112[5][256] =
+{
+  { 0 },
+  /* U+0000 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f,
+    0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa7, 0x00, 0xa9, 0x00, 0xab, 0x00, 0xad, 0x00, 0x00,
+    0xb0, 0xb1, 0x00, 0x00, 0x00, 0x00, 0xb6, 0xb7, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x00, 0x00,
+    0xc0, 0xc1, 0xc2, 0x00, 0xc4, 0x00, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+    0x00, 0x00, 0xd2, 0xd3, 0xd4, 0x00, 0xd6, 0x00, 0x00, 0xd9, 0xda, 0xdb, 0xdc, 0x00, 0x00, 0xdf,
+    0xe0, 0xe1, 0xe2, 0x00, 0xe4, 0x00, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef,
+    0x00, 0x00, 0xf2, 0xf3, 0xf4, 0x00, 0xf6, 0x00, 0x00, 0xf9, 0xfa, 0xfb, 0xfc, 0x00, 0x00, 0xff,
+  },
+  /* U+0100 */
+  {
+    0x00, 0x00, 0xc3, 0xe3, 0xa1, 0xa2, 0xc5, 0xe5, 0x00, 0x00, 0x00, 0x00, 0xb2, 0xb9, 0x00, 0x00,
+    0xd0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdd, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xa3, 0xb3, 0xd1, 0xf1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xd5, 0xf5, 0xbc, 0xbd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xf7, 0x00, 0x00, 0x00, 0x00,
+    0xa6, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xd8, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xac, 0xae, 0xaf, 0xbf, 0xb4, 0xb8, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+0200 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xba, 0xde, 0xfe, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+2000 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xa5, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa4, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+};
+
+
+/* IBM850, from cp850 */
+static const guint8 decode_2009[256][4] =
+{
+  { 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+  { 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+  { 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+  { 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+  { 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+  { 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+  { 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+  { 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+  { 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+  { 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+  { 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+  { 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+  { 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+  { 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+  { 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+  { 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+  { 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+  { 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+  { 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+  { 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+  { 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+  { 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+  { 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+  { 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+  { 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+  { 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+  { 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+  { 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+  { 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+  { 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+  { 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+  { 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+  { 0xc3, 0x87, 0x00, 2 }, { 0xc3, 0xbc, 0x00, 2 }, { 0xc3, 0xa9, 0x00, 2 }, { 0xc3, 0xa2, 0x00, 2 },
+  { 0xc3, 0xa4, 0x00, 2 }, { 0xc3, 0xa0, 0x00, 2 }, { 0xc3, 0xa5, 0x00, 2 }, { 0xc3, 0xa7, 0x00, 2 },
+  { 0xc3, 0xaa, 0x00, 2 }, { 0xc3, 0xab, 0x00, 2 }, { 0xc3, 0xa8, 0x00, 2 }, { 0xc3, 0xaf, 0x00, 2 },
+  { 0xc3, 0xae, 0x00, 2 }, { 0xc3, 0xac, 0x00, 2 }, { 0xc3, 0x84, 0x00, 2 }, { 0xc3, 0x85, 0x00, 2 },
+  { 0xc3, 0x89, 0x00, 2 }, { 0xc3, 0xa6, 0x00, 2 }, { 0xc3, 0x86, 0x00, 2 }, { 0xc3, 0xb4, 0x00, 2 },
+  { 0xc3, 0xb6, 0x00, 2 }, { 0xc3, 0xb2, 0x00, 2 }, { 0xc3, 0xbb, 0x00, 2 }, { 0xc3, 0xb9, 0x00, 2 },
+  { 0xc3, 0xbf, 0x00, 2 }, { 0xc3, 0x96, 0x00, 2 }, { 0xc3, 0x9c, 0x00, 2 }, { 0xc3, 0xb8, 0x00, 2 },
+  { 0xc2, 0xa3, 0x00, 2 }, { 0xc3, 0x98, 0x00, 2 }, { 0xc3, 0x97, 0x00, 2 }, { 0xc6, 0x92, 0x00, 2 },
+  { 0xc3, 0xa1, 0x00, 2 }, { 0xc3, 0xad, 0x00, 2 }, { 0xc3, 0xb3, 0x00, 2 }, { 0xc3, 0xba, 0x00, 2 },
+  { 0xc3, 0xb1, 0x00, 2 }, { 0xc3, 0x91, 0x00, 2 }, { 0xc2, 0xaa, 0x00, 2 }, { 0xc2, 0xba, 0x00, 2 },
+  { 0xc2, 0xbf, 0x00, 2 }, { 0xc2, 0xae, 0x00, 2 }, { 0xc2, 0xac, 0x00, 2 }, { 0xc2, 0xbd, 0x00, 2 },
+  { 0xc2, 0xbc, 0x00, 2 }, { 0xc2, 0xa1, 0x00, 2 }, { 0xc2, 0xab, 0x00, 2 }, { 0xc2, 0xbb, 0x00, 2 },
+  { 0xe2, 0x96, 0x91, 3 }, { 0xe2, 0x96, 0x92, 3 }, { 0xe2, 0x96, 0x93, 3 }, { 0xe2, 0x94, 0x82, 3 },
+  { 0xe2, 0x94, 0xa4, 3 }, { 0xc3, 0x81, 0x00, 2 }, { 0xc3, 0x82, 0x00, 2 }, { 0xc3, 0x80, 0x00, 2 },
+  { 0xc2, 0xa9, 0x00, 2 }, { 0xe2, 0x95, 0xa3, 3 }, { 0xe2, 0x95, 0x91, 3 }, { 0xe2, 0x95, 0x97, 3 },
+  { 0xe2, 0x95, 0x9d, 3 }, { 0xc2, 0xa2, 0x00, 2 }, { 0xc2, 0xa5, 0x00, 2 }, { 0xe2, 0x94, 0x90, 3 },
+  { 0xe2, 0x94, 0x94, 3 }, { 0xe2, 0x94, 0xb4, 3 }, { 0xe2, 0x94, 0xac, 3 }, { 0xe2, 0x94, 0x9c, 3 },
+  { 0xe2, 0x94, 0x80, 3 }, { 0xe2, 0x94, 0xbc, 3 }, { 0xc3, 0xa3, 0x00, 2 }, { 0xc3, 0x83, 0x00, 2 },
+  { 0xe2, 0x95, 0x9a, 3 }, { 0xe2, 0x95, 0x94, 3 }, { 0xe2, 0x95, 0xa9, 3 }, { 0xe2, 0x95, 0xa6, 3 },
+  { 0xe2, 0x95, 0xa0, 3 }, { 0xe2, 0x95, 0x90, 3 }, { 0xe2, 0x95, 0xac, 3 }, { 0xc2, 0xa4, 0x00, 2 },
+  { 0xc3, 0xb0, 0x00, 2 }, { 0xc3, 0x90, 0x00, 2 }, { 0xc3, 0x8a, 0x00, 2 }, { 0xc3, 0x8b, 0x00, 2 },
+  { 0xc3, 0x88, 0x00, 2 }, { 0xc4, 0xb1, 0x00, 2 }, { 0xc3, 0x8d, 0x00, 2 }, { 0xc3, 0x8e, 0x00, 2 },
+  { 0xc3, 0x8f, 0x00, 2 }, { 0xe2, 0x94, 0x98, 3 }, { 0xe2, 0x94, 0x8c, 3 }, { 0xe2, 0x96, 0x88, 3 },
+  { 0xe2, 0x96, 0x84, 3 }, { 0xc2, 0xa6, 0x00, 2 }, { 0xc3, 0x8c, 0x00, 2 }, { 0xe2, 0x96, 0x80, 3 },
+  { 0xc3, 0x93, 0x00, 2 }, { 0xc3, 0x9f, 0x00, 2 }, { 0xc3, 0x94, 0x00, 2 }, { 0xc3, 0x92, 0x00, 2 },
+  { 0xc3, 0xb5, 0x00, 2 }, { 0xc3, 0x95, 0x00, 2 }, { 0xc2, 0xb5, 0x00, 2 }, { 0xc3, 0xbe, 0x00, 2 },
+  { 0xc3, 0x9e, 0x00, 2 }, { 0xc3, 0x9a, 0x00, 2 }, { 0xc3, 0x9b, 0x00, 2 }, { 0xc3, 0x99, 0x00, 2 },
+  { 0xc3, 0xbd, 0x00, 2 }, { 0xc3, 0x9d, 0x00, 2 }, { 0xc2, 0xaf, 0x00, 2 }, { 0xc2, 0xb4, 0x00, 2 },
+  { 0xc2, 0xad, 0x00, 2 }, { 0xc2, 0xb1, 0x00, 2 }, { 0xe2, 0x80, 0x97, 3 }, { 0xc2, 0xbe, 0x00, 2 },
+  { 0xc2, 0xb6, 0x00, 2 }, { 0xc2, 0xa7, 0x00, 2 }, { 0xc3, 0xb7, 0x00, 2 }, { 0xc2, 0xb8, 0x00, 2 },
+  { 0xc2, 0xb0, 0x00, 2 }, { 0xc2, 0xa8, 0x00, 2 }, { 0xc2, 0xb7, 0x00, 2 }, { 0xc2, 0xb9, 0x00, 2 },
+  { 0xc2, 0xb3, 0x00, 2 }, { 0xc2, 0xb2, 0x00, 2 }, { 0xe2, 0x96, 0xa0, 3 }, { 0xc2, 0xa0, 0x00, 2 },
+};
+
+static const guint8 encode_index_2009[256] =
+{
+  1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  3, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const guint8 encode_pages_2009[5][256] =
+{
+  { 0 },
+  /* U+0000 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xad, 0xbd, 0x9c, 0xcf, 0xbe, 0xdd, 0xf5, 0xf9, 0xb8, 0xa6, 0xae, 0xaa, 0xf0, 0xa9, 0xee,
+    0xf8, 0xf1, 0xfd, 0xfc, 0xef, 0xe6, 0xf4, 0xfa, 0xf7, 0xfb, 0xa7, 0xaf, 0xac, 0xab, 0xf3, 0xa8,
+    0xb7, 0xb5, 0xb6, 0xc7, 0x8e, 0x8f, 0x92, 0x80, 0xd4, 0x90, 0xd2, 0xd3, 0xde, 0xd6, 0xd7, 0xd8,
+    0xd1, 0xa5, 0xe3, 0xe0, 0xe2, 0xe5, 0x99, 0x9e, 0x9d, 0xeb, 0xe9, 0xea, 0x9a, 0xed, 0xe8, 0xe1,
+    0x85, 0xa0, 0x83, 0xc6, 0x84, 0x86, 0x91, 0x87, 0x8a, 0x82, 0x88, 0x89, 0x8d, 0xa1, 0x8c, 0x8b,
+    0xd0, 0xa4, 0x95, 0xa2, 0x93, 0xe4, 0x94, 0xf6, 0x9b, 0x97, 0xa3, 0x96, 0x81, 0xec, 0xe7, 0x98,
+  },
+  /* U+0100 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xd5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+2000 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+2500 */
+  {
+    0xc4, 0x00, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0x00, 0x00, 0x00,
+    0xbf, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0xd9, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xcd, 0xba, 0x00, 0x00, 0xc9, 0x00, 0x00, 0xbb, 0x00, 0x00, 0xc8, 0x00, 0x00, 0xbc, 0x00, 0x00,
+    0xcc, 0x00, 0x00, 0xb9, 0x00, 0x00, 0xcb, 0x00, 0x00, 0xca, 0x00, 0x00, 0xce, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xdf, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xb0, 0xb1, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+};
+
+
+/* IBM437, from cp437 */
+static const guint8 decode_2011[256][4] =
+{
+  { 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+  { 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+  { 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+  { 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+  { 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+  { 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+  { 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+  { 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+  { 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+  { 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+  { 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+  { 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+  { 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+  { 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+  { 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+  { 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+  { 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+  { 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+  { 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+  { 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+  { 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+  { 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+  { 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+  { 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+  { 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+  { 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+  { 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+  { 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+  { 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+  { 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+  { 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+  { 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+  { 0xc3, 0x87, 0x00, 2 }, { 0xc3, 0xbc, 0x00, 2 }, { 0xc3, 0xa9, 0x00, 2 }, { 0xc3, 0xa2, 0x00, 2 },
+  { 0xc3, 0xa4, 0x00, 2 }, { 0xc3, 0xa0, 0x00, 2 }, { 0xc3, 0xa5, 0x00, 2 }, { 0xc3, 0xa7, 0x00, 2 },
+  { 0xc3, 0xaa, 0x00, 2 }, { 0xc3, 0xab, 0x00, 2 }, { 0xc3, 0xa8, 0x00, 2 }, { 0xc3, 0xaf, 0x00, 2 },
+  { 0xc3, 0xae, 0x00, 2 }, { 0xc3, 0xac, 0x00, 2 }, { 0xc3, 0x84, 0x00, 2 }, { 0xc3, 0x85, 0x00, 2 },
+  { 0xc3, 0x89, 0x00, 2 }, { 0xc3, 0xa6, 0x00, 2 }, { 0xc3, 0x86, 0x00, 2 }, { 0xc3, 0xb4, 0x00, 2 },
+  { 0xc3, 0xb6, 0x00, 2 }, { 0xc3, 0xb2, 0x00, 2 }, { 0xc3, 0xbb, 0x00, 2 }, { 0xc3, 0xb9, 0x00, 2 },
+  { 0xc3, 0xbf, 0x00, 2 }, { 0xc3, 0x96, 0x00, 2 }, { 0xc3, 0x9c, 0x00, 2 }, { 0xc2, 0xa2, 0x00, 2 },
+  { 0xc2, 0xa3, 0x00, 2 }, { 0xc2, 0xa5, 0x00, 2 }, { 0xe2, 0x82, 0xa7, 3 }, { 0xc6, 0x92, 0x00, 2 },
+  { 0xc3, 0xa1, 0x00, 2 }, { 0xc3, 0xad, 0x00, 2 }, { 0xc3, 0xb3, 0x00, 2 }, { 0xc3, 0xba, 0x00, 2 },
+  { 0xc3, 0xb1, 0x00, 2 }, { 0xc3, 0x91, 0x00, 2 }, { 0xc2, 0xaa, 0x00, 2 }, { 0xc2, 0xba, 0x00, 2 },
+  { 0xc2, 0xbf, 0x00, 2 }, { 0xe2, 0x8c, 0x90, 3 }, { 0xc2, 0xac, 0x00, 2 }, { 0xc2, 0xbd, 0x00, 2 },
+  { 0xc2, 0xbc, 0x00, 2 }, { 0xc2, 0xa1, 0x00, 2 }, { 0xc2, 0xab, 0x00, 2 }, { 0xc2, 0xbb, 0x00, 2 },
+  { 0xe2, 0x96, 0x91, 3 }, { 0xe2, 0x96, 0x92, 3 }, { 0xe2, 0x96, 0x93, 3 }, { 0xe2, 0x94, 0x82, 3 },
+  { 0xe2, 0x94, 0xa4, 3 }, { 0xe2, 0x95, 0xa1, 3 }, { 0xe2, 0x95, 0xa2, 3 }, { 0xe2, 0x95, 0x96, 3 },
+  { 0xe2, 0x95, 0x95, 3 }, { 0xe2, 0x95, 0xa3, 3 }, { 0xe2, 0x95, 0x91, 3 }, { 0xe2, 0x95, 0x97, 3 },
+  { 0xe2, 0x95, 0x9d, 3 }, { 0xe2, 0x95, 0x9c, 3 }, { 0xe2, 0x95, 0x9b, 3 }, { 0xe2, 0x94, 0x90, 3 },
+  { 0xe2, 0x94, 0x94, 3 }, { 0xe2, 0x94, 0xb4, 3 }, { 0xe2, 0x94, 0xac, 3 }, { 0xe2, 0x94, 0x9c, 3 },
+  { 0xe2, 0x94, 0x80, 3 }, { 0xe2, 0x94, 0xbc, 3 }, { 0xe2, 0x95, 0x9e, 3 }, { 0xe2, 0x95, 0x9f, 3 },
+  { 0xe2, 0x95, 0x9a, 3 }, { 0xe2, 0x95, 0x94, 3 }, { 0xe2, 0x95, 0xa9, 3 }, { 0xe2, 0x95, 0xa6, 3 },
+  { 0xe2, 0x95, 0xa0, 3 }, { 0xe2, 0x95, 0x90, 3 }, { 0xe2, 0x95, 0xac, 3 }, { 0xe2, 0x95, 0xa7, 3 },
+  { 0xe2, 0x95, 0xa8, 3 }, { 0xe2, 0x95, 0xa4, 3 }, { 0xe2, 0x95, 0xa5, 3 }, { 0xe2, 0x95, 0x99, 3 },
+  { 0xe2, 0x95, 0x98, 3 }, { 0xe2, 0x95, 0x92, 3 }, { 0xe2, 0x95, 0x93, 3 }, { 0xe2, 0x95, 0xab, 3 },
+  { 0xe2, 0x95, 0xaa, 3 }, { 0xe2, 0x94, 0x98, 3 }, { 0xe2, 0x94, 0x8c, 3 }, { 0xe2, 0x96, 0x88, 3 },
+  { 0xe2, 0x96, 0x84, 3 }, { 0xe2, 0x96, 0x8c, 3 }, { 0xe2, 0x96, 0x90, 3 }, { 0xe2, 0x96, 0x80, 3 },
+  { 0xce, 0xb1, 0x00, 2 }, { 0xc3, 0x9f, 0x00, 2 }, { 0xce, 0x93, 0x00, 2 }, { 0xcf, 0x80, 0x00, 2 },
+  { 0xce, 0xa3, 0x00, 2 }, { 0xcf, 0x83, 0x00, 2 }, { 0xc2, 0xb5, 0x00, 2 }, { 0xcf, 0x84, 0x00, 2 },
+  { 0xce, 0xa6, 0x00, 2 }, { 0xce, 0x98, 0x00, 2 }, { 0xce, 0xa9, 0x00, 2 }, { 0xce, 0xb4, 0x00, 2 },
+  { 0xe2, 0x88, 0x9e, 3 }, { 0xcf, 0x86, 0x00, 2 }, { 0xce, 0xb5, 0x00, 2 }, { 0xe2, 0x88, 0xa9, 3 },
+  { 0xe2, 0x89, 0xa1, 3 }, { 0xc2, 0xb1, 0x00, 2 }, { 0xe2, 0x89, 0xa5, 3 }, { 0xe2, 0x89, 0xa4, 3 },
+  { 0xe2, 0x8c, 0xa0, 3 }, { 0xe2, 0x8c, 0xa1, 3 }, { 0xc3, 0xb7, 0x00, 2 }, { 0xe2, 0x89, 0x88, 3 },
+  { 0xc2, 0xb0, 0x00, 2 }, { 0xe2, 0x88, 0x99, 3 }, { 0xc2, 0xb7, 0x00, 2 }, { 0xe2, 0x88, 0x9a, 3 },
+  { 0xe2, 0x81, 0xbf, 3 }, { 0xc2, 0xb2, 0x00, 2 }, { 0xe2, 0x96, 0xa0, 3 }, { 0xc2, 0xa0, 0x00, 2 },
+};
+
+static const guint8 encode_index_2011[256] =
+{
+  1, 2, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  4, 0, 5, 6, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const guint8 encode_pages_2011[8][256] =
+{
+  { 0 },
+  /* U+0000 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xad, 0x9b, 0x9c, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x00, 0xa6, 0xae, 0xaa, 0x00, 0x00, 0x00,
+    0xf8, 0xf1, 0xfd, 0x00, 0x00, 0xe6, 0x00, 0xfa, 0x00, 0x00, 0xa7, 0xaf, 0xac, 0xab, 0x00, 0xa8,
+    0x00, 0x00, 0x00, 0x00, 0x8e, 0x8f, 0x92, 0x80, 0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x00, 0x00, 0xe1,
+    0x85, 0xa0, 0x83, 0x00, 0x84, 0x86, 0x91, 0x87, 0x8a, 0x82, 0x88, 0x89, 0x8d, 0xa1, 0x8c, 0x8b,
+    0x00, 0xa4, 0x95, 0xa2, 0x93, 0x00, 0x94, 0xf6, 0x00, 0x97, 0xa3, 0x96, 0x81, 0x00, 0x00, 0x98,
+  },
+  /* U+0100 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+0300 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xe2, 0x00, 0x00, 0x00, 0x00, 0xe9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xe4, 0x00, 0x00, 0xe8, 0x00, 0x00, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xe0, 0x00, 0x00, 0xeb, 0xee, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xe3, 0x00, 0x00, 0xe5, 0xe7, 0x00, 0xed, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+2000 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+2200 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xfb, 0x00, 0x00, 0x00, 0xec, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xf0, 0x00, 0x00, 0xf3, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+2300 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf4, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+2500 */
+  {
+    0xc4, 0x00, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0x00, 0x00, 0x00,
+    0xbf, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0xd9, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xcd, 0xba, 0xd5, 0xd6, 0xc9, 0xb8, 0xb7, 0xbb, 0xd4, 0xd3, 0xc8, 0xbe, 0xbd, 0xbc, 0xc6, 0xc7,
+    0xcc, 0xb5, 0xb6, 0xb9, 0xd1, 0xd2, 0xcb, 0xcf, 0xd0, 0xca, 0xd8, 0xd7, 0xce, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xdf, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x00, 0xdd, 0x00, 0x00, 0x00,
+    0xde, 0xb0, 0xb1, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+};
+
+
+/* KOI8-R, from koi8_r */
+static const guint8 decode_2084[256][4] =
+{
+  { 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+  { 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+  { 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+  { 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+  { 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+  { 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+  { 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+  { 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+  { 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+  { 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+  { 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+  { 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+  { 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+  { 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+  { 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+  { 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+  { 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+  { 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+  { 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+  { 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+  { 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+  { 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+  { 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+  { 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+  { 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+  { 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+  { 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+  { 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+  { 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+  { 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+  { 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+  { 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+  { 0xe2, 0x94, 0x80, 3 }, { 0xe2, 0x94, 0x82, 3 }, { 0xe2, 0x94, 0x8c, 3 }, { 0xe2, 0x94, 0x90, 3 },
+  { 0xe2, 0x94, 0x94, 3 }, { 0xe2, 0x94, 0x98, 3 }, { 0xe2, 0x94, 0x9c, 3 }, { 0xe2, 0x94, 0xa4, 3 },
+  { 0xe2, 0x94, 0xac, 3 }, { 0xe2, 0x94, 0xb4, 3 }, { 0xe2, 0x94, 0xbc, 3 }, { 0xe2, 0x96, 0x80, 3 },
+  { 0xe2, 0x96, 0x84, 3 }, { 0xe2, 0x96, 0x88, 3 }, { 0xe2, 0x96, 0x8c, 3 }, { 0xe2, 0x96, 0x90, 3 },
+  { 0xe2, 0x96, 0x91, 3 }, { 0xe2, 0x96, 0x92, 3 }, { 0xe2, 0x96, 0x93, 3 }, { 0xe2, 0x8c, 0xa0, 3 },
+  { 0xe2, 0x96, 0xa0, 3 }, { 0xe2, 0x88, 0x99, 3 }, { 0xe2, 0x88, 0x9a, 3 }, { 0xe2, 0x89, 0x88, 3 },
+  { 0xe2, 0x89, 0xa4, 3 }, { 0xe2, 0x89, 0xa5, 3 }, { 0xc2, 0xa0, 0x00, 2 }, { 0xe2, 0x8c, 0xa1, 3 },
+  { 0xc2, 0xb0, 0x00, 2 }, { 0xc2, 0xb2, 0x00, 2 }, { 0xc2, 0xb7, 0x00, 2 }, { 0xc3, 0xb7, 0x00, 2 },
+  { 0xe2, 0x95, 0x90, 3 }, { 0xe2, 0x95, 0x91, 3 }, { 0xe2, 0x95, 0x92, 3 }, { 0xd1, 0x91, 0x00, 2 },
+  { 0xe2, 0x95, 0x93, 3 }, { 0xe2, 0x95, 0x94, 3 }, { 0xe2, 0x95, 0x95, 3 }, { 0xe2, 0x95, 0x96, 3 },
+  { 0xe2, 0x95, 0x97, 3 }, { 0xe2, 0x95, 0x98, 3 }, { 0xe2, 0x95, 0x99, 3 }, { 0xe2, 0x95, 0x9a, 3 },
+  { 0xe2, 0x95, 0x9b, 3 }, { 0xe2, 0x95, 0x9c, 3 }, { 0xe2, 0x95, 0x9d, 3 }, { 0xe2, 0x95, 0x9e, 3 },
+  { 0xe2, 0x95, 0x9f, 3 }, { 0xe2, 0x95, 0xa0, 3 }, { 0xe2, 0x95, 0xa1, 3 }, { 0xd0, 0x81, 0x00, 2 },
+  { 0xe2, 0x95, 0xa2, 3 }, { 0xe2, 0x95, 0xa3, 3 }, { 0xe2, 0x95, 0xa4, 3 }, { 0xe2, 0x95, 0xa5, 3 },
+  { 0xe2, 0x95, 0xa6, 3 }, { 0xe2, 0x95, 0xa7, 3 }, { 0xe2, 0x95, 0xa8, 3 }, { 0xe2, 0x95, 0xa9, 3 },
+  { 0xe2, 0x95, 0xaa, 3 }, { 0xe2, 0x95, 0xab, 3 }, { 0xe2, 0x95, 0xac, 3 }, { 0xc2, 0xa9, 0x00, 2 },
+  { 0xd1, 0x8e, 0x00, 2 }, { 0xd0, 0xb0, 0x00, 2 }, { 0xd0, 0xb1, 0x00, 2 }, { 0xd1, 0x86, 0x00, 2 },
+  { 0xd0, 0xb4, 0x00, 2 }, { 0xd0, 0xb5, 0x00, 2 }, { 0xd1, 0x84, 0x00, 2 }, { 0xd0, 0xb3, 0x00, 2 },
+  { 0xd1, 0x85, 0x00, 2 }, { 0xd0, 0xb8, 0x00, 2 }, { 0xd0, 0xb9, 0x00, 2 }, { 0xd0, 0xba, 0x00, 2 },
+  { 0xd0, 0xbb, 0x00, 2 }, { 0xd0, 0xbc, 0x00, 2 }, { 0xd0, 0xbd, 0x00, 2 }, { 0xd0, 0xbe, 0x00, 2 },
+  { 0xd0, 0xbf, 0x00, 2 }, { 0xd1, 0x8f, 0x00, 2 }, { 0xd1, 0x80, 0x00, 2 }, { 0xd1, 0x81, 0x00, 2 },
+  { 0xd1, 0x82, 0x00, 2 }, { 0xd1, 0x83, 0x00, 2 }, { 0xd0, 0xb6, 0x00, 2 }, { 0xd0, 0xb2, 0x00, 2 },
+  { 0xd1, 0x8c, 0x00, 2 }, { 0xd1, 0x8b, 0x00, 2 }, { 0xd0, 0xb7, 0x00, 2 }, { 0xd1, 0x88, 0x00, 2 },
+  { 0xd1, 0x8d, 0x00, 2 }, { 0xd1, 0x89, 0x00, 2 }, { 0xd1, 0x87, 0x00, 2 }, { 0xd1, 0x8a, 0x00, 2 },
+  { 0xd0, 0xae, 0x00, 2 }, { 0xd0, 0x90, 0x00, 2 }, { 0xd0, 0x91, 0x00, 2 }, { 0xd0, 0xa6, 0x00, 2 },
+  { 0xd0, 0x94, 0x00, 2 }, { 0xd0, 0x95, 0x00, 2 }, { 0xd0, 0xa4, 0x00, 2 }, { 0xd0, 0x93, 0x00, 2 },
+  { 0xd0, 0xa5, 0x00, 2 }, { 0xd0, 0x98, 0x00, 2 }, { 0xd0, 0x99, 0x00, 2 }, { 0xd0, 0x9a, 0x00, 2 },
+  { 0xd0, 0x9b, 0x00, 2 }, { 0xd0, 0x9c, 0x00, 2 }, { 0xd0, 0x9d, 0x00, 2 }, { 0xd0, 0x9e, 0x00, 2 },
+  { 0xd0, 0x9f, 0x00, 2 }, { 0xd0, 0xaf, 0x00, 2 }, { 0xd0, 0xa0, 0x00, 2 }, { 0xd0, 0xa1, 0x00, 2 },
+  { 0xd0, 0xa2, 0x00, 2 }, { 0xd0, 0xa3, 0x00, 2 }, { 0xd0, 0x96, 0x00, 2 }, { 0xd0, 0x92, 0x00, 2 },
+  { 0xd0, 0xac, 0x00, 2 }, { 0xd0, 0xab, 0x00, 2 }, { 0xd0, 0x97, 0x00, 2 }, { 0xd0, 0xa8, 0x00, 2 },
+  { 0xd0, 0xad, 0x00, 2 }, { 0xd0, 0xa9, 0x00, 2 }, { 0xd0, 0xa7, 0x00, 2 }, { 0xd0, 0xaa, 0x00, 2 },
+};
+
+static const guint8 encode_index_2084[256] =
+{
+  1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 3, 4, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const guint8 encode_pages_2084[6][256] =
+{
+  { 0 },
+  /* U+0000 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x9c, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+0400 */
+  {
+    0x00, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xe1, 0xe2, 0xf7, 0xe7, 0xe4, 0xe5, 0xf6, 0xfa, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef, 0xf0,
+    0xf2, 0xf3, 0xf4, 0xf5, 0xe6, 0xe8, 0xe3, 0xfe, 0xfb, 0xfd, 0xff, 0xf9, 0xf8, 0xfc, 0xe0, 0xf1,
+    0xc1, 0xc2, 0xd7, 0xc7, 0xc4, 0xc5, 0xd6, 0xda, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf, 0xd0,
+    0xd2, 0xd3, 0xd4, 0xd5, 0xc6, 0xc8, 0xc3, 0xde, 0xdb, 0xdd, 0xdf, 0xd9, 0xd8, 0xdc, 0xc0, 0xd1,
+    0x00, 0xa3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+2200 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x98, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+2300 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x93, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+2500 */
+  {
+    0x80, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00,
+    0x83, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xa0, 0xa1, 0xa2, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf, 0xb0,
+    0xb1, 0xb2, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xbb, 0xbc, 0xbd, 0xbe, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x8b, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00,
+    0x8f, 0x90, 0x91, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+};
+
+
+/* IBM866, from cp866 */
+static const guint8 decode_2086[256][4] =
+{
+  { 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+  { 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+  { 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+  { 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+  { 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+  { 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+  { 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+  { 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+  { 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+  { 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+  { 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+  { 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+  { 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+  { 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+  { 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+  { 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+  { 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+  { 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+  { 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+  { 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+  { 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+  { 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+  { 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+  { 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+  { 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+  { 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+  { 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+  { 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+  { 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+  { 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+  { 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+  { 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+  { 0xd0, 0x90, 0x00, 2 }, { 0xd0, 0x91, 0x00, 2 }, { 0xd0, 0x92, 0x00, 2 }, { 0xd0, 0x93, 0x00, 2 },
+  { 0xd0, 0x94, 0x00, 2 }, { 0xd0, 0x95, 0x00, 2 }, { 0xd0, 0x96, 0x00, 2 }, { 0xd0, 0x97, 0x00, 2 },
+  { 0xd0, 0x98, 0x00, 2 }, { 0xd0, 0x99, 0x00, 2 }, { 0xd0, 0x9a, 0x00, 2 }, { 0xd0, 0x9b, 0x00, 2 },
+  { 0xd0, 0x9c, 0x00, 2 }, { 0xd0, 0x9d, 0x00, 2 }, { 0xd0, 0x9e, 0x00, 2 }, { 0xd0, 0x9f, 0x00, 2 },
+  { 0xd0, 0xa0, 0x00, 2 }, { 0xd0, 0xa1, 0x00, 2 }, { 0xd0, 0xa2, 0x00, 2 }, { 0xd0, 0xa3, 0x00, 2 },
+  { 0xd0, 0xa4, 0x00, 2 }, { 0xd0, 0xa5, 0x00, 2 }, { 0xd0, 0xa6, 0x00, 2 }, { 0xd0, 0xa7, 0x00, 2 },
+  { 0xd0, 0xa8, 0x00, 2 }, { 0xd0, 0xa9, 0x00, 2 }, { 0xd0, 0xaa, 0x00, 2 }, { 0xd0, 0xab, 0x00, 2 },
+  { 0xd0, 0xac, 0x00, 2 }, { 0xd0, 0xad, 0x00, 2 }, { 0xd0, 0xae, 0x00, 2 }, { 0xd0, 0xaf, 0x00, 2 },
+  { 0xd0, 0xb0, 0x00, 2 }, { 0xd0, 0xb1, 0x00, 2 }, { 0xd0, 0xb2, 0x00, 2 }, { 0xd0, 0xb3, 0x00, 2 },
+  { 0xd0, 0xb4, 0x00, 2 }, { 0xd0, 0xb5, 0x00, 2 }, { 0xd0, 0xb6, 0x00, 2 }, { 0xd0, 0xb7, 0x00, 2 },
+  { 0xd0, 0xb8, 0x00, 2 }, { 0xd0, 0xb9, 0x00, 2 }, { 0xd0, 0xba, 0x00, 2 }, { 0xd0, 0xbb, 0x00, 2 },
+  { 0xd0, 0xbc, 0x00, 2 }, { 0xd0, 0xbd, 0x00, 2 }, { 0xd0, 0xbe, 0x00, 2 }, { 0xd0, 0xbf, 0x00, 2 },
+  { 0xe2, 0x96, 0x91, 3 }, { 0xe2, 0x96, 0x92, 3 }, { 0xe2, 0x96, 0x93, 3 }, { 0xe2, 0x94, 0x82, 3 },
+  { 0xe2, 0x94, 0xa4, 3 }, { 0xe2, 0x95, 0xa1, 3 }, { 0xe2, 0x95, 0xa2, 3 }, { 0xe2, 0x95, 0x96, 3 },
+  { 0xe2, 0x95, 0x95, 3 }, { 0xe2, 0x95, 0xa3, 3 }, { 0xe2, 0x95, 0x91, 3 }, { 0xe2, 0x95, 0x97, 3 },
+  { 0xe2, 0x95, 0x9d, 3 }, { 0xe2, 0x95, 0x9c, 3 }, { 0xe2, 0x95, 0x9b, 3 }, { 0xe2, 0x94, 0x90, 3 },
+  { 0xe2, 0x94, 0x94, 3 }, { 0xe2, 0x94, 0xb4, 3 }, { 0xe2, 0x94, 0xac, 3 }, { 0xe2, 0x94, 0x9c, 3 },
+  { 0xe2, 0x94, 0x80, 3 }, { 0xe2, 0x94, 0xbc, 3 }, { 0xe2, 0x95, 0x9e, 3 }, { 0xe2, 0x95, 0x9f, 3 },
+  { 0xe2, 0x95, 0x9a, 3 }, { 0xe2, 0x95, 0x94, 3 }, { 0xe2, 0x95, 0xa9, 3 }, { 0xe2, 0x95, 0xa6, 3 },
+  { 0xe2, 0x95, 0xa0, 3 }, { 0xe2, 0x95, 0x90, 3 }, { 0xe2, 0x95, 0xac, 3 }, { 0xe2, 0x95, 0xa7, 3 },
+  { 0xe2, 0x95, 0xa8, 3 }, { 0xe2, 0x95, 0xa4, 3 }, { 0xe2, 0x95, 0xa5, 3 }, { 0xe2, 0x95, 0x99, 3 },
+  { 0xe2, 0x95, 0x98, 3 }, { 0xe2, 0x95, 0x92, 3 }, { 0xe2, 0x95, 0x93, 3 }, { 0xe2, 0x95, 0xab, 3 },
+  { 0xe2, 0x95, 0xaa, 3 }, { 0xe2, 0x94, 0x98, 3 }, { 0xe2, 0x94, 0x8c, 3 }, { 0xe2, 0x96, 0x88, 3 },
+  { 0xe2, 0x96, 0x84, 3 }, { 0xe2, 0x96, 0x8c, 3 }, { 0xe2, 0x96, 0x90, 3 }, { 0xe2, 0x96, 0x80, 3 },
+  { 0xd1, 0x80, 0x00, 2 }, { 0xd1, 0x81, 0x00, 2 }, { 0xd1, 0x82, 0x00, 2 }, { 0xd1, 0x83, 0x00, 2 },
+  { 0xd1, 0x84, 0x00, 2 }, { 0xd1, 0x85, 0x00, 2 }, { 0xd1, 0x86, 0x00, 2 }, { 0xd1, 0x87, 0x00, 2 },
+  { 0xd1, 0x88, 0x00, 2 }, { 0xd1, 0x89, 0x00, 2 }, { 0xd1, 0x8a, 0x00, 2 }, { 0xd1, 0x8b, 0x00, 2 },
+  { 0xd1, 0x8c, 0x00, 2 }, { 0xd1, 0x8d, 0x00, 2 }, { 0xd1, 0x8e, 0x00, 2 }, { 0xd1, 0x8f, 0x00, 2 },
+  { 0xd0, 0x81, 0x00, 2 }, { 0xd1, 0x91, 0x00, 2 }, { 0xd0, 0x84, 0x00, 2 }, { 0xd1, 0x94, 0x00, 2 },
+  { 0xd0, 0x87, 0x00, 2 }, { 0xd1, 0x97, 0x00, 2 }, { 0xd0, 0x8e, 0x00, 2 }, { 0xd1, 0x9e, 0x00, 2 },
+  { 0xc2, 0xb0, 0x00, 2 }, { 0xe2, 0x88, 0x99, 3 }, { 0xc2, 0xb7, 0x00, 2 }, { 0xe2, 0x88, 0x9a, 3 },
+  { 0xe2, 0x84, 0x96, 3 }, { 0xc2, 0xa4, 0x00, 2 }, { 0xe2, 0x96, 0xa0, 3 }, { 0xc2, 0xa0, 0x00, 2 },
+};
+
+static const guint8 encode_index_2086[256] =
+{
+  1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 3, 4, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const guint8 encode_pages_2086[6][256] =
+{
+  { 0 },
+  /* U+0000 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+0400 */
+  {
+    0x00, 0xf0, 0x00, 0x00, 0xf2, 0x00, 0x00, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf6, 0x00,
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f,
+    0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf,
+    0xe0, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef,
+    0x00, 0xf1, 0x00, 0x00, 0xf3, 0x00, 0x00, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+2100 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+2200 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+2500 */
+  {
+    0xc4, 0x00, 0xb3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xda, 0x00, 0x00, 0x00,
+    0xbf, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0xd9, 0x00, 0x00, 0x00, 0xc3, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc2, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xcd, 0xba, 0xd5, 0xd6, 0xc9, 0xb8, 0xb7, 0xbb, 0xd4, 0xd3, 0xc8, 0xbe, 0xbd, 0xbc, 0xc6, 0xc7,
+    0xcc, 0xb5, 0xb6, 0xb9, 0xd1, 0xd2, 0xcb, 0xcf, 0xd0, 0xca, 0xd8, 0xd7, 0xce, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xdf, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0x00, 0xdb, 0x00, 0x00, 0x00, 0xdd, 0x00, 0x00, 0x00,
+    0xde, 0xb0, 0xb1, 0xb2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+};
+
+
+/* KOI8-U, from koi8_u */
+static const guint8 decode_2088[256][4] =
+{
+  { 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+  { 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+  { 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+  { 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+  { 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+  { 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+  { 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+  { 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+  { 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+  { 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+  { 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+  { 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+  { 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+  { 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+  { 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+  { 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+  { 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+  { 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+  { 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+  { 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+  { 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+  { 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+  { 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+  { 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+  { 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+  { 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+  { 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+  { 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+  { 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+  { 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+  { 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+  { 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+  { 0xe2, 0x94, 0x80, 3 }, { 0xe2, 0x94, 0x82, 3 }, { 0xe2, 0x94, 0x8c, 3 }, { 0xe2, 0x94, 0x90, 3 },
+  { 0xe2, 0x94, 0x94, 3 }, { 0xe2, 0x94, 0x98, 3 }, { 0xe2, 0x94, 0x9c, 3 }, { 0xe2, 0x94, 0xa4, 3 },
+  { 0xe2, 0x94, 0xac, 3 }, { 0xe2, 0x94, 0xb4, 3 }, { 0xe2, 0x94, 0xbc, 3 }, { 0xe2, 0x96, 0x80, 3 },
+  { 0xe2, 0x96, 0x84, 3 }, { 0xe2, 0x96, 0x88, 3 }, { 0xe2, 0x96, 0x8c, 3 }, { 0xe2, 0x96, 0x90, 3 },
+  { 0xe2, 0x96, 0x91, 3 }, { 0xe2, 0x96, 0x92, 3 }, { 0xe2, 0x96, 0x93, 3 }, { 0xe2, 0x8c, 0xa0, 3 },
+  { 0xe2, 0x96, 0xa0, 3 }, { 0xe2, 0x88, 0x99, 3 }, { 0xe2, 0x88, 0x9a, 3 }, { 0xe2, 0x89, 0x88, 3 },
+  { 0xe2, 0x89, 0xa4, 3 }, { 0xe2, 0x89, 0xa5, 3 }, { 0xc2, 0xa0, 0x00, 2 }, { 0xe2, 0x8c, 0xa1, 3 },
+  { 0xc2, 0xb0, 0x00, 2 }, { 0xc2, 0xb2, 0x00, 2 }, { 0xc2, 0xb7, 0x00, 2 }, { 0xc3, 0xb7, 0x00, 2 },
+  { 0xe2, 0x95, 0x90, 3 }, { 0xe2, 0x95, 0x91, 3 }, { 0xe2, 0x95, 0x92, 3 }, { 0xd1, 0x91, 0x00, 2 },
+  { 0xd1, 0x94, 0x00, 2 }, { 0xe2, 0x95, 0x94, 3 }, { 0xd1, 0x96, 0x00, 2 }, { 0xd1, 0x97, 0x00, 2 },
+  { 0xe2, 0x95, 0x97, 3 }, { 0xe2, 0x95, 0x98, 3 }, { 0xe2, 0x95, 0x99, 3 }, { 0xe2, 0x95, 0x9a, 3 },
+  { 0xe2, 0x95, 0x9b, 3 }, { 0xd2, 0x91, 0x00, 2 }, { 0xe2, 0x95, 0x9d, 3 }, { 0xe2, 0x95, 0x9e, 3 },
+  { 0xe2, 0x95, 0x9f, 3 }, { 0xe2, 0x95, 0xa0, 3 }, { 0xe2, 0x95, 0xa1, 3 }, { 0xd0, 0x81, 0x00, 2 },
+  { 0xd0, 0x84, 0x00, 2 }, { 0xe2, 0x95, 0xa3, 3 }, { 0xd0, 0x86, 0x00, 2 }, { 0xd0, 0x87, 0x00, 2 },
+  { 0xe2, 0x95, 0xa6, 3 }, { 0xe2, 0x95, 0xa7, 3 }, { 0xe2, 0x95, 0xa8, 3 }, { 0xe2, 0x95, 0xa9, 3 },
+  { 0xe2, 0x95, 0xaa, 3 }, { 0xd2, 0x90, 0x00, 2 }, { 0xe2, 0x95, 0xac, 3 }, { 0xc2, 0xa9, 0x00, 2 },
+  { 0xd1, 0x8e, 0x00, 2 }, { 0xd0, 0xb0, 0x00, 2 }, { 0xd0, 0xb1, 0x00, 2 }, { 0xd1, 0x86, 0x00, 2 },
+  { 0xd0, 0xb4, 0x00, 2 }, { 0xd0, 0xb5, 0x00, 2 }, { 0xd1, 0x84, 0x00, 2 }, { 0xd0, 0xb3, 0x00, 2 },
+  { 0xd1, 0x85, 0x00, 2 }, { 0xd0, 0xb8, 0x00, 2 }, { 0xd0, 0xb9, 0x00, 2 }, { 0xd0, 0xba, 0x00, 2 },
+  { 0xd0, 0xbb, 0x00, 2 }, { 0xd0, 0xbc, 0x00, 2 }, { 0xd0, 0xbd, 0x00, 2 }, { 0xd0, 0xbe, 0x00, 2 },
+  { 0xd0, 0xbf, 0x00, 2 }, { 0xd1, 0x8f, 0x00, 2 }, { 0xd1, 0x80, 0x00, 2 }, { 0xd1, 0x81, 0x00, 2 },
+  { 0xd1, 0x82, 0x00, 2 }, { 0xd1, 0x83, 0x00, 2 }, { 0xd0, 0xb6, 0x00, 2 }, { 0xd0, 0xb2, 0x00, 2 },
+  { 0xd1, 0x8c, 0x00, 2 }, { 0xd1, 0x8b, 0x00, 2 }, { 0xd0, 0xb7, 0x00, 2 }, { 0xd1, 0x88, 0x00, 2 },
+  { 0xd1, 0x8d, 0x00, 2 }, { 0xd1, 0x89, 0x00, 2 }, { 0xd1, 0x87, 0x00, 2 }, { 0xd1, 0x8a, 0x00, 2 },
+  { 0xd0, 0xae, 0x00, 2 }, { 0xd0, 0x90, 0x00, 2 }, { 0xd0, 0x91, 0x00, 2 }, { 0xd0, 0xa6, 0x00, 2 },
+  { 0xd0, 0x94, 0x00, 2 }, { 0xd0, 0x95, 0x00, 2 }, { 0xd0, 0xa4, 0x00, 2 }, { 0xd0, 0x93, 0x00, 2 },
+  { 0xd0, 0xa5, 0x00, 2 }, { 0xd0, 0x98, 0x00, 2 }, { 0xd0, 0x99, 0x00, 2 }, { 0xd0, 0x9a, 0x00, 2 },
+  { 0xd0, 0x9b, 0x00, 2 }, { 0xd0, 0x9c, 0x00, 2 }, { 0xd0, 0x9d, 0x00, 2 }, { 0xd0, 0x9e, 0x00, 2 },
+  { 0xd0, 0x9f, 0x00, 2 }, { 0xd0, 0xaf, 0x00, 2 }, { 0xd0, 0xa0, 0x00, 2 }, { 0xd0, 0xa1, 0x00, 2 },
+  { 0xd0, 0xa2, 0x00, 2 }, { 0xd0, 0xa3, 0x00, 2 }, { 0xd0, 0x96, 0x00, 2 }, { 0xd0, 0x92, 0x00, 2 },
+  { 0xd0, 0xac, 0x00, 2 }, { 0xd0, 0xab, 0x00, 2 }, { 0xd0, 0x97, 0x00, 2 }, { 0xd0, 0xa8, 0x00, 2 },
+  { 0xd0, 0xad, 0x00, 2 }, { 0xd0, 0xa9, 0x00, 2 }, { 0xd0, 0xa7, 0x00, 2 }, { 0xd0, 0xaa, 0x00, 2 },
+};
+
+static const guint8 encode_index_2088[256] =
+{
+  1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 3, 4, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const guint8 encode_pages_2088[6][256] =
+{
+  { 0 },
+  /* U+0000 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x9c, 0x00, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+0400 */
+  {
+    0x00, 0xb3, 0x00, 0x00, 0xb4, 0x00, 0xb6, 0xb7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xe1, 0xe2, 0xf7, 0xe7, 0xe4, 0xe5, 0xf6, 0xfa, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef, 0xf0,
+    0xf2, 0xf3, 0xf4, 0xf5, 0xe6, 0xe8, 0xe3, 0xfe, 0xfb, 0xfd, 0xff, 0xf9, 0xf8, 0xfc, 0xe0, 0xf1,
+    0xc1, 0xc2, 0xd7, 0xc7, 0xc4, 0xc5, 0xd6, 0xda, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf, 0xd0,
+    0xd2, 0xd3, 0xd4, 0xd5, 0xc6, 0xc8, 0xc3, 0xde, 0xdb, 0xdd, 0xdf, 0xd9, 0xd8, 0xdc, 0xc0, 0xd1,
+    0x00, 0xa3, 0x00, 0x00, 0xa4, 0x00, 0xa6, 0xa7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xbd, 0xad, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+2200 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x98, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+2300 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x93, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+2500 */
+  {
+    0x80, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82, 0x00, 0x00, 0x00,
+    0x83, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x86, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xa0, 0xa1, 0xa2, 0x00, 0xa5, 0x00, 0x00, 0xa8, 0xa9, 0xaa, 0xab, 0xac, 0x00, 0xae, 0xaf, 0xb0,
+    0xb1, 0xb2, 0x00, 0xb5, 0x00, 0x00, 0xb8, 0xb9, 0xba, 0xbb, 0xbc, 0x00, 0xbe, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x8b, 0x00, 0x00, 0x00, 0x8c, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00,
+    0x8f, 0x90, 0x91, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+};
+
+
+/* windows-1250, from cp1250 */
+static const guint8 decode_2250[256][4] =
+{
+  { 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+  { 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+  { 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+  { 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+  { 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+  { 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+  { 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+  { 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+  { 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+  { 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+  { 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+  { 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+  { 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+  { 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+  { 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+  { 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+  { 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+  { 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+  { 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+  { 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+  { 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+  { 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+  { 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+  { 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+  { 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+  { 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+  { 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+  { 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+  { 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+  { 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+  { 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+  { 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+  { 0xe2, 0x82, 0xac, 3 }, { 0x00, 0x00, 0x00, 0 }, { 0xe2, 0x80, 0x9a, 3 }, { 0x00, 0x00, 0x00, 0 },
+  { 0xe2, 0x80, 0x9e, 3 }, { 0xe2, 0x80, 0xa6, 3 }, { 0xe2, 0x80, 0xa0, 3 }, { 0xe2, 0x80, 0xa1, 3 },
+  { 0x00, 0x00, 0x00, 0 }, { 0xe2, 0x80, 0xb0, 3 }, { 0xc5, 0xa0, 0x00, 2 }, { 0xe2, 0x80, 0xb9, 3 },
+  { 0xc5, 0x9a, 0x00, 2 }, { 0xc5, 0xa4, 0x00, 2 }, { 0xc5, 0xbd, 0x00, 2 }, { 0xc5, 0xb9, 0x00, 2 },
+  { 0x00, 0x00, 0x00, 0 }, { 0xe2, 0x80, 0x98, 3 }, { 0xe2, 0x80, 0x99, 3 }, { 0xe2, 0x80, 0x9c, 3 },
+  { 0xe2, 0x80, 0x9d, 3 }, { 0xe2, 0x80, 0xa2, 3 }, { 0xe2, 0x80, 0x93, 3 }, { 0xe2, 0x80, 0x94, 3 },
+  { 0x00, 0x00, 0x00, 0 }, { 0xe2, 0x84, 0xa2, 3 }, { 0xc5, 0xa1, 0x00, 2 }, { 0xe2, 0x80, 0xba, 3 },
+  { 0xc5, 0x9b, 0x00, 2 }, { 0xc5, 0xa5, 0x00, 2 }, { 0xc5, 0xbe, 0x00, 2 }, { 0xc5, 0xba, 0x00, 2 },
+  { 0xc2, 0xa0, 0x00, 2 }, { 0xcb, 0x87, 0x00, 2 }, { 0xcb, 0x98, 0x00, 2 }, { 0xc5, 0x81, 0x00, 2 },
+  { 0xc2, 0xa4, 0x00, 2 }, { 0xc4, 0x84, 0x00, 2 }, { 0xc2, 0xa6, 0x00, 2 }, { 0xc2, 0xa7, 0x00, 2 },
+  { 0xc2, 0xa8, 0x00, 2 }, { 0xc2, 0xa9, 0x00, 2 }, { 0xc5, 0x9e, 0x00, 2 }, { 0xc2, 0xab, 0x00, 2 },
+  { 0xc2, 0xac, 0x00, 2 }, { 0xc2, 0xad, 0x00, 2 }, { 0xc2, 0xae, 0x00, 2 }, { 0xc5, 0xbb, 0x00, 2 },
+  { 0xc2, 0xb0, 0x00, 2 }, { 0xc2, 0xb1, 0x00, 2 }, { 0xcb, 0x9b, 0x00, 2 }, { 0xc5, 0x82, 0x00, 2 },
+  { 0xc2, 0xb4, 0x00, 2 }, { 0xc2, 0xb5, 0x00, 2 }, { 0xc2, 0xb6, 0x00, 2 }, { 0xc2, 0xb7, 0x00, 2 },
+  { 0xc2, 0xb8, 0x00, 2 }, { 0xc4, 0x85, 0x00, 2 }, { 0xc5, 0x9f, 0x00, 2 }, { 0xc2, 0xbb, 0x00, 2 },
+  { 0xc4, 0xbd, 0x00, 2 }, { 0xcb, 0x9d, 0x00, 2 }, { 0xc4, 0xbe, 0x00, 2 }, { 0xc5, 0xbc, 0x00, 2 },
+  { 0xc5, 0x94, 0x00, 2 }, { 0xc3, 0x81, 0x00, 2 }, { 0xc3, 0x82, 0x00, 2 }, { 0xc4, 0x82, 0x00, 2 },
+  { 0xc3, 0x84, 0x00, 2 }, { 0xc4, 0xb9, 0x00, 2 }, { 0xc4, 0x86, 0x00, 2 }, { 0xc3, 0x87, 0x00, 2 },
+  { 0xc4, 0x8c, 0x00, 2 }, { 0xc3, 0x89, 0x00, 2 }, { 0xc4, 0x98, 0x00, 2 }, { 0xc3, 0x8b, 0x00, 2 },
+  { 0xc4, 0x9a, 0x00, 2 }, { 0xc3, 0x8d, 0x00, 2 }, { 0xc3, 0x8e, 0x00, 2 }, { 0xc4, 0x8e, 0x00, 2 },
+  { 0xc4, 0x90, 0x00, 2 }, { 0xc5, 0x83, 0x00, 2 }, { 0xc5, 0x87, 0x00, 2 }, { 0xc3, 0x93, 0x00, 2 },
+  { 0xc3, 0x94, 0x00, 2 }, { 0xc5, 0x90, 0x00, 2 }, { 0xc3, 0x96, 0x00, 2 }, { 0xc3, 0x97, 0x00, 2 },
+  { 0xc5, 0x98, 0x00, 2 }, { 0xc5, 0xae, 0x00, 2 }, { 0xc3, 0x9a, 0x00, 2 }, { 0xc5, 0xb0, 0x00, 2 },
+  { 0xc3, 0x9c, 0x00, 2 }, { 0xc3, 0x9d, 0x00, 2 }, { 0xc5, 0xa2, 0x00, 2 }, { 0xc3, 0x9f, 0x00, 2 },
+  { 0xc5, 0x95, 0x00, 2 }, { 0xc3, 0xa1, 0x00, 2 }, { 0xc3, 0xa2, 0x00, 2 }, { 0xc4, 0x83, 0x00, 2 },
+  { 0xc3, 0xa4, 0x00, 2 }, { 0xc4, 0xba, 0x00, 2 }, { 0xc4, 0x87, 0x00, 2 }, { 0xc3, 0xa7, 0x00, 2 },
+  { 0xc4, 0x8d, 0x00, 2 }, { 0xc3, 0xa9, 0x00, 2 }, { 0xc4, 0x99, 0x00, 2 }, { 0xc3, 0xab, 0x00, 2 },
+  { 0xc4, 0x9b, 0x00, 2 }, { 0xc3, 0xad, 0x00, 2 }, { 0xc3, 0xae, 0x00, 2 }, { 0xc4, 0x8f, 0x00, 2 },
+  { 0xc4, 0x91, 0x00, 2 }, { 0xc5, 0x84, 0x00, 2 }, { 0xc5, 0x88, 0x00, 2 }, { 0xc3, 0xb3, 0x00, 2 },
+  { 0xc3, 0xb4, 0x00, 2 }, { 0xc5, 0x91, 0x00, 2 }, { 0xc3, 0xb6, 0x00, 2 }, { 0xc3, 0xb7, 0x00, 2 },
+  { 0xc5, 0x99, 0x00, 2 }, { 0xc5, 0xaf, 0x00, 2 }, { 0xc3, 0xba, 0x00, 2 }, { 0xc5, 0xb1, 0x00, 2 },
+  { 0xc3, 0xbc, 0x00, 2 }, { 0xc3, 0xbd, 0x00, 2 }, { 0xc5, 0xa3, 0x00, 2 }, { 0xcb, 0x99, 0x00, 2 },
+};
+
+static const guint8 encode_index_2250[256] =
+{
+  1, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const guint8 encode_pages_2250[6][256] =
+{
+  { 0 },
+  /* U+0000 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xa0, 0x00, 0x00, 0x00, 0xa4, 0x00, 0xa6, 0xa7, 0xa8, 0xa9, 0x00, 0xab, 0xac, 0xad, 0xae, 0x00,
+    0xb0, 0xb1, 0x00, 0x00, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xc1, 0xc2, 0x00, 0xc4, 0x00, 0x00, 0xc7, 0x00, 0xc9, 0x00, 0xcb, 0x00, 0xcd, 0xce, 0x00,
+    0x00, 0x00, 0x00, 0xd3, 0xd4, 0x00, 0xd6, 0xd7, 0x00, 0x00, 0xda, 0x00, 0xdc, 0xdd, 0x00, 0xdf,
+    0x00, 0xe1, 0xe2, 0x00, 0xe4, 0x00, 0x00, 0xe7, 0x00, 0xe9, 0x00, 0xeb, 0x00, 0xed, 0xee, 0x00,
+    0x00, 0x00, 0x00, 0xf3, 0xf4, 0x00, 0xf6, 0xf7, 0x00, 0x00, 0xfa, 0x00, 0xfc, 0xfd, 0x00, 0x00,
+  },
+  /* U+0100 */
+  {
+    0x00, 0x00, 0xc3, 0xe3, 0xa5, 0xb9, 0xc6, 0xe6, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xe8, 0xcf, 0xef,
+    0xd0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0xea, 0xcc, 0xec, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc5, 0xe5, 0x00, 0x00, 0xbc, 0xbe, 0x00,
+    0x00, 0xa3, 0xb3, 0xd1, 0xf1, 0x00, 0x00, 0xd2, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xd5, 0xf5, 0x00, 0x00, 0xc0, 0xe0, 0x00, 0x00, 0xd8, 0xf8, 0x8c, 0x9c, 0x00, 0x00, 0xaa, 0xba,
+    0x8a, 0x9a, 0xde, 0xfe, 0x8d, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd9, 0xf9,
+    0xdb, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0x9f, 0xaf, 0xbf, 0x8e, 0x9e, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+0200 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa2, 0xff, 0x00, 0xb2, 0x00, 0xbd, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+2000 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x96, 0x97, 0x00, 0x00, 0x00, 0x91, 0x92, 0x82, 0x00, 0x93, 0x94, 0x84, 0x00,
+    0x86, 0x87, 0x95, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+2100 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+};
+
+
+/* windows-1251, from cp1251 */
+static const guint8 decode_2251[256][4] =
+{
+  { 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+  { 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+  { 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+  { 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+  { 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+  { 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+  { 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+  { 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+  { 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+  { 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+  { 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+  { 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+  { 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+  { 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+  { 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+  { 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+  { 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+  { 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+  { 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+  { 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+  { 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+  { 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+  { 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+  { 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+  { 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+  { 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+  { 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+  { 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+  { 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+  { 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+  { 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+  { 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+  { 0xd0, 0x82, 0x00, 2 }, { 0xd0, 0x83, 0x00, 2 }, { 0xe2, 0x80, 0x9a, 3 }, { 0xd1, 0x93, 0x00, 2 },
+  { 0xe2, 0x80, 0x9e, 3 }, { 0xe2, 0x80, 0xa6, 3 }, { 0xe2, 0x80, 0xa0, 3 }, { 0xe2, 0x80, 0xa1, 3 },
+  { 0xe2, 0x82, 0xac, 3 }, { 0xe2, 0x80, 0xb0, 3 }, { 0xd0, 0x89, 0x00, 2 }, { 0xe2, 0x80, 0xb9, 3 },
+  { 0xd0, 0x8a, 0x00, 2 }, { 0xd0, 0x8c, 0x00, 2 }, { 0xd0, 0x8b, 0x00, 2 }, { 0xd0, 0x8f, 0x00, 2 },
+  { 0xd1, 0x92, 0x00, 2 }, { 0xe2, 0x80, 0x98, 3 }, { 0xe2, 0x80, 0x99, 3 }, { 0xe2, 0x80, 0x9c, 3 },
+  { 0xe2, 0x80, 0x9d, 3 }, { 0xe2, 0x80, 0xa2, 3 }, { 0xe2, 0x80, 0x93, 3 }, { 0xe2, 0x80, 0x94, 3 },
+  { 0x00, 0x00, 0x00, 0 }, { 0xe2, 0x84, 0xa2, 3 }, { 0xd1, 0x99, 0x00, 2 }, { 0xe2, 0x80, 0xba, 3 },
+  { 0xd1, 0x9a, 0x00, 2 }, { 0xd1, 0x9c, 0x00, 2 }, { 0xd1, 0x9b, 0x00, 2 }, { 0xd1, 0x9f, 0x00, 2 },
+  { 0xc2, 0xa0, 0x00, 2 }, { 0xd0, 0x8e, 0x00, 2 }, { 0xd1, 0x9e, 0x00, 2 }, { 0xd0, 0x88, 0x00, 2 },
+  { 0xc2, 0xa4, 0x00, 2 }, { 0xd2, 0x90, 0x00, 2 }, { 0xc2, 0xa6, 0x00, 2 }, { 0xc2, 0xa7, 0x00, 2 },
+  { 0xd0, 0x81, 0x00, 2 }, { 0xc2, 0xa9, 0x00, 2 }, { 0xd0, 0x84, 0x00, 2 }, { 0xc2, 0xab, 0x00, 2 },
+  { 0xc2, 0xac, 0x00, 2 }, { 0xc2, 0xad, 0x00, 2 }, { 0xc2, 0xae, 0x00, 2 }, { 0xd0, 0x87, 0x00, 2 },
+  { 0xc2, 0xb0, 0x00, 2 }, { 0xc2, 0xb1, 0x00, 2 }, { 0xd0, 0x86, 0x00, 2 }, { 0xd1, 0x96, 0x00, 2 },
+  { 0xd2, 0x91, 0x00, 2 }, { 0xc2, 0xb5, 0x00, 2 }, { 0xc2, 0xb6, 0x00, 2 }, { 0xc2, 0xb7, 0x00, 2 },
+  { 0xd1, 0x91, 0x00, 2 }, { 0xe2, 0x84, 0x96, 3 }, { 0xd1, 0x94, 0x00, 2 }, { 0xc2, 0xbb, 0x00, 2 },
+  { 0xd1, 0x98, 0x00, 2 }, { 0xd0, 0x85, 0x00, 2 }, { 0xd1, 0x95, 0x00, 2 }, { 0xd1, 0x97, 0x00, 2 },
+  { 0xd0, 0x90, 0x00, 2 }, { 0xd0, 0x91, 0x00, 2 }, { 0xd0, 0x92, 0x00, 2 }, { 0xd0, 0x93, 0x00, 2 },
+  { 0xd0, 0x94, 0x00, 2 }, { 0xd0, 0x95, 0x00, 2 }, { 0xd0, 0x96, 0x00, 2 }, { 0xd0, 0x97, 0x00, 2 },
+  { 0xd0, 0x98, 0x00, 2 }, { 0xd0, 0x99, 0x00, 2 }, { 0xd0, 0x9a, 0x00, 2 }, { 0xd0, 0x9b, 0x00, 2 },
+  { 0xd0, 0x9c, 0x00, 2 }, { 0xd0, 0x9d, 0x00, 2 }, { 0xd0, 0x9e, 0x00, 2 }, { 0xd0, 0x9f, 0x00, 2 },
+  { 0xd0, 0xa0, 0x00, 2 }, { 0xd0, 0xa1, 0x00, 2 }, { 0xd0, 0xa2, 0x00, 2 }, { 0xd0, 0xa3, 0x00, 2 },
+  { 0xd0, 0xa4, 0x00, 2 }, { 0xd0, 0xa5, 0x00, 2 }, { 0xd0, 0xa6, 0x00, 2 }, { 0xd0, 0xa7, 0x00, 2 },
+  { 0xd0, 0xa8, 0x00, 2 }, { 0xd0, 0xa9, 0x00, 2 }, { 0xd0, 0xaa, 0x00, 2 }, { 0xd0, 0xab, 0x00, 2 },
+  { 0xd0, 0xac, 0x00, 2 }, { 0xd0, 0xad, 0x00, 2 }, { 0xd0, 0xae, 0x00, 2 }, { 0xd0, 0xaf, 0x00, 2 },
+  { 0xd0, 0xb0, 0x00, 2 }, { 0xd0, 0xb1, 0x00, 2 }, { 0xd0, 0xb2, 0x00, 2 }, { 0xd0, 0xb3, 0x00, 2 },
+  { 0xd0, 0xb4, 0x00, 2 }, { 0xd0, 0xb5, 0x00, 2 }, { 0xd0, 0xb6, 0x00, 2 }, { 0xd0, 0xb7, 0x00, 2 },
+  { 0xd0, 0xb8, 0x00, 2 }, { 0xd0, 0xb9, 0x00, 2 }, { 0xd0, 0xba, 0x00, 2 }, { 0xd0, 0xbb, 0x00, 2 },
+  { 0xd0, 0xbc, 0x00, 2 }, { 0xd0, 0xbd, 0x00, 2 }, { 0xd0, 0xbe, 0x00, 2 }, { 0xd0, 0xbf, 0x00, 2 },
+  { 0xd1, 0x80, 0x00, 2 }, { 0xd1, 0x81, 0x00, 2 }, { 0xd1, 0x82, 0x00, 2 }, { 0xd1, 0x83, 0x00, 2 },
+  { 0xd1, 0x84, 0x00, 2 }, { 0xd1, 0x85, 0x00, 2 }, { 0xd1, 0x86, 0x00, 2 }, { 0xd1, 0x87, 0x00, 2 },
+  { 0xd1, 0x88, 0x00, 2 }, { 0xd1, 0x89, 0x00, 2 }, { 0xd1, 0x8a, 0x00, 2 }, { 0xd1, 0x8b, 0x00, 2 },
+  { 0xd1, 0x8c, 0x00, 2 }, { 0xd1, 0x8d, 0x00, 2 }, { 0xd1, 0x8e, 0x00, 2 }, { 0xd1, 0x8f, 0x00, 2 },
+};
+
+static const guint8 encode_index_2251[256] =
+{
+  1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const guint8 encode_pages_2251[5][256] =
+{
+  { 0 },
+  /* U+0000 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xa0, 0x00, 0x00, 0x00, 0xa4, 0x00, 0xa6, 0xa7, 0x00, 0xa9, 0x00, 0xab, 0xac, 0xad, 0xae, 0x00,
+    0xb0, 0xb1, 0x00, 0x00, 0x00, 0xb5, 0xb6, 0xb7, 0x00, 0x00, 0x00, 0xbb, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+0400 */
+  {
+    0x00, 0xa8, 0x80, 0x81, 0xaa, 0xbd, 0xb2, 0xaf, 0xa3, 0x8a, 0x8c, 0x8e, 0x8d, 0x00, 0xa1, 0x8f,
+    0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+    0xd0, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xdb, 0xdc, 0xdd, 0xde, 0xdf,
+    0xe0, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff,
+    0x00, 0xb8, 0x90, 0x83, 0xba, 0xbe, 0xb3, 0xbf, 0xbc, 0x9a, 0x9c, 0x9e, 0x9d, 0x00, 0xa2, 0x9f,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xa5, 0xb4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+2000 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x96, 0x97, 0x00, 0x00, 0x00, 0x91, 0x92, 0x82, 0x00, 0x93, 0x94, 0x84, 0x00,
+    0x86, 0x87, 0x95, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+2100 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+};
+
+
+/* windows-1252, from cp1252 */
+static const guint8 decode_2252[256][4] =
+{
+  { 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+  { 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+  { 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+  { 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+  { 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+  { 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+  { 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+  { 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+  { 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+  { 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+  { 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+  { 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+  { 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+  { 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+  { 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+  { 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+  { 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+  { 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+  { 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+  { 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+  { 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+  { 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+  { 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+  { 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+  { 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+  { 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+  { 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+  { 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+  { 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+  { 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+  { 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+  { 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+  { 0xe2, 0x82, 0xac, 3 }, { 0x00, 0x00, 0x00, 0 }, { 0xe2, 0x80, 0x9a, 3 }, { 0xc6, 0x92, 0x00, 2 },
+  { 0xe2, 0x80, 0x9e, 3 }, { 0xe2, 0x80, 0xa6, 3 }, { 0xe2, 0x80, 0xa0, 3 }, { 0xe2, 0x80, 0xa1, 3 },
+  { 0xcb, 0x86, 0x00, 2 }, { 0xe2, 0x80, 0xb0, 3 }, { 0xc5, 0xa0, 0x00, 2 }, { 0xe2, 0x80, 0xb9, 3 },
+  { 0xc5, 0x92, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 }, { 0xc5, 0xbd, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0xe2, 0x80, 0x98, 3 }, { 0xe2, 0x80, 0x99, 3 }, { 0xe2, 0x80, 0x9c, 3 },
+  { 0xe2, 0x80, 0x9d, 3 }, { 0xe2, 0x80, 0xa2, 3 }, { 0xe2, 0x80, 0x93, 3 }, { 0xe2, 0x80, 0x94, 3 },
+  { 0xcb, 0x9c, 0x00, 2 }, { 0xe2, 0x84, 0xa2, 3 }, { 0xc5, 0xa1, 0x00, 2 }, { 0xe2, 0x80, 0xba, 3 },
+  { 0xc5, 0x93, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 }, { 0xc5, 0xbe, 0x00, 2 }, { 0xc5, 0xb8, 0x00, 2 },
+  { 0xc2, 0xa0, 0x00, 2 }, { 0xc2, 0xa1, 0x00, 2 }, { 0xc2, 0xa2, 0x00, 2 }, { 0xc2, 0xa3, 0x00, 2 },
+  { 0xc2, 0xa4, 0x00, 2 }, { 0xc2, 0xa5, 0x00, 2 }, { 0xc2, 0xa6, 0x00, 2 }, { 0xc2, 0xa7, 0x00, 2 },
+  { 0xc2, 0xa8, 0x00, 2 }, { 0xc2, 0xa9, 0x00, 2 }, { 0xc2, 0xaa, 0x00, 2 }, { 0xc2, 0xab, 0x00, 2 },
+  { 0xc2, 0xac, 0x00, 2 }, { 0xc2, 0xad, 0x00, 2 }, { 0xc2, 0xae, 0x00, 2 }, { 0xc2, 0xaf, 0x00, 2 },
+  { 0xc2, 0xb0, 0x00, 2 }, { 0xc2, 0xb1, 0x00, 2 }, { 0xc2, 0xb2, 0x00, 2 }, { 0xc2, 0xb3, 0x00, 2 },
+  { 0xc2, 0xb4, 0x00, 2 }, { 0xc2, 0xb5, 0x00, 2 }, { 0xc2, 0xb6, 0x00, 2 }, { 0xc2, 0xb7, 0x00, 2 },
+  { 0xc2, 0xb8, 0x00, 2 }, { 0xc2, 0xb9, 0x00, 2 }, { 0xc2, 0xba, 0x00, 2 }, { 0xc2, 0xbb, 0x00, 2 },
+  { 0xc2, 0xbc, 0x00, 2 }, { 0xc2, 0xbd, 0x00, 2 }, { 0xc2, 0xbe, 0x00, 2 }, { 0xc2, 0xbf, 0x00, 2 },
+  { 0xc3, 0x80, 0x00, 2 }, { 0xc3, 0x81, 0x00, 2 }, { 0xc3, 0x82, 0x00, 2 }, { 0xc3, 0x83, 0x00, 2 },
+  { 0xc3, 0x84, 0x00, 2 }, { 0xc3, 0x85, 0x00, 2 }, { 0xc3, 0x86, 0x00, 2 }, { 0xc3, 0x87, 0x00, 2 },
+  { 0xc3, 0x88, 0x00, 2 }, { 0xc3, 0x89, 0x00, 2 }, { 0xc3, 0x8a, 0x00, 2 }, { 0xc3, 0x8b, 0x00, 2 },
+  { 0xc3, 0x8c, 0x00, 2 }, { 0xc3, 0x8d, 0x00, 2 }, { 0xc3, 0x8e, 0x00, 2 }, { 0xc3, 0x8f, 0x00, 2 },
+  { 0xc3, 0x90, 0x00, 2 }, { 0xc3, 0x91, 0x00, 2 }, { 0xc3, 0x92, 0x00, 2 }, { 0xc3, 0x93, 0x00, 2 },
+  { 0xc3, 0x94, 0x00, 2 }, { 0xc3, 0x95, 0x00, 2 }, { 0xc3, 0x96, 0x00, 2 }, { 0xc3, 0x97, 0x00, 2 },
+  { 0xc3, 0x98, 0x00, 2 }, { 0xc3, 0x99, 0x00, 2 }, { 0xc3, 0x9a, 0x00, 2 }, { 0xc3, 0x9b, 0x00, 2 },
+  { 0xc3, 0x9c, 0x00, 2 }, { 0xc3, 0x9d, 0x00, 2 }, { 0xc3, 0x9e, 0x00, 2 }, { 0xc3, 0x9f, 0x00, 2 },
+  { 0xc3, 0xa0, 0x00, 2 }, { 0xc3, 0xa1, 0x00, 2 }, { 0xc3, 0xa2, 0x00, 2 }, { 0xc3, 0xa3, 0x00, 2 },
+  { 0xc3, 0xa4, 0x00, 2 }, { 0xc3, 0xa5, 0x00, 2 }, { 0xc3, 0xa6, 0x00, 2 }, { 0xc3, 0xa7, 0x00, 2 },
+  { 0xc3, 0xa8, 0x00, 2 }, { 0xc3, 0xa9, 0x00, 2 }, { 0xc3, 0xaa, 0x00, 2 }, { 0xc3, 0xab, 0x00, 2 },
+  { 0xc3, 0xac, 0x00, 2 }, { 0xc3, 0xad, 0x00, 2 }, { 0xc3, 0xae, 0x00, 2 }, { 0xc3, 0xaf, 0x00, 2 },
+  { 0xc3, 0xb0, 0x00, 2 }, { 0xc3, 0xb1, 0x00, 2 }, { 0xc3, 0xb2, 0x00, 2 }, { 0xc3, 0xb3, 0x00, 2 },
+  { 0xc3, 0xb4, 0x00, 2 }, { 0xc3, 0xb5, 0x00, 2 }, { 0xc3, 0xb6, 0x00, 2 }, { 0xc3, 0xb7, 0x00, 2 },
+  { 0xc3, 0xb8, 0x00, 2 }, { 0xc3, 0xb9, 0x00, 2 }, { 0xc3, 0xba, 0x00, 2 }, { 0xc3, 0xbb, 0x00, 2 },
+  { 0xc3, 0xbc, 0x00, 2 }, { 0xc3, 0xbd, 0x00, 2 }, { 0xc3, 0xbe, 0x00, 2 }, { 0xc3, 0xbf, 0x00, 2 },
+};
+
+static const guint8 encode_index_2252[256] =
+{
+  1, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const guint8 encode_pages_2252[6][256] =
+{
+  { 0 },
+  /* U+0000 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf,
+    0xb0, 0xb1, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xbb, 0xbc, 0xbd, 0xbe, 0xbf,
+    0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+    0xd0, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xdb, 0xdc, 0xdd, 0xde, 0xdf,
+    0xe0, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0xff,
+  },
+  /* U+0100 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x8c, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x8a, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x9e, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+0200 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+2000 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x96, 0x97, 0x00, 0x00, 0x00, 0x91, 0x92, 0x82, 0x00, 0x93, 0x94, 0x84, 0x00,
+    0x86, 0x87, 0x95, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+2100 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+};
+
+
+/* windows-1253, from cp1253 */
+static const guint8 decode_2253[256][4] =
+{
+  { 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+  { 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+  { 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+  { 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+  { 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+  { 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+  { 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+  { 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+  { 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+  { 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+  { 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+  { 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+  { 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+  { 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+  { 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+  { 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+  { 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+  { 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+  { 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+  { 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+  { 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+  { 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+  { 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+  { 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+  { 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+  { 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+  { 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+  { 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+  { 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+  { 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+  { 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+  { 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+  { 0xe2, 0x82, 0xac, 3 }, { 0x00, 0x00, 0x00, 0 }, { 0xe2, 0x80, 0x9a, 3 }, { 0xc6, 0x92, 0x00, 2 },
+  { 0xe2, 0x80, 0x9e, 3 }, { 0xe2, 0x80, 0xa6, 3 }, { 0xe2, 0x80, 0xa0, 3 }, { 0xe2, 0x80, 0xa1, 3 },
+  { 0x00, 0x00, 0x00, 0 }, { 0xe2, 0x80, 0xb0, 3 }, { 0x00, 0x00, 0x00, 0 }, { 0xe2, 0x80, 0xb9, 3 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0xe2, 0x80, 0x98, 3 }, { 0xe2, 0x80, 0x99, 3 }, { 0xe2, 0x80, 0x9c, 3 },
+  { 0xe2, 0x80, 0x9d, 3 }, { 0xe2, 0x80, 0xa2, 3 }, { 0xe2, 0x80, 0x93, 3 }, { 0xe2, 0x80, 0x94, 3 },
+  { 0x00, 0x00, 0x00, 0 }, { 0xe2, 0x84, 0xa2, 3 }, { 0x00, 0x00, 0x00, 0 }, { 0xe2, 0x80, 0xba, 3 },
+  { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0xc2, 0xa0, 0x00, 2 }, { 0xce, 0x85, 0x00, 2 }, { 0xce, 0x86, 0x00, 2 }, { 0xc2, 0xa3, 0x00, 2 },
+  { 0xc2, 0xa4, 0x00, 2 }, { 0xc2, 0xa5, 0x00, 2 }, { 0xc2, 0xa6, 0x00, 2 }, { 0xc2, 0xa7, 0x00, 2 },
+  { 0xc2, 0xa8, 0x00, 2 }, { 0xc2, 0xa9, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 }, { 0xc2, 0xab, 0x00, 2 },
+  { 0xc2, 0xac, 0x00, 2 }, { 0xc2, 0xad, 0x00, 2 }, { 0xc2, 0xae, 0x00, 2 }, { 0xe2, 0x80, 0x95, 3 },
+  { 0xc2, 0xb0, 0x00, 2 }, { 0xc2, 0xb1, 0x00, 2 }, { 0xc2, 0xb2, 0x00, 2 }, { 0xc2, 0xb3, 0x00, 2 },
+  { 0xce, 0x84, 0x00, 2 }, { 0xc2, 0xb5, 0x00, 2 }, { 0xc2, 0xb6, 0x00, 2 }, { 0xc2, 0xb7, 0x00, 2 },
+  { 0xce, 0x88, 0x00, 2 }, { 0xce, 0x89, 0x00, 2 }, { 0xce, 0x8a, 0x00, 2 }, { 0xc2, 0xbb, 0x00, 2 },
+  { 0xce, 0x8c, 0x00, 2 }, { 0xc2, 0xbd, 0x00, 2 }, { 0xce, 0x8e, 0x00, 2 }, { 0xce, 0x8f, 0x00, 2 },
+  { 0xce, 0x90, 0x00, 2 }, { 0xce, 0x91, 0x00, 2 }, { 0xce, 0x92, 0x00, 2 }, { 0xce, 0x93, 0x00, 2 },
+  { 0xce, 0x94, 0x00, 2 }, { 0xce, 0x95, 0x00, 2 }, { 0xce, 0x96, 0x00, 2 }, { 0xce, 0x97, 0x00, 2 },
+  { 0xce, 0x98, 0x00, 2 }, { 0xce, 0x99, 0x00, 2 }, { 0xce, 0x9a, 0x00, 2 }, { 0xce, 0x9b, 0x00, 2 },
+  { 0xce, 0x9c, 0x00, 2 }, { 0xce, 0x9d, 0x00, 2 }, { 0xce, 0x9e, 0x00, 2 }, { 0xce, 0x9f, 0x00, 2 },
+  { 0xce, 0xa0, 0x00, 2 }, { 0xce, 0xa1, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 }, { 0xce, 0xa3, 0x00, 2 },
+  { 0xce, 0xa4, 0x00, 2 }, { 0xce, 0xa5, 0x00, 2 }, { 0xce, 0xa6, 0x00, 2 }, { 0xce, 0xa7, 0x00, 2 },
+  { 0xce, 0xa8, 0x00, 2 }, { 0xce, 0xa9, 0x00, 2 }, { 0xce, 0xaa, 0x00, 2 }, { 0xce, 0xab, 0x00, 2 },
+  { 0xce, 0xac, 0x00, 2 }, { 0xce, 0xad, 0x00, 2 }, { 0xce, 0xae, 0x00, 2 }, { 0xce, 0xaf, 0x00, 2 },
+  { 0xce, 0xb0, 0x00, 2 }, { 0xce, 0xb1, 0x00, 2 }, { 0xce, 0xb2, 0x00, 2 }, { 0xce, 0xb3, 0x00, 2 },
+  { 0xce, 0xb4, 0x00, 2 }, { 0xce, 0xb5, 0x00, 2 }, { 0xce, 0xb6, 0x00, 2 }, { 0xce, 0xb7, 0x00, 2 },
+  { 0xce, 0xb8, 0x00, 2 }, { 0xce, 0xb9, 0x00, 2 }, { 0xce, 0xba, 0x00, 2 }, { 0xce, 0xbb, 0x00, 2 },
+  { 0xce, 0xbc, 0x00, 2 }, { 0xce, 0xbd, 0x00, 2 }, { 0xce, 0xbe, 0x00, 2 }, { 0xce, 0xbf, 0x00, 2 },
+  { 0xcf, 0x80, 0x00, 2 }, { 0xcf, 0x81, 0x00, 2 }, { 0xcf, 0x82, 0x00, 2 }, { 0xcf, 0x83, 0x00, 2 },
+  { 0xcf, 0x84, 0x00, 2 }, { 0xcf, 0x85, 0x00, 2 }, { 0xcf, 0x86, 0x00, 2 }, { 0xcf, 0x87, 0x00, 2 },
+  { 0xcf, 0x88, 0x00, 2 }, { 0xcf, 0x89, 0x00, 2 }, { 0xcf, 0x8a, 0x00, 2 }, { 0xcf, 0x8b, 0x00, 2 },
+  { 0xcf, 0x8c, 0x00, 2 }, { 0xcf, 0x8d, 0x00, 2 }, { 0xcf, 0x8e, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 },
+};
+
+static const guint8 encode_index_2253[256] =
+{
+  1, 2, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const guint8 encode_pages_2253[6][256] =
+{
+  { 0 },
+  /* U+0000 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xa0, 0x00, 0x00, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0x00, 0xab, 0xac, 0xad, 0xae, 0x00,
+    0xb0, 0xb1, 0xb2, 0xb3, 0x00, 0xb5, 0xb6, 0xb7, 0x00, 0x00, 0x00, 0xbb, 0x00, 0xbd, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+0100 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+0300 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xb4, 0xa1, 0xa2, 0x00, 0xb8, 0xb9, 0xba, 0x00, 0xbc, 0x00, 0xbe, 0xbf,
+    0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+    0xd0, 0xd1, 0x00, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xdb, 0xdc, 0xdd, 0xde, 0xdf,
+    0xe0, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0xfd, 0xfe, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+2000 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x96, 0x97, 0xaf, 0x00, 0x00, 0x91, 0x92, 0x82, 0x00, 0x93, 0x94, 0x84, 0x00,
+    0x86, 0x87, 0x95, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+2100 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+};
+
+
+/* windows-1254, from cp1254 */
+static const guint8 decode_2254[256][4] =
+{
+  { 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+  { 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+  { 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+  { 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+  { 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+  { 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+  { 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+  { 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+  { 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+  { 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+  { 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+  { 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+  { 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+  { 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+  { 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+  { 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+  { 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+  { 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+  { 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+  { 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+  { 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+  { 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+  { 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+  { 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+  { 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+  { 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+  { 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+  { 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+  { 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+  { 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+  { 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+  { 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+  { 0xe2, 0x82, 0xac, 3 }, { 0x00, 0x00, 0x00, 0 }, { 0xe2, 0x80, 0x9a, 3 }, { 0xc6, 0x92, 0x00, 2 },
+  { 0xe2, 0x80, 0x9e, 3 }, { 0xe2, 0x80, 0xa6, 3 }, { 0xe2, 0x80, 0xa0, 3 }, { 0xe2, 0x80, 0xa1, 3 },
+  { 0xcb, 0x86, 0x00, 2 }, { 0xe2, 0x80, 0xb0, 3 }, { 0xc5, 0xa0, 0x00, 2 }, { 0xe2, 0x80, 0xb9, 3 },
+  { 0xc5, 0x92, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+  { 0x00, 0x00, 0x00, 0 }, { 0xe2, 0x80, 0x98, 3 }, { 0xe2, 0x80, 0x99, 3 }, { 0xe2, 0x80, 0x9c, 3 },
+  { 0xe2, 0x80, 0x9d, 3 }, { 0xe2, 0x80, 0xa2, 3 }, { 0xe2, 0x80, 0x93, 3 }, { 0xe2, 0x80, 0x94, 3 },
+  { 0xcb, 0x9c, 0x00, 2 }, { 0xe2, 0x84, 0xa2, 3 }, { 0xc5, 0xa1, 0x00, 2 }, { 0xe2, 0x80, 0xba, 3 },
+  { 0xc5, 0x93, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0xc5, 0xb8, 0x00, 2 },
+  { 0xc2, 0xa0, 0x00, 2 }, { 0xc2, 0xa1, 0x00, 2 }, { 0xc2, 0xa2, 0x00, 2 }, { 0xc2, 0xa3, 0x00, 2 },
+  { 0xc2, 0xa4, 0x00, 2 }, { 0xc2, 0xa5, 0x00, 2 }, { 0xc2, 0xa6, 0x00, 2 }, { 0xc2, 0xa7, 0x00, 2 },
+  { 0xc2, 0xa8, 0x00, 2 }, { 0xc2, 0xa9, 0x00, 2 }, { 0xc2, 0xaa, 0x00, 2 }, { 0xc2, 0xab, 0x00, 2 },
+  { 0xc2, 0xac, 0x00, 2 }, { 0xc2, 0xad, 0x00, 2 }, { 0xc2, 0xae, 0x00, 2 }, { 0xc2, 0xaf, 0x00, 2 },
+  { 0xc2, 0xb0, 0x00, 2 }, { 0xc2, 0xb1, 0x00, 2 }, { 0xc2, 0xb2, 0x00, 2 }, { 0xc2, 0xb3, 0x00, 2 },
+  { 0xc2, 0xb4, 0x00, 2 }, { 0xc2, 0xb5, 0x00, 2 }, { 0xc2, 0xb6, 0x00, 2 }, { 0xc2, 0xb7, 0x00, 2 },
+  { 0xc2, 0xb8, 0x00, 2 }, { 0xc2, 0xb9, 0x00, 2 }, { 0xc2, 0xba, 0x00, 2 }, { 0xc2, 0xbb, 0x00, 2 },
+  { 0xc2, 0xbc, 0x00, 2 }, { 0xc2, 0xbd, 0x00, 2 }, { 0xc2, 0xbe, 0x00, 2 }, { 0xc2, 0xbf, 0x00, 2 },
+  { 0xc3, 0x80, 0x00, 2 }, { 0xc3, 0x81, 0x00, 2 }, { 0xc3, 0x82, 0x00, 2 }, { 0xc3, 0x83, 0x00, 2 },
+  { 0xc3, 0x84, 0x00, 2 }, { 0xc3, 0x85, 0x00, 2 }, { 0xc3, 0x86, 0x00, 2 }, { 0xc3, 0x87, 0x00, 2 },
+  { 0xc3, 0x88, 0x00, 2 }, { 0xc3, 0x89, 0x00, 2 }, { 0xc3, 0x8a, 0x00, 2 }, { 0xc3, 0x8b, 0x00, 2 },
+  { 0xc3, 0x8c, 0x00, 2 }, { 0xc3, 0x8d, 0x00, 2 }, { 0xc3, 0x8e, 0x00, 2 }, { 0xc3, 0x8f, 0x00, 2 },
+  { 0xc4, 0x9e, 0x00, 2 }, { 0xc3, 0x91, 0x00, 2 }, { 0xc3, 0x92, 0x00, 2 }, { 0xc3, 0x93, 0x00, 2 },
+  { 0xc3, 0x94, 0x00, 2 }, { 0xc3, 0x95, 0x00, 2 }, { 0xc3, 0x96, 0x00, 2 }, { 0xc3, 0x97, 0x00, 2 },
+  { 0xc3, 0x98, 0x00, 2 }, { 0xc3, 0x99, 0x00, 2 }, { 0xc3, 0x9a, 0x00, 2 }, { 0xc3, 0x9b, 0x00, 2 },
+  { 0xc3, 0x9c, 0x00, 2 }, { 0xc4, 0xb0, 0x00, 2 }, { 0xc5, 0x9e, 0x00, 2 }, { 0xc3, 0x9f, 0x00, 2 },
+  { 0xc3, 0xa0, 0x00, 2 }, { 0xc3, 0xa1, 0x00, 2 }, { 0xc3, 0xa2, 0x00, 2 }, { 0xc3, 0xa3, 0x00, 2 },
+  { 0xc3, 0xa4, 0x00, 2 }, { 0xc3, 0xa5, 0x00, 2 }, { 0xc3, 0xa6, 0x00, 2 }, { 0xc3, 0xa7, 0x00, 2 },
+  { 0xc3, 0xa8, 0x00, 2 }, { 0xc3, 0xa9, 0x00, 2 }, { 0xc3, 0xaa, 0x00, 2 }, { 0xc3, 0xab, 0x00, 2 },
+  { 0xc3, 0xac, 0x00, 2 }, { 0xc3, 0xad, 0x00, 2 }, { 0xc3, 0xae, 0x00, 2 }, { 0xc3, 0xaf, 0x00, 2 },
+  { 0xc4, 0x9f, 0x00, 2 }, { 0xc3, 0xb1, 0x00, 2 }, { 0xc3, 0xb2, 0x00, 2 }, { 0xc3, 0xb3, 0x00, 2 },
+  { 0xc3, 0xb4, 0x00, 2 }, { 0xc3, 0xb5, 0x00, 2 }, { 0xc3, 0xb6, 0x00, 2 }, { 0xc3, 0xb7, 0x00, 2 },
+  { 0xc3, 0xb8, 0x00, 2 }, { 0xc3, 0xb9, 0x00, 2 }, { 0xc3, 0xba, 0x00, 2 }, { 0xc3, 0xbb, 0x00, 2 },
+  { 0xc3, 0xbc, 0x00, 2 }, { 0xc4, 0xb1, 0x00, 2 }, { 0xc5, 0x9f, 0x00, 2 }, { 0xc3, 0xbf, 0x00, 2 },
+};
+
+static const guint8 encode_index_2254[256] =
+{
+  1, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const guint8 encode_pages_2254[6][256] =
+{
+  { 0 },
+  /* U+0000 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xa0, 0xa1, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0xaa, 0xab, 0xac, 0xad, 0xae, 0xaf,
+    0xb0, 0xb1, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0xba, 0xbb, 0xbc, 0xbd, 0xbe, 0xbf,
+    0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+    0x00, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7, 0xd8, 0xd9, 0xda, 0xdb, 0xdc, 0x00, 0x00, 0xdf,
+    0xe0, 0xe1, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7, 0xe8, 0xe9, 0xea, 0xeb, 0xec, 0xed, 0xee, 0xef,
+    0x00, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7, 0xf8, 0xf9, 0xfa, 0xfb, 0xfc, 0x00, 0x00, 0xff,
+  },
+  /* U+0100 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd0, 0xf0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xdd, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x8c, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xfe,
+    0x8a, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+0200 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+2000 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x96, 0x97, 0x00, 0x00, 0x00, 0x91, 0x92, 0x82, 0x00, 0x93, 0x94, 0x84, 0x00,
+    0x86, 0x87, 0x95, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+2100 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+};
+
+
+/* windows-1256, from cp1256 */
+static const guint8 decode_2256[256][4] =
+{
+  { 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+  { 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+  { 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+  { 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+  { 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+  { 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+  { 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+  { 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+  { 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+  { 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+  { 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+  { 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+  { 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+  { 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+  { 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+  { 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+  { 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+  { 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+  { 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+  { 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+  { 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+  { 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+  { 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+  { 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+  { 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+  { 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+  { 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+  { 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+  { 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+  { 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+  { 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+  { 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+  { 0xe2, 0x82, 0xac, 3 }, { 0xd9, 0xbe, 0x00, 2 }, { 0xe2, 0x80, 0x9a, 3 }, { 0xc6, 0x92, 0x00, 2 },
+  { 0xe2, 0x80, 0x9e, 3 }, { 0xe2, 0x80, 0xa6, 3 }, { 0xe2, 0x80, 0xa0, 3 }, { 0xe2, 0x80, 0xa1, 3 },
+  { 0xcb, 0x86, 0x00, 2 }, { 0xe2, 0x80, 0xb0, 3 }, { 0xd9, 0xb9, 0x00, 2 }, { 0xe2, 0x80, 0xb9, 3 },
+  { 0xc5, 0x92, 0x00, 2 }, { 0xda, 0x86, 0x00, 2 }, { 0xda, 0x98, 0x00, 2 }, { 0xda, 0x88, 0x00, 2 },
+  { 0xda, 0xaf, 0x00, 2 }, { 0xe2, 0x80, 0x98, 3 }, { 0xe2, 0x80, 0x99, 3 }, { 0xe2, 0x80, 0x9c, 3 },
+  { 0xe2, 0x80, 0x9d, 3 }, { 0xe2, 0x80, 0xa2, 3 }, { 0xe2, 0x80, 0x93, 3 }, { 0xe2, 0x80, 0x94, 3 },
+  { 0xda, 0xa9, 0x00, 2 }, { 0xe2, 0x84, 0xa2, 3 }, { 0xda, 0x91, 0x00, 2 }, { 0xe2, 0x80, 0xba, 3 },
+  { 0xc5, 0x93, 0x00, 2 }, { 0xe2, 0x80, 0x8c, 3 }, { 0xe2, 0x80, 0x8d, 3 }, { 0xda, 0xba, 0x00, 2 },
+  { 0xc2, 0xa0, 0x00, 2 }, { 0xd8, 0x8c, 0x00, 2 }, { 0xc2, 0xa2, 0x00, 2 }, { 0xc2, 0xa3, 0x00, 2 },
+  { 0xc2, 0xa4, 0x00, 2 }, { 0xc2, 0xa5, 0x00, 2 }, { 0xc2, 0xa6, 0x00, 2 }, { 0xc2, 0xa7, 0x00, 2 },
+  { 0xc2, 0xa8, 0x00, 2 }, { 0xc2, 0xa9, 0x00, 2 }, { 0xda, 0xbe, 0x00, 2 }, { 0xc2, 0xab, 0x00, 2 },
+  { 0xc2, 0xac, 0x00, 2 }, { 0xc2, 0xad, 0x00, 2 }, { 0xc2, 0xae, 0x00, 2 }, { 0xc2, 0xaf, 0x00, 2 },
+  { 0xc2, 0xb0, 0x00, 2 }, { 0xc2, 0xb1, 0x00, 2 }, { 0xc2, 0xb2, 0x00, 2 }, { 0xc2, 0xb3, 0x00, 2 },
+  { 0xc2, 0xb4, 0x00, 2 }, { 0xc2, 0xb5, 0x00, 2 }, { 0xc2, 0xb6, 0x00, 2 }, { 0xc2, 0xb7, 0x00, 2 },
+  { 0xc2, 0xb8, 0x00, 2 }, { 0xc2, 0xb9, 0x00, 2 }, { 0xd8, 0x9b, 0x00, 2 }, { 0xc2, 0xbb, 0x00, 2 },
+  { 0xc2, 0xbc, 0x00, 2 }, { 0xc2, 0xbd, 0x00, 2 }, { 0xc2, 0xbe, 0x00, 2 }, { 0xd8, 0x9f, 0x00, 2 },
+  { 0xdb, 0x81, 0x00, 2 }, { 0xd8, 0xa1, 0x00, 2 }, { 0xd8, 0xa2, 0x00, 2 }, { 0xd8, 0xa3, 0x00, 2 },
+  { 0xd8, 0xa4, 0x00, 2 }, { 0xd8, 0xa5, 0x00, 2 }, { 0xd8, 0xa6, 0x00, 2 }, { 0xd8, 0xa7, 0x00, 2 },
+  { 0xd8, 0xa8, 0x00, 2 }, { 0xd8, 0xa9, 0x00, 2 }, { 0xd8, 0xaa, 0x00, 2 }, { 0xd8, 0xab, 0x00, 2 },
+  { 0xd8, 0xac, 0x00, 2 }, { 0xd8, 0xad, 0x00, 2 }, { 0xd8, 0xae, 0x00, 2 }, { 0xd8, 0xaf, 0x00, 2 },
+  { 0xd8, 0xb0, 0x00, 2 }, { 0xd8, 0xb1, 0x00, 2 }, { 0xd8, 0xb2, 0x00, 2 }, { 0xd8, 0xb3, 0x00, 2 },
+  { 0xd8, 0xb4, 0x00, 2 }, { 0xd8, 0xb5, 0x00, 2 }, { 0xd8, 0xb6, 0x00, 2 }, { 0xc3, 0x97, 0x00, 2 },
+  { 0xd8, 0xb7, 0x00, 2 }, { 0xd8, 0xb8, 0x00, 2 }, { 0xd8, 0xb9, 0x00, 2 }, { 0xd8, 0xba, 0x00, 2 },
+  { 0xd9, 0x80, 0x00, 2 }, { 0xd9, 0x81, 0x00, 2 }, { 0xd9, 0x82, 0x00, 2 }, { 0xd9, 0x83, 0x00, 2 },
+  { 0xc3, 0xa0, 0x00, 2 }, { 0xd9, 0x84, 0x00, 2 }, { 0xc3, 0xa2, 0x00, 2 }, { 0xd9, 0x85, 0x00, 2 },
+  { 0xd9, 0x86, 0x00, 2 }, { 0xd9, 0x87, 0x00, 2 }, { 0xd9, 0x88, 0x00, 2 }, { 0xc3, 0xa7, 0x00, 2 },
+  { 0xc3, 0xa8, 0x00, 2 }, { 0xc3, 0xa9, 0x00, 2 }, { 0xc3, 0xaa, 0x00, 2 }, { 0xc3, 0xab, 0x00, 2 },
+  { 0xd9, 0x89, 0x00, 2 }, { 0xd9, 0x8a, 0x00, 2 }, { 0xc3, 0xae, 0x00, 2 }, { 0xc3, 0xaf, 0x00, 2 },
+  { 0xd9, 0x8b, 0x00, 2 }, { 0xd9, 0x8c, 0x00, 2 }, { 0xd9, 0x8d, 0x00, 2 }, { 0xd9, 0x8e, 0x00, 2 },
+  { 0xc3, 0xb4, 0x00, 2 }, { 0xd9, 0x8f, 0x00, 2 }, { 0xd9, 0x90, 0x00, 2 }, { 0xc3, 0xb7, 0x00, 2 },
+  { 0xd9, 0x91, 0x00, 2 }, { 0xc3, 0xb9, 0x00, 2 }, { 0xd9, 0x92, 0x00, 2 }, { 0xc3, 0xbb, 0x00, 2 },
+  { 0xc3, 0xbc, 0x00, 2 }, { 0xe2, 0x80, 0x8e, 3 }, { 0xe2, 0x80, 0x8f, 3 }, { 0xdb, 0x92, 0x00, 2 },
+};
+
+static const guint8 encode_index_2256[256] =
+{
+  1, 2, 3, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  5, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const guint8 encode_pages_2256[7][256] =
+{
+  { 0 },
+  /* U+0000 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xa0, 0x00, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6, 0xa7, 0xa8, 0xa9, 0x00, 0xab, 0xac, 0xad, 0xae, 0xaf,
+    0xb0, 0xb1, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0xb8, 0xb9, 0x00, 0xbb, 0xbc, 0xbd, 0xbe, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xe0, 0x00, 0xe2, 0x00, 0x00, 0x00, 0x00, 0xe7, 0xe8, 0xe9, 0xea, 0xeb, 0x00, 0x00, 0xee, 0xef,
+    0x00, 0x00, 0x00, 0x00, 0xf4, 0x00, 0x00, 0xf7, 0x00, 0xf9, 0x00, 0xfb, 0xfc, 0x00, 0x00, 0x00,
+  },
+  /* U+0100 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x8c, 0x9c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+0200 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+0600 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xa1, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0x00, 0x00, 0x00, 0xbf,
+    0x00, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf,
+    0xd0, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd8, 0xd9, 0xda, 0xdb, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xdc, 0xdd, 0xde, 0xdf, 0xe1, 0xe3, 0xe4, 0xe5, 0xe6, 0xec, 0xed, 0xf0, 0xf1, 0xf2, 0xf3, 0xf5,
+    0xf6, 0xf8, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x81, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x00, 0x8f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x9a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0x00, 0x00, 0x00, 0xaa, 0x00,
+    0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+2000 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9d, 0x9e, 0xfd, 0xfe,
+    0x00, 0x00, 0x00, 0x96, 0x97, 0x00, 0x00, 0x00, 0x91, 0x92, 0x82, 0x00, 0x93, 0x94, 0x84, 0x00,
+    0x86, 0x87, 0x95, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+2100 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+};
+
+
+/* windows-1257, from cp1257 */
+static const guint8 decode_2257[256][4] =
+{
+  { 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+  { 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+  { 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+  { 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+  { 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+  { 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+  { 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+  { 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+  { 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+  { 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+  { 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+  { 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+  { 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+  { 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+  { 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+  { 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+  { 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+  { 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+  { 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+  { 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+  { 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+  { 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+  { 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+  { 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+  { 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+  { 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+  { 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+  { 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+  { 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+  { 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+  { 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+  { 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+  { 0xe2, 0x82, 0xac, 3 }, { 0x00, 0x00, 0x00, 0 }, { 0xe2, 0x80, 0x9a, 3 }, { 0x00, 0x00, 0x00, 0 },
+  { 0xe2, 0x80, 0x9e, 3 }, { 0xe2, 0x80, 0xa6, 3 }, { 0xe2, 0x80, 0xa0, 3 }, { 0xe2, 0x80, 0xa1, 3 },
+  { 0x00, 0x00, 0x00, 0 }, { 0xe2, 0x80, 0xb0, 3 }, { 0x00, 0x00, 0x00, 0 }, { 0xe2, 0x80, 0xb9, 3 },
+  { 0x00, 0x00, 0x00, 0 }, { 0xc2, 0xa8, 0x00, 2 }, { 0xcb, 0x87, 0x00, 2 }, { 0xc2, 0xb8, 0x00, 2 },
+  { 0x00, 0x00, 0x00, 0 }, { 0xe2, 0x80, 0x98, 3 }, { 0xe2, 0x80, 0x99, 3 }, { 0xe2, 0x80, 0x9c, 3 },
+  { 0xe2, 0x80, 0x9d, 3 }, { 0xe2, 0x80, 0xa2, 3 }, { 0xe2, 0x80, 0x93, 3 }, { 0xe2, 0x80, 0x94, 3 },
+  { 0x00, 0x00, 0x00, 0 }, { 0xe2, 0x84, 0xa2, 3 }, { 0x00, 0x00, 0x00, 0 }, { 0xe2, 0x80, 0xba, 3 },
+  { 0x00, 0x00, 0x00, 0 }, { 0xc2, 0xaf, 0x00, 2 }, { 0xcb, 0x9b, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 },
+  { 0xc2, 0xa0, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 }, { 0xc2, 0xa2, 0x00, 2 }, { 0xc2, 0xa3, 0x00, 2 },
+  { 0xc2, 0xa4, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 }, { 0xc2, 0xa6, 0x00, 2 }, { 0xc2, 0xa7, 0x00, 2 },
+  { 0xc3, 0x98, 0x00, 2 }, { 0xc2, 0xa9, 0x00, 2 }, { 0xc5, 0x96, 0x00, 2 }, { 0xc2, 0xab, 0x00, 2 },
+  { 0xc2, 0xac, 0x00, 2 }, { 0xc2, 0xad, 0x00, 2 }, { 0xc2, 0xae, 0x00, 2 }, { 0xc3, 0x86, 0x00, 2 },
+  { 0xc2, 0xb0, 0x00, 2 }, { 0xc2, 0xb1, 0x00, 2 }, { 0xc2, 0xb2, 0x00, 2 }, { 0xc2, 0xb3, 0x00, 2 },
+  { 0xc2, 0xb4, 0x00, 2 }, { 0xc2, 0xb5, 0x00, 2 }, { 0xc2, 0xb6, 0x00, 2 }, { 0xc2, 0xb7, 0x00, 2 },
+  { 0xc3, 0xb8, 0x00, 2 }, { 0xc2, 0xb9, 0x00, 2 }, { 0xc5, 0x97, 0x00, 2 }, { 0xc2, 0xbb, 0x00, 2 },
+  { 0xc2, 0xbc, 0x00, 2 }, { 0xc2, 0xbd, 0x00, 2 }, { 0xc2, 0xbe, 0x00, 2 }, { 0xc3, 0xa6, 0x00, 2 },
+  { 0xc4, 0x84, 0x00, 2 }, { 0xc4, 0xae, 0x00, 2 }, { 0xc4, 0x80, 0x00, 2 }, { 0xc4, 0x86, 0x00, 2 },
+  { 0xc3, 0x84, 0x00, 2 }, { 0xc3, 0x85, 0x00, 2 }, { 0xc4, 0x98, 0x00, 2 }, { 0xc4, 0x92, 0x00, 2 },
+  { 0xc4, 0x8c, 0x00, 2 }, { 0xc3, 0x89, 0x00, 2 }, { 0xc5, 0xb9, 0x00, 2 }, { 0xc4, 0x96, 0x00, 2 },
+  { 0xc4, 0xa2, 0x00, 2 }, { 0xc4, 0xb6, 0x00, 2 }, { 0xc4, 0xaa, 0x00, 2 }, { 0xc4, 0xbb, 0x00, 2 },
+  { 0xc5, 0xa0, 0x00, 2 }, { 0xc5, 0x83, 0x00, 2 }, { 0xc5, 0x85, 0x00, 2 }, { 0xc3, 0x93, 0x00, 2 },
+  { 0xc5, 0x8c, 0x00, 2 }, { 0xc3, 0x95, 0x00, 2 }, { 0xc3, 0x96, 0x00, 2 }, { 0xc3, 0x97, 0x00, 2 },
+  { 0xc5, 0xb2, 0x00, 2 }, { 0xc5, 0x81, 0x00, 2 }, { 0xc5, 0x9a, 0x00, 2 }, { 0xc5, 0xaa, 0x00, 2 },
+  { 0xc3, 0x9c, 0x00, 2 }, { 0xc5, 0xbb, 0x00, 2 }, { 0xc5, 0xbd, 0x00, 2 }, { 0xc3, 0x9f, 0x00, 2 },
+  { 0xc4, 0x85, 0x00, 2 }, { 0xc4, 0xaf, 0x00, 2 }, { 0xc4, 0x81, 0x00, 2 }, { 0xc4, 0x87, 0x00, 2 },
+  { 0xc3, 0xa4, 0x00, 2 }, { 0xc3, 0xa5, 0x00, 2 }, { 0xc4, 0x99, 0x00, 2 }, { 0xc4, 0x93, 0x00, 2 },
+  { 0xc4, 0x8d, 0x00, 2 }, { 0xc3, 0xa9, 0x00, 2 }, { 0xc5, 0xba, 0x00, 2 }, { 0xc4, 0x97, 0x00, 2 },
+  { 0xc4, 0xa3, 0x00, 2 }, { 0xc4, 0xb7, 0x00, 2 }, { 0xc4, 0xab, 0x00, 2 }, { 0xc4, 0xbc, 0x00, 2 },
+  { 0xc5, 0xa1, 0x00, 2 }, { 0xc5, 0x84, 0x00, 2 }, { 0xc5, 0x86, 0x00, 2 }, { 0xc3, 0xb3, 0x00, 2 },
+  { 0xc5, 0x8d, 0x00, 2 }, { 0xc3, 0xb5, 0x00, 2 }, { 0xc3, 0xb6, 0x00, 2 }, { 0xc3, 0xb7, 0x00, 2 },
+  { 0xc5, 0xb3, 0x00, 2 }, { 0xc5, 0x82, 0x00, 2 }, { 0xc5, 0x9b, 0x00, 2 }, { 0xc5, 0xab, 0x00, 2 },
+  { 0xc3, 0xbc, 0x00, 2 }, { 0xc5, 0xbc, 0x00, 2 }, { 0xc5, 0xbe, 0x00, 2 }, { 0xcb, 0x99, 0x00, 2 },
+};
+
+static const guint8 encode_index_2257[256] =
+{
+  1, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const guint8 encode_pages_2257[6][256] =
+{
+  { 0 },
+  /* U+0000 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xa0, 0x00, 0xa2, 0xa3, 0xa4, 0x00, 0xa6, 0xa7, 0x8d, 0xa9, 0x00, 0xab, 0xac, 0xad, 0xae, 0x9d,
+    0xb0, 0xb1, 0xb2, 0xb3, 0xb4, 0xb5, 0xb6, 0xb7, 0x8f, 0xb9, 0x00, 0xbb, 0xbc, 0xbd, 0xbe, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xc4, 0xc5, 0xaf, 0x00, 0x00, 0xc9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xd3, 0x00, 0xd5, 0xd6, 0xd7, 0xa8, 0x00, 0x00, 0x00, 0xdc, 0x00, 0x00, 0xdf,
+    0x00, 0x00, 0x00, 0x00, 0xe4, 0xe5, 0xbf, 0x00, 0x00, 0xe9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xf3, 0x00, 0xf5, 0xf6, 0xf7, 0xb8, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00,
+  },
+  /* U+0100 */
+  {
+    0xc2, 0xe2, 0x00, 0x00, 0xc0, 0xe0, 0xc3, 0xe3, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xe8, 0x00, 0x00,
+    0x00, 0x00, 0xc7, 0xe7, 0x00, 0x00, 0xcb, 0xeb, 0xc6, 0xe6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xcc, 0xec, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0xee, 0x00, 0x00, 0xc1, 0xe1,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcd, 0xed, 0x00, 0x00, 0x00, 0xcf, 0xef, 0x00, 0x00, 0x00,
+    0x00, 0xd9, 0xf9, 0xd1, 0xf1, 0xd2, 0xf2, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd4, 0xf4, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xaa, 0xba, 0x00, 0x00, 0xda, 0xfa, 0x00, 0x00, 0x00, 0x00,
+    0xd0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdb, 0xfb, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xd8, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xca, 0xea, 0xdd, 0xfd, 0xde, 0xfe, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+0200 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x9e, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+2000 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x96, 0x97, 0x00, 0x00, 0x00, 0x91, 0x92, 0x82, 0x00, 0x93, 0x94, 0x84, 0x00,
+    0x86, 0x87, 0x95, 0x00, 0x00, 0x00, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8b, 0x9b, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+  /* U+2100 */
+  {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x99, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  },
+};
+
+
+const struct _SourceFileSingleByte source_file_single_byte_tables[] =
+{
+  { 3, decode_3, encode_index_3, encode_pages_3 },
+  { 4, decode_4, encode_index_4, encode_pages_4 },
+  { 5, decode_5, encode_index_5, encode_pages_5 },
+  { 6, decode_6, encode_index_6, encode_pages_6 },
+  { 7, decode_7, encode_index_7, encode_pages_7 },
+  { 8, decode_8, encode_index_8, encode_pages_8 },
+  { 9, decode_9, encode_index_9, encode_pages_9 },
+  { 10, decode_10, encode_index_10, encode_pages_10 },
+  { 11, decode_11, encode_index_11, encode_pages_11 },
+  { 12, decode_12, encode_index_12, encode_pages_12 },
+  { 13, decode_13, encode_index_13, encode_pages_13 },
+  { 109, decode_109, encode_index_109, encode_pages_109 },
+  { 110, decode_110, encode_index_110, encode_pages_110 },
+  { 111, decode_111, encode_index_111, encode_pages_111 },
+  { 112, decode_112, encode_index_112, encode_pages_112 },
+  { 2009, decode_2009, encode_index_2009, encode_pages_2009 },
+  { 2011, decode_2011, encode_index_2011, encode_pages_2011 },
+  { 2084, decode_2084, encode_index_2084, encode_pages_2084 },
+  { 2086, decode_2086, encode_index_2086, encode_pages_2086 },
+  { 2088, decode_2088, encode_index_2088, encode_pages_2088 },
+  { 2250, decode_2250, encode_index_2250, encode_pages_2250 },
+  { 2251, decode_2251, encode_index_2251, encode_pages_2251 },
+  { 2252, decode_2252, encode_index_2252, encode_pages_2252 },
+  { 2253, decode_2253, encode_index_2253, encode_pages_2253 },
+  { 2254, decode_2254, encode_index_2254, encode_pages_2254 },
+  { 2256, decode_2256, encode_index_2256, encode_pages_2256 },
+  { 2257, decode_2257, encode_index_2257, encode_pages_2257 },
+};
+
+const guint source_file_single_byte_tables_length = 27;
@@ -0,0 +1,17 @@
+#ifndef __SOURCESINGLEBYTETABLE_H__
+#define __SOURCESINGLEBYTETABLE_H__
+
+/* Provided by the generated singlebyte-table.c, see scripts/singlebyte2c.py */
+
+struct _SourceFileSingleByte
+{
+  gint            mib_enum;
+  const guint8  (*decode)[4];         /* UTF-8 bytes, then their count */
+  const guint8   *encode_index;       /* code point >> 8 -> page, 0 for none */
+  const guint8  (*encode_pages)[256]; /* code point & 0xff -> byte, 0 for none */
+};
+
+extern const struct _SourceFileSingleByte source_file_single_byte_tables[];
+extern const guint                        source_file_single_byte_tables_length;
+
+#endif /* __SOURCESINGLEBYTETABLE_H__ */
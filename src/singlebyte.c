@@ -0,0 +1,365 @@
+#include <string.h>
+#include <glib.h>
+#include <gio/gio.h>
+#include "charsets.h"
+#include "codec.h"
+#include "singlebyte.h"
+#include "singlebyte-table.h"
+
+
+/*
+ * Built-in transcoders for the common single-byte charsets, so loading
+ * and saving them doesn't go through iconv. Decoding looks every byte up
+ * in a 256-entry table of UTF-8 sequences, generated at build time by
+ * scripts/singlebyte2c.py, and always copies four bytes so the length
+ * is never branched on; blocks that are all ASCII are copied as they
+ * are, 16 bytes at a time with SSE2 and 8 without. Encoding copies ASCII
+ * the same way and looks everything else up in a two-level table of the
+ * code points the charset has. They are used through codec.c, and
+ * whatever isn't in the tables still goes through iconv.
+ */
+
+#ifdef __SSE2__
+#  include <emmintrin.h>
+#endif
+
+
+#define ASCII_MASK_64 G_GUINT64_CONSTANT (0x8080808080808080)
+
+
+/* runs count bytes through the table, four output bytes each, and
+ * returns how many were decoded before an undefined one, if any */
+static inline gsize
+decode_block (const guint8 (*decode)[4], const guchar *p, gsize count, gchar **out)
+{
+  const guint8 *entry;
+  gchar        *o = *out;
+  gsize         i;
+
+  for (i = 0; i < count; i++)
+    {
+      entry = decode[p[i]];
+      if (G_UNLIKELY (!entry[3]))
+        break;
+      memcpy (o, entry, 4);
+      o += entry[3];
+    }
+
+  *out = o;
+
+  return i;
+}
+
+
+/* the end of the input, where there is less room to be sloppy */
+static inline const guchar *
+decode_tail (const guint8 (*decode)[4], const guchar *p, const guchar *end,
+             gchar **out, gchar *out_end)
+{
+  const guint8 *entry;
+  gchar        *o = *out;
+
+  for (; p < end; p++)
+    {
+      entry = decode[*p];
+      if (!entry[3] || (gsize) (out_end - o) < entry[3])
+        break;
+      memcpy (o, entry, entry[3]);
+      o += entry[3];
+    }
+
+  *out = o;
+
+  return p;
+}
+
+
+static gsize
+decode_scalar (const SourceFileSingleByte *charset,
+               const guchar *p, const guchar *end,
+               gchar *out, gchar *out_end,
+               gsize *n_read)
+{
+  const guchar *start = p;
+  gchar        *o = out;
+  guint64       w;
+  gsize         n;
+
+  while (end - p >= 8 && out_end - o >= 32)
+    {
+      memcpy (&w, p, 8);
+      if (!(w & ASCII_MASK_64))
+        {
+          memcpy (o, &w, 8);
+          o += 8;
+          p += 8;
+          continue;
+        }
+
+      n = decode_block (charset->decode, p, 8, &o);
+      p += n;
+      if (n < 8)
+        goto out;
+    }
+
+  p = decode_tail (charset->decode, p, end, &o, out_end);
+
+out:
+  *n_read = p - start;
+
+  return o - out;
+}
+
+
+/* encodes non-ASCII characters until the next ASCII byte, the end, or
+ * one that is incomplete, invalid or not in the charset, none of which
+ * can be encoded: all single-byte charsets are in the BMP */
+static inline const guchar *
+encode_run (const SourceFileSingleByte *charset,
+            const guchar *p, const guchar *end,
+            gchar **out, gchar *out_end)
+{
+  gchar   *o = *out;
+  gunichar ch;
+  guint    n;
+  guint8   byte;
+
+  while (p < end && o < out_end && *p >= 0xc2 && *p < 0xf0)
+    {
+      if (*p < 0xe0)
+        {
+          if (end - p < 2 || (p[1] & 0xc0) != 0x80)
+            break;
+          ch = ((p[0] & 0x1f) << 6) | (p[1] & 0x3f);
+          n = 2;
+        }
+      else
+        {
+          if (end - p < 3 || (p[1] & 0xc0) != 0x80 || (p[2] & 0xc0) != 0x80)
+            break;
+          ch = ((p[0] & 0x0f) << 12) | ((p[1] & 0x3f) << 6) | (p[2] & 0x3f);
+          n = 3;
+          /* overlong; surrogates just aren't in any table */
+          if (ch < 0x800)
+            break;
+        }
+
+      byte = charset->encode_pages[charset->encode_index[ch >> 8]][ch & 0xff];
+      if (!byte)
+        break;
+
+      *o++ = byte;
+      p += n;
+    }
+
+  *out = o;
+
+  return p;
+}
+
+
+static gsize
+encode_scalar (const SourceFileSingleByte *charset,
+               const guchar *p, const guchar *end,
+               gchar *out, gchar *out_end,
+               gsize *n_read)
+{
+  const guchar *start = p, *next;
+  gchar        *o = out;
+  guint64       w;
+
+  while (p < end && o < out_end)
+    {
+      for (; end - p >= 8 && out_end - o >= 8; p += 8, o += 8)
+        {
+          memcpy (&w, p, 8);
+          if (w & ASCII_MASK_64)
+            break;
+          memcpy (o, &w, 8);
+        }
+
+      for (; p < end && o < out_end && *p < 0x80; p++)
+        *o++ = *p;
+
+      next = encode_run (charset, p, end, &o, out_end);
+      if (next == p && p < end && o < out_end)
+        break;
+      p = next;
+    }
+
+  *n_read = p - start;
+
+  return o - out;
+}
+
+
+#ifdef __SSE2__
+
+static gsize
+decode_sse2 (const SourceFileSingleByte *charset,
+             const guchar *p, const guchar *end,
+             gchar *out, gchar *out_end,
+             gsize *n_read)
+{
+  const guchar *start = p;
+  gchar        *o = out;
+  __m128i       input;
+  gsize         n;
+
+  while (end - p >= 16 && out_end - o >= 64)
+    {
+      input = _mm_loadu_si128 ((const __m128i *) p);
+      if (!_mm_movemask_epi8 (input))
+        {
+          _mm_storeu_si128 ((__m128i *) o, input);
+          o += 16;
+          p += 16;
+          continue;
+        }
+
+      n = decode_block (charset->decode, p, 16, &o);
+      p += n;
+      if (n < 16)
+        goto out;
+    }
+
+  p = decode_tail (charset->decode, p, end, &o, out_end);
+
+out:
+  *n_read = p - start;
+
+  return o - out;
+}
+
+
+static gsize
+encode_sse2 (const SourceFileSingleByte *charset,
+             const guchar *p, const guchar *end,
+             gchar *out, gchar *out_end,
+             gsize *n_read)
+{
+  const guchar *start = p, *next;
+  gchar        *o = out;
+  __m128i       input;
+  gint          mask;
+
+  while (p < end && o < out_end)
+    {
+      while (end - p >= 16 && out_end - o >= 16)
+        {
+          input = _mm_loadu_si128 ((const __m128i *) p);
+          _mm_storeu_si128 ((__m128i *) o, input);
+
+          mask = _mm_movemask_epi8 (input);
+          if (mask)
+            {
+              p += __builtin_ctz (mask);
+              o += __builtin_ctz (mask);
+              break;
+            }
+          p += 16;
+          o += 16;
+        }
+
+      for (; p < end && o < out_end && *p < 0x80; p++)
+        *o++ = *p;
+
+      next = encode_run (charset, p, end, &o, out_end);
+      if (next == p && p < end && o < out_end)
+        break;
+      p = next;
+    }
+
+  *n_read = p - start;
+
+  return o - out;
+}
+
+#endif /* __SSE2__ */
+
+
+const SourceFileSingleByte *
+source_file_single_byte_lookup (const gchar *charset_name)
+{
+  const SourceFileCharset *charset;
+  guint                    i;
+
+  charset = source_file_lookup_charset (charset_name);
+  if (!charset)
+    return NULL;
+
+  for (i = 0; i < source_file_single_byte_tables_length; i++)
+    if (source_file_single_byte_tables[i].mib_enum == charset->mib_enum)
+      return &source_file_single_byte_tables[i];
+
+  return NULL;
+}
+
+
+/*
+ * Decodes as much of input as fits into output, stopping early at a byte
+ * the charset doesn't have. codec is a SourceFileSingleByte. Every byte
+ * becomes at most three.
+ */
+SourceFileCodecStatus
+source_file_single_byte_decode (gconstpointer  codec,
+                                const gchar   *input,
+                                gsize          input_length,
+                                gchar         *output,
+                                gsize          output_size,
+                                gsize         *n_read,
+                                gsize         *n_written)
+{
+  const SourceFileSingleByte *charset = codec;
+  const guchar               *p = (const guchar *) input;
+
+#ifdef __SSE2__
+  if (source_file_codec_use_simd ())
+    *n_written = decode_sse2 (charset, p, p + input_length, output, output + output_size, n_read);
+  else
+#endif
+    *n_written = decode_scalar (charset, p, p + input_length, output, output + output_size, n_read);
+
+  if (*n_read == input_length)
+    return SOURCE_FILE_CODEC_DONE;
+
+  return charset->decode[p[*n_read]][3] ? SOURCE_FILE_CODEC_NO_SPACE : SOURCE_FILE_CODEC_INVALID;
+}
+
+
+/*
+ * The other way round: encodes UTF-8 input into output, stopping early at
+ * a character that is incomplete, invalid or that the charset can't
+ * encode. Output never needs to be longer than input.
+ */
+SourceFileCodecStatus
+source_file_single_byte_encode (gconstpointer  codec,
+                                const gchar   *input,
+                                gsize          input_length,
+                                gchar         *output,
+                                gsize          output_size,
+                                gsize         *n_read,
+                                gsize         *n_written)
+{
+  const SourceFileSingleByte *charset = codec;
+  const guchar               *p = (const guchar *) input;
+  gunichar                    ch;
+
+#ifdef __SSE2__
+  if (source_file_codec_use_simd ())
+    *n_written = encode_sse2 (charset, p, p + input_length, output, output + output_size, n_read);
+  else
+#endif
+    *n_written = encode_scalar (charset, p, p + input_length, output, output + output_size, n_read);
+
+  if (*n_read == input_length)
+    return SOURCE_FILE_CODEC_DONE;
+
+  ch = g_utf8_get_char_validated (input + *n_read, input_length - *n_read);
+  if (ch == (gunichar) -2)
+    return SOURCE_FILE_CODEC_PARTIAL;
+  else if (ch != (gunichar) -1 && *n_written == output_size)
+    return SOURCE_FILE_CODEC_NO_SPACE;
+
+  return SOURCE_FILE_CODEC_INVALID;
+}
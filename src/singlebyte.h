@@ -0,0 +1,31 @@
+#ifndef __SOURCESINGLEBYTE_H__
+#define __SOURCESINGLEBYTE_H__
+
+G_BEGIN_DECLS
+
+
+/* an opaque pointer to a built-in table, NULL for charsets without one */
+typedef struct _SourceFileSingleByte SourceFileSingleByte;
+
+
+/* both are SourceFileCodecFuncs over a SourceFileSingleByte */
+const SourceFileSingleByte *source_file_single_byte_lookup (const gchar   *charset_name);
+SourceFileCodecStatus       source_file_single_byte_decode (gconstpointer  codec,
+                                                            const gchar   *input,
+                                                            gsize          input_length,
+                                                            gchar         *output,
+                                                            gsize          output_size,
+                                                            gsize         *n_read,
+                                                            gsize         *n_written);
+SourceFileCodecStatus       source_file_single_byte_encode (gconstpointer  codec,
+                                                            const gchar   *input,
+                                                            gsize          input_length,
+                                                            gchar         *output,
+                                                            gsize          output_size,
+                                                            gsize         *n_read,
+                                                            gsize         *n_written);
+
+
+G_END_DECLS
+
+#endif /* __SOURCESINGLEBYTE_H__ */
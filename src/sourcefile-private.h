@@ -0,0 +1,42 @@
+#ifndef __SOURCEFILE_PRIVATE_H__
+#define __SOURCEFILE_PRIVATE_H__
+
+G_BEGIN_DECLS
+
+
+/* how source_file_guess_charset_full() came to its answer, surest first */
+typedef enum
+{
+  SOURCE_FILE_GUESS_DECLARATION,
+  SOURCE_FILE_GUESS_BOM,
+  SOURCE_FILE_GUESS_ASCII,
+  SOURCE_FILE_GUESS_UTF8,
+  SOURCE_FILE_GUESS_DETECTOR,
+  SOURCE_FILE_GUESS_LOCALE,
+  SOURCE_FILE_GUESS_FALLBACK
+} SourceFileGuessMethod;
+
+
+/*
+ * The detection steps source_file_new() goes through, exported for the
+ * benchmarks in test/ and the tools in tools/. Not part of the API.
+ */
+const gchar *source_file_guess_charset      (SourceFile            *file,
+                                             const gchar           *buffer,
+                                             gsize                  length);
+const gchar *source_file_guess_charset_full (SourceFile            *file,
+                                             const gchar           *buffer,
+                                             gsize                  length,
+                                             SourceFileGuessMethod *method);
+const gchar *source_file_guess_mime_type    (SourceFile            *file,
+                                             const gchar           *buffer,
+                                             gsize                  length);
+
+/* the name guess_mime_type() goes by, without loading or watching it */
+void         source_file_set_sniff_filename (SourceFile            *file,
+                                             const gchar           *filename);
+
+
+G_END_DECLS
+
+#endif /* __SOURCEFILE_PRIVATE_H__ */
@@ -1,39 +1,115 @@
+#include <errno.h>
 #include <stdlib.h>
 #include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
 #include <glib.h>
+#include <glib/gstdio.h>
 #include <gio/gio.h>
 #include "sourcefile.h"
+#include "sourcefile-private.h"
 
 
 #ifdef HAVE_UCHARDET
 #  include <uchardet.h>
 #endif
 
-#ifdef HAVE_MAGIC
-#  include <magic.h>
-#endif
+#include "charsets.h"
+#include "codec.h"
+#include "detectcache.h"
+#include "dirwatch.h"
+#include "iconvcache.h"
+#include "magicpool.h"
+#include "modeline.h"
+#include "pagedfile.h"
+#include "piecetable.h"
+#include "stats.h"
+#include "utf8scan.h"
 
 
-#include "charsets.h"
+/* bytes before the old end of a followed file that must be unchanged */
+#define SOURCE_FILE_FOLLOW_WINDOW 4096
+
+/* blocks of that size sampled from the rest of it, the first at the start */
+#define SOURCE_FILE_FOLLOW_SAMPLES 8
+
+
+/* streaming content hash, see source_file_hash_update() */
+typedef struct
+{
+  guint64 hash;
+  guint64 length;
+  guint64 tail;
+  guint   n_tail;
+} SourceFileHash;
+
+
+/*
+ * What the file looked like on disk when it was last loaded or saved.
+ * key.size is how many bytes of the file were read or written, which
+ * with follow can be fewer than it has now; content is the hash of
+ * those bytes (left open so appends can carry on from it),
+ * window_hash the hash of the SOURCE_FILE_FOLLOW_WINDOW bytes before
+ * key.size and sample_hash that of the blocks source_file_hash_samples()
+ * picks.
+ */
+typedef struct
+{
+  gboolean            known;
+  gboolean            exists;
+  SourceFileDetectKey key;
+  SourceFileHash      content;
+  guint64             window_hash;
+  guint64             sample_hash;
+} SourceFileDiskState;
+
+
+/* what a save has written so far, so it needn't be read back */
+typedef struct
+{
+  SourceFileHash content;
+  gchar          window[SOURCE_FILE_FOLLOW_WINDOW];  /* the last bytes */
+  gsize          window_length;
+} SourceFileWritten;
 
 
 struct _SourceFilePrivate
 {
   gchar            *filename;
-  gchar            *charset;
-  gchar            *mime_type;
+  const gchar      *charset;     /* canonical or interned, never freed */
+  const gchar      *mime_type;   /* interned */
   SourceFileBuffer *buffer;
   gboolean          externally_modified;
-  GRegex           *regex_charset;
-  GFile            *file;
-  GFileMonitor     *file_monitor;
-  guint             file_handler_id;
+  SourceFileWatch  *watch;
+  SourceFileSniffPolicy *sniff_policy;
+  GBytes           *bytes;
+  gboolean          zero_copy;
+  gboolean          make_backup;
+  gboolean          sync;
+  SourceFilePieceTable *pieces;
+  gboolean          buffer_stale;
+  GArray           *line_starts;
+  guint             line_shift_from;
+  gssize            line_shift;
+  SourceFileDiskState disk;
+  gboolean          notified;
+  gboolean          notified_exists;
+  SourceFileDetectKey notified_key;
+  guint             notify_delay;
+  GSource          *notify_source;
+  gboolean          follow;
+  SourceFilePager  *pager;
+  guint64           page_threshold;
+  gsize             page_budget;
+  SourceFileStats   load_stats;
+  SourceFileStats   save_stats;
 };
 
 
 enum
 {
   SIGNAL_EXTERNALLY_MODIFIED,
+  SIGNAL_APPENDED,
   SIGNAL_LAST
 };
 
@@ -41,18 +117,46 @@ enum
 static guint source_file_signals[SIGNAL_LAST] = { 0 };
 
 
+G_LOCK_DEFINE_STATIC (default_sniff_policy);
+static SourceFileSniffPolicy default_sniff_policy =
+{
+  SOURCE_FILE_SNIFF_MODELINE_LINES,
+  SOURCE_FILE_SNIFF_CHUNK_SIZE,
+  SOURCE_FILE_SNIFF_MAX_BYTES
+};
+
+
 static void     source_file_finalize             (GObject *object);
-#ifndef HAVE_UCHARDET
-static gchar   *source_file_scan_unicode_bom      (const gchar *buffer, gsize length);
-#endif
-static gchar   *source_file_guess_charset         (SourceFile *file, const gchar *buffer, gsize length);
-static gchar   *source_file_guess_mime_type       (SourceFile *file, const gchar *buffer, gsize length);
-#if 0
+static const gchar *
+                source_file_scan_unicode_bom      (const gchar *buffer, gsize length);
+static const SourceFileCharset *
+                source_file_scan_charset_declaration (const gchar *buffer, gsize length,
+                                                      const SourceFileSniffPolicy *policy);
+static const gchar *
+                source_file_guess_charset_policy  (SourceFile *file, const gchar *buffer, gsize length,
+                                                   const SourceFileSniffPolicy *policy,
+                                                   SourceFileGuessMethod *method);
 static SourceFileLineEnding
                 source_file_guess_line_endings    (SourceFile *file);
-#endif
+static void     source_file_clear_buffer          (SourceFile *file);
+static gboolean source_file_charset_is_utf8       (const gchar *charset);
+static GConverter *
+                source_file_converter_new         (const gchar *to_charset, const gchar *from_charset,
+                                                   GError **error);
+static void     source_file_flatten_buffer        (SourceFile *file);
+static void     source_file_copy_range            (SourceFile *file, gsize offset, gsize length, gchar *dest);
+static void     source_file_ensure_line_index     (SourceFile *file);
+static gsize    source_file_line_start            (SourceFile *file, guint line);
 static gboolean source_file_store_buffer          (SourceFile *file);
 static gboolean source_file_load_buffer           (SourceFile *file);
+static void     source_file_monitor_filename      (SourceFile *file);
+static void     source_file_read_disk_state       (const gchar *filename, SourceFileDiskState *disk);
+static void     source_file_hash_init             (SourceFileHash *h);
+static void     source_file_hash_update           (SourceFileHash *h, const gchar *data, gsize length);
+static guint64  source_file_hash_bytes            (const gchar *data, gsize length);
+static gboolean source_file_hash_samples          (const gchar *data, gint fd, guint64 end,
+                                                   guint64 *hash);
+static void     source_file_set_disk_state        (SourceFile *file, const SourceFileDiskState *disk);
 
 
 G_DEFINE_TYPE(SourceFile, source_file, G_TYPE_OBJECT)
@@ -68,16 +172,29 @@ source_file_class_init (SourceFileClass *klass)
   g_type_class_add_private((gpointer)klass, sizeof(SourceFilePrivate));
 
   source_file_signals[SIGNAL_EXTERNALLY_MODIFIED] =
-    g_signal_newv ("externally-modified",
-                   G_TYPE_FROM_CLASS (g_object_class),
-                   G_SIGNAL_RUN_LAST | G_SIGNAL_NO_RECURSE | G_SIGNAL_NO_HOOKS,
-                   NULL,
-                   NULL,
-                   NULL,
-                   g_cclosure_marshal_VOID__VOID,
-                   G_TYPE_NONE,
-                   0,
-                   NULL);
+    g_signal_new ("externally-modified",
+                  G_TYPE_FROM_CLASS (g_object_class),
+                  G_SIGNAL_RUN_LAST | G_SIGNAL_NO_RECURSE | G_SIGNAL_NO_HOOKS,
+                  0,
+                  NULL,
+                  NULL,
+                  g_cclosure_marshal_VOID__UINT,
+                  G_TYPE_NONE,
+                  1,
+                  G_TYPE_UINT);
+
+  source_file_signals[SIGNAL_APPENDED] =
+    g_signal_new ("appended",
+                  G_TYPE_FROM_CLASS (g_object_class),
+                  G_SIGNAL_RUN_LAST | G_SIGNAL_NO_RECURSE | G_SIGNAL_NO_HOOKS,
+                  0,
+                  NULL,
+                  NULL,
+                  NULL,
+                  G_TYPE_NONE,
+                  2,
+                  G_TYPE_UINT64,
+                  G_TYPE_UINT64);
 }
 
 
@@ -92,17 +209,18 @@ source_file_finalize (GObject *object)
   self = SOURCE_FILE(object);
 
   /* cleanup resources */
-  g_free (self->priv->charset);
-  g_free (self->priv->mime_type);
   g_free (self->priv->filename);
-  g_free (self->priv->buffer->data);
+  source_file_clear_buffer (self);
   g_free (self->priv->buffer);
+  g_free (self->priv->sniff_policy);
 
-  if (self->priv->regex_charset)
-    g_regex_unref (self->priv->regex_charset);
+  source_file_watch_remove (self->priv->watch);
 
-  if (self->priv->file)
-    g_object_unref (self->priv->file);
+  if (self->priv->notify_source)
+    {
+      g_source_destroy (self->priv->notify_source);
+      g_source_unref (self->priv->notify_source);
+    }
 
   G_OBJECT_CLASS(source_file_parent_class)->finalize(object);
 }
@@ -110,8 +228,6 @@ source_file_finalize (GObject *object)
 
 static void source_file_init(SourceFile *self)
 {
-  GError *error;
-
   self->priv = G_TYPE_INSTANCE_GET_PRIVATE (self,
                                             SOURCE_TYPE_FILE,
                                             SourceFilePrivate);
@@ -123,26 +239,29 @@ static void source_file_init(SourceFile *self)
   self->priv->buffer          = g_new0 (SourceFileBuffer, 1);
   self->priv->buffer->data    = NULL;
   self->priv->buffer->length  = 0;
-  self->priv->file            = NULL;
-  self->priv->file_handler_id = 0;
-
-  /* pre-compile regular expression(s) */
-  error = NULL;
-  self->priv->regex_charset = g_regex_new (SOURCE_FILE_CHARSET_PATTERN,
-                                           G_REGEX_CASELESS,
-                                           G_REGEX_MATCH_NEWLINE_ANY,
-                                           &error);
-  if (error)
-    {
-      g_warning ("Failed to compile regular expression pattern: %s", error->message);
-      g_error_free (error);
-      self->priv->regex_charset = NULL;
-    }
+  self->priv->watch           = NULL;
+  self->priv->sniff_policy    = NULL;
+  self->priv->bytes           = NULL;
+  self->priv->zero_copy       = FALSE;
+  self->priv->make_backup     = FALSE;
+  self->priv->sync            = FALSE;
+  self->priv->pieces          = NULL;
+  self->priv->buffer_stale    = FALSE;
+  self->priv->line_starts     = NULL;
+  self->priv->line_shift_from = 0;
+  self->priv->line_shift      = 0;
+  self->priv->disk.known      = FALSE;
+  self->priv->notified        = FALSE;
+  self->priv->notify_delay    = SOURCE_FILE_NOTIFY_DELAY;
+  self->priv->notify_source   = NULL;
+  self->priv->follow          = FALSE;
+  self->priv->pager           = NULL;
+  self->priv->page_threshold  = 0;
+  self->priv->page_budget     = SOURCE_FILE_PAGE_BUDGET;
 }
 
 
-#ifndef HAVE_UCHARDET
-static gchar *
+static const gchar *
 source_file_scan_unicode_bom (const gchar *buffer, gsize length)
 {
 
@@ -152,7 +271,7 @@ source_file_scan_unicode_bom (const gchar *buffer, gsize length)
           (guchar)buffer[1] == 0xbb &&
           (guchar)buffer[2] == 0xbf)
         {
-          return g_strdup ("UTF-8");
+          return "UTF-8";
         }
     }
 
@@ -163,7 +282,7 @@ source_file_scan_unicode_bom (const gchar *buffer, gsize length)
 				  (guchar)buffer[2] == 0xfe &&
           (guchar)buffer[3] == 0xff)
         {
-          return g_strdup ("UTF-32BE");
+          return "UTF-32BE";
         }
 
       if ((guchar)buffer[0] == 0xff &&
@@ -171,7 +290,7 @@ source_file_scan_unicode_bom (const gchar *buffer, gsize length)
           (guchar)buffer[2] == 0x00 &&
           (guchar)buffer[3] == 0x00)
         {
-          return g_strdup ("UTF-32LE");
+          return "UTF-32LE";
         }
 
       if ((buffer[0] == 0x2b &&
@@ -182,7 +301,7 @@ source_file_scan_unicode_bom (const gchar *buffer, gsize length)
            buffer[3] == 0x2b ||
            buffer[3] == 0x2f))
         {
-          return g_strdup ("UTF-7");
+          return "UTF-7";
         }
     }
 
@@ -191,86 +310,199 @@ source_file_scan_unicode_bom (const gchar *buffer, gsize length)
       if ((guchar)buffer[0] == 0xfe &&
           (guchar)buffer[1] == 0xff)
         {
-          return g_strdup ("UTF-16BE");
+          return "UTF-16BE";
         }
 
       if ((guchar)buffer[0] == 0xff &&
           (guchar)buffer[1] == 0xfe)
         {
-          return g_strdup ("UTF-16LE");
+          return "UTF-16LE";
         }
     }
 
 	return NULL;
 }
-#endif
 
 
-static gchar *
+/* offset just past the first n_lines lines of buffer */
+static gsize
+source_file_skip_lines_forward (const gchar *buffer, gsize length, guint n_lines)
+{
+  const gchar *p, *end;
+
+  p = buffer;
+  end = buffer + length;
+
+  while (n_lines-- > 0 && p < end)
+    {
+      p = memchr (p, '\n', end - p);
+      if (!p)
+        return length;
+      p++;
+    }
+
+  return p - buffer;
+}
+
+
+/* offset of the start of the last n_lines lines of buffer */
+static gsize
+source_file_skip_lines_backward (const gchar *buffer, gsize length, guint n_lines)
+{
+  gsize i = length;
+
+  /* a trailing newline doesn't start another line */
+  if (i > 0 && buffer[i - 1] == '\n')
+    i--;
+
+  for (; i > 0 && n_lines > 0; i--)
+    {
+      if (buffer[i - 1] == '\n' && --n_lines == 0)
+        break;
+    }
+
+  return i;
+}
+
+
+/* Looks for a modeline/declaration only in the first and last
+ * policy->modeline_lines lines, each side capped at policy->max_bytes,
+ * which is where editors and markup put them anyway. */
+static const SourceFileCharset *
+source_file_scan_charset_declaration (const gchar                 *buffer,
+                                      gsize                        length,
+                                      const SourceFileSniffPolicy *policy)
+{
+  const SourceFileCharset *charset;
+  gsize                    head_end, tail_start;
+
+  if (policy->modeline_lines == 0)
+    return source_file_scan_declaration (buffer, length);
+
+  head_end = source_file_skip_lines_forward (buffer, length, policy->modeline_lines);
+  tail_start = source_file_skip_lines_backward (buffer, length, policy->modeline_lines);
+
+  if (policy->max_bytes)
+    {
+      head_end = MIN (head_end, policy->max_bytes);
+      if (length - tail_start > policy->max_bytes)
+        tail_start = length - policy->max_bytes;
+    }
+
+  /* short file, the head and tail windows overlap */
+  if (tail_start <= head_end)
+    return source_file_scan_declaration (buffer, length);
+
+  charset = source_file_scan_declaration (buffer, head_end);
+  if (!charset)
+    charset = source_file_scan_declaration (buffer + tail_start, length - tail_start);
+
+  return charset;
+}
+
+
+const gchar *
 source_file_guess_charset (SourceFile *file, const gchar *buffer, gsize length)
 {
-  gchar      *charset = NULL;
-  GMatchInfo *info;
-  GError     *error;
-  const SourceFileCharset *cs;
+  return source_file_guess_charset_full (file, buffer, length, NULL);
+}
+
+
+const gchar *
+source_file_guess_charset_full (SourceFile            *file,
+                                const gchar           *buffer,
+                                gsize                  length,
+                                SourceFileGuessMethod *method)
+{
+  SourceFileSniffPolicy policy;
 
   g_return_val_if_fail (SOURCE_IS_FILE (file), NULL);
   g_return_val_if_fail (buffer, NULL);
   g_return_val_if_fail (length, NULL);
 
-  /* TODO: could limit to the start/end of the file */
-  info = NULL;
-  error = NULL;
-  if (g_regex_match_full (file->priv->regex_charset,
-                          buffer, length,
-                          0, 0, &info, &error))
-    {
-      charset = g_match_info_fetch (info, SOURCE_FILE_CHARSET_PATTERN_MATCH);
-      if (!charset || strlen (charset) == 1)
-        {
-          g_free (charset);
-          charset = NULL;
-        }
-    }
+  source_file_get_sniff_policy (file, &policy);
+
+  return source_file_guess_charset_policy (file, buffer, length, &policy, method);
+}
+
+
+static const gchar *
+source_file_guess_charset_policy (SourceFile                  *file,
+                                  const gchar                 *buffer,
+                                  gsize                        length,
+                                  const SourceFileSniffPolicy *policy,
+                                  SourceFileGuessMethod       *method)
+{
+  const gchar             *charset = NULL;
+  const SourceFileCharset *cs;
+  SourceFileGuessMethod    how = SOURCE_FILE_GUESS_DECLARATION;
+  gint64                   start;
+
+  /* only names in the charset table are ever taken from a declaration */
+  start = source_file_stats_phase_start ();
+  cs = source_file_scan_charset_declaration (buffer, length, policy);
+  if (cs)
+    charset = cs->name;
+  source_file_stats_phase_end (&file->priv->load_stats, SOURCE_FILE_PHASE_MODELINE, start, length);
 
-  g_match_info_free (info);
+  start = source_file_stats_phase_start ();
 
-  if (error)
+  /* a byte order mark settles it without looking any further */
+  if (!charset)
     {
-      g_warning ("Error matching regular expression: %s", error->message);
-      g_error_free (error);
+      how = SOURCE_FILE_GUESS_BOM;
+      charset = source_file_scan_unicode_bom (buffer, length);
     }
 
-  /* since the regular expressions can match arbitrary strings, we
-   * need to make sure it's a real charset name */
-  if (charset)
+  /* and neither ASCII nor valid UTF-8 need the statistical detector */
+  if (!charset)
     {
-      if (!source_file_charset_exists (charset))
+      gsize window = length;
+
+      if (policy->max_bytes && policy->max_bytes < window)
+        window = policy->max_bytes;
+
+      if (source_file_is_ascii (buffer, window))
+        {
+          how = SOURCE_FILE_GUESS_ASCII;
+          charset = "US-ASCII";
+        }
+      else if (source_file_utf8_validate (buffer,
+                                          window - source_file_utf8_incomplete_tail (buffer, window)))
         {
-          g_warning ("Detected charset name '%s' is not known so "
-                     "is not being used", charset);
-          g_free (charset);
-          charset = NULL;
+          how = SOURCE_FILE_GUESS_UTF8;
+          charset = "UTF-8";
         }
     }
 
+#ifdef HAVE_UCHARDET
   if (!charset)
     {
-#ifdef HAVE_UCHARDET
       uchardet_t   ud;
-      const gchar *cs;
+      const gchar *cs = NULL;
+      gsize        budget;
+
+      budget = length;
+      if (policy->max_bytes && policy->max_bytes < budget)
+        budget = policy->max_bytes;
+
+      /* uchardet can't say how sure it is until the data has ended, so
+       * it is simply handed the byte budget; a wrong guess is caught by
+       * the load, which then tries again over the whole file */
       ud = uchardet_new ();
-      uchardet_handle_data (ud, buffer, length);
-      uchardet_data_end (ud);
-      cs = uchardet_get_charset (ud);
+      if (uchardet_handle_data (ud, buffer, budget) == 0)
+        {
+          uchardet_data_end (ud);
+          cs = uchardet_get_charset (ud);
+        }
       if (cs && strlen (cs))
-        charset = g_strdup (cs);
+        {
+          how = SOURCE_FILE_GUESS_DETECTOR;
+          charset = source_file_intern_charset_name (cs);
+        }
       uchardet_delete (ud);
-#else
-      charset = source_file_scan_unicode_bom (file->priv->buffer->data,
-                                              file->priv->buffer->length);
-#endif
     }
+#endif
 
   if (!charset)
     {
@@ -280,45 +512,59 @@ source_file_guess_charset (SourceFile *file, const gchar *buffer, gsize length)
           ((s = getenv ("LANG")) && *s))
         {
           if (strstr (s, "UTF-8"))
-            charset = g_strdup ("UTF-8");
+            {
+              how = SOURCE_FILE_GUESS_LOCALE;
+              charset = "UTF-8";
+            }
         }
     }
 
   if (!charset)
-    charset = g_strdup (SOURCE_FILE_FALLBACK_CHARSET);
-
-  /* normalize the name */
-  cs = source_file_lookup_charset (charset);
-  if (cs)
     {
-      g_free (charset);
-      charset = g_strdup (cs->name);
+      how = SOURCE_FILE_GUESS_FALLBACK;
+      charset = SOURCE_FILE_FALLBACK_CHARSET;
     }
 
+  /* the table's copy of the name, or an interned one */
+  charset = source_file_intern_charset_name (charset);
+
+  source_file_stats_phase_end (&file->priv->load_stats, SOURCE_FILE_PHASE_CHARSET, start, length);
+
+  if (method)
+    *method = how;
+
   return charset;
 }
 
 
-static gchar *
+const gchar *
 source_file_guess_mime_type (SourceFile *file, const gchar *buffer, gsize length)
 {
-  gchar *mime_type = NULL;
+  const gchar *mime_type = NULL;
+  gint64       start;
 
 #ifdef HAVE_MAGIC
   const gchar *mbuf;
   magic_t      cookie;
+#endif
 
-  cookie = magic_open (MAGIC_MIME_TYPE);
-  mbuf = magic_buffer (cookie, buffer, length);
-  if (mbuf)
-    mime_type = g_strdup (mbuf);
+  start = source_file_stats_phase_start ();
 
-  magic_close (cookie);
+#ifdef HAVE_MAGIC
+  cookie = source_file_magic_pool_acquire ();
+  if (cookie)
+    {
+      mbuf = magic_buffer (cookie, buffer, length);
+      if (mbuf)
+        mime_type = g_intern_string (mbuf);
+
+      source_file_magic_pool_release (cookie);
+    }
 #endif
 
   if (!mime_type)
     {
-      gchar    *content_type;
+      gchar    *content_type, *type;
       gboolean  result_uncertain;
 
       content_type = g_content_type_guess (file->priv->filename,
@@ -327,51 +573,57 @@ source_file_guess_mime_type (SourceFile *file, const gchar *buffer, gsize length
                                            &result_uncertain);
 
       if (!result_uncertain)
-        mime_type = g_content_type_get_mime_type (content_type);
+        {
+          type = g_content_type_get_mime_type (content_type);
+          mime_type = g_intern_string (type);
+          g_free (type);
+        }
 
       g_free (content_type);
     }
 
+  source_file_stats_phase_end (&file->priv->load_stats, SOURCE_FILE_PHASE_MIME_TYPE, start, length);
+
   return mime_type;
 }
 
 
-#if 0
+/* the most common line break among the first lines, LF if there are none */
 static SourceFileLineEnding
 source_file_guess_line_endings (SourceFile *file)
 {
 #define LIMIT_LINES 50
 
-  gsize i;
-  gint  cr, lf, crlf, lines, max_mode;
+  guint i, n_lines;
+  gint  cr, lf, crlf, max_mode;
+  gsize start;
+  gchar tail[2];
   SourceFileLineEnding eol;
 
-  cr = lf = crlf = lines = max_mode = 0;
+  cr = lf = crlf = max_mode = 0;
+
+  source_file_ensure_line_index (file);
+  n_lines = MIN (file->priv->line_starts->len, LIMIT_LINES + 1);
 
-  for (i = 0; i < file->priv->buffer->length; i++)
+  /* look at the break(s) just before the start of each line */
+  for (i = 1; i < n_lines; i++)
     {
-      switch (file->priv->buffer->data[i])
+      start = source_file_line_start (file, i);
+
+      if (start - source_file_line_start (file, i - 1) >= 2)
+        source_file_copy_range (file, start - 2, 2, tail);
+      else
         {
-        case '\r':
-          if (i < file->priv->buffer->length - 2)
-            {
-              if (file->priv->buffer->data[i + 1] == '\n')
-                {
-                  crlf++;
-                  i++;
-                }
-              else
-                cr++;
-            }
-          else
-            cr++;
-          lines++;
-        case '\n':
-          lf++;
-          lines++;
-        }
-      if (lines >= LIMIT_LINES)
-        break;
+          tail[0] = '\0';
+          source_file_copy_range (file, start - 1, 1, tail + 1);
+        }
+
+      if (tail[1] == '\r')
+        cr++;
+      else if (tail[0] == '\r')
+        crlf++;
+      else
+        lf++;
     }
 
   eol = SOURCE_FILE_LINE_ENDING_LF;
@@ -390,248 +642,2809 @@ source_file_guess_line_endings (SourceFile *file)
 
 #undef LIMIT_LINES
 }
-#endif
 
 
-static gboolean
-source_file_store_buffer (SourceFile *file)
+/*
+ * Releases the contents. Whatever the buffer points into (an allocation
+ * or a file mapping) is owned by the bytes, which get_bytes() callers
+ * and the piece table may still hold on to.
+ */
+static void
+source_file_clear_buffer (SourceFile *file)
 {
-  gsize   length;
-  gchar  *buffer;
-  GFile  *gfile;
-  GError *error;
-
-  g_return_val_if_fail (SOURCE_IS_FILE (file), FALSE);
-  g_return_val_if_fail (file->priv->filename, FALSE);
-
-  gfile = g_file_new_for_path (file->priv->filename);
-
-  if (!gfile)
-    return FALSE;
-
-  error = NULL;
-  buffer = g_convert_with_fallback (file->priv->buffer->data,
-                                    file->priv->buffer->length,
-                                    "UTF-8",
-                                    file->priv->charset,
-                                    NULL,
-                                    NULL,
-                                    &length,
-                                    &error);
+  if (file->priv->pager)
+    {
+      source_file_pager_free (file->priv->pager);
+      file->priv->pager = NULL;
+    }
 
-  if (!buffer)
+  if (file->priv->pieces)
     {
-      g_warning ("Failed to convert buffer to '%s': %s", file->priv->charset, error->message);
-      g_error_free (error);
-      g_object_unref (gfile);
-      return FALSE;
+      source_file_piece_table_free (file->priv->pieces);
+      file->priv->pieces = NULL;
+      file->priv->buffer_stale = FALSE;
     }
 
-  error = NULL;
-  if (!g_file_replace_contents (gfile,
-                                buffer, length,
-                                NULL, FALSE,
-                                G_FILE_CREATE_NONE,
-                                NULL, NULL,
-                                &error))
+  if (file->priv->bytes)
     {
-      g_warning ("Failed to store file '%s': %s", file->priv->filename, error->message);
-      g_error_free (error);
-      g_free (buffer);
-      g_object_unref (gfile);
-      return FALSE;
+      g_bytes_unref (file->priv->bytes);
+      file->priv->bytes = NULL;
     }
 
-  g_object_unref (gfile);
-  g_free (buffer);
+  file->priv->buffer->data = NULL;
+  file->priv->buffer->length = 0;
 
-  return TRUE;
+  if (file->priv->line_starts)
+    {
+      g_array_unref (file->priv->line_starts);
+      file->priv->line_starts = NULL;
+    }
 }
 
 
+/* writes data to output, hashing it and keeping the last bytes on the way */
 static gboolean
-source_file_load_buffer (SourceFile *file)
+source_file_write_tracked (GOutputStream      *output,
+                           const gchar        *data,
+                           gsize               length,
+                           SourceFileWritten  *written,
+                           SourceFileStats    *stats,
+                           GCancellable       *cancellable,
+                           GError            **error)
 {
-  gsize   length;
-  gchar  *buffer;
-  GFile  *gfile;
-  GError *error;
-
-  g_return_val_if_fail (SOURCE_IS_FILE (file), FALSE);
-  g_return_val_if_fail (file->priv->filename, FALSE);
-  g_return_val_if_fail (g_file_test (file->priv->filename, G_FILE_TEST_EXISTS), FALSE);
+  gboolean success;
+  gint64   start;
+  gsize    keep;
 
-  g_free (file->priv->buffer->data);
-  file->priv->buffer->data = NULL;
-  file->priv->buffer->length = 0;
+  start = source_file_stats_phase_start ();
+  success = g_output_stream_write_all (output, data, length, NULL, cancellable, error);
+  source_file_stats_phase_end (stats, SOURCE_FILE_PHASE_WRITE, start, length);
 
-  gfile = g_file_new_for_path (file->priv->filename);
-  if (!gfile)
+  if (!success)
     return FALSE;
 
-  error = NULL;
-  if (!g_file_load_contents (gfile, NULL, &buffer, &length, NULL, &error))
-    {
-      g_warning ("Failed to load file '%s': %s", file->priv->filename, error->message);
-      g_error_free (error);
-      g_object_unref (gfile);
-      return FALSE;
-    }
-
-  g_object_unref (gfile);
-
-  if (!file->priv->charset)
-    {
-      g_free (file->priv->charset);
-      file->priv->charset = source_file_guess_charset (file, buffer, length);
-    }
+  source_file_hash_update (&written->content, data, length);
 
-  if (!file->priv->mime_type)
+  if (length >= SOURCE_FILE_FOLLOW_WINDOW)
     {
-      g_free (file->priv->mime_type);
-      file->priv->mime_type = source_file_guess_mime_type (file, buffer, length);
-    }
-
-  error = NULL;
-  file->priv->buffer->data =
-    g_convert_with_fallback (buffer,
-                             length,
-                             file->priv->charset,
-                             "UTF-8",
-                             NULL,
-                             NULL,
-                             &(file->priv->buffer->length),
-                             &error);
-
-  if (error)
-    {
-      g_warning ("Failed to convert buffer from '%s': %s", file->priv->charset, error->message);
-      g_error_free (error);
-      g_free (buffer);
-      return FALSE;
+      memcpy (written->window, data + length - SOURCE_FILE_FOLLOW_WINDOW, SOURCE_FILE_FOLLOW_WINDOW);
+      written->window_length = SOURCE_FILE_FOLLOW_WINDOW;
+      return TRUE;
     }
 
-  g_free (buffer);
+  keep = MIN (written->window_length, SOURCE_FILE_FOLLOW_WINDOW - length);
+  memmove (written->window, written->window + written->window_length - keep, keep);
+  memcpy (written->window + keep, data, length);
+  written->window_length = keep + length;
 
   return TRUE;
 }
 
 
-SourceFile *
-source_file_new (const gchar *filename, const gchar *charset, const gchar *mime_type)
+/*
+ * Runs one chunk of UTF-8 through the converter and writes the result
+ * to output. Characters the charset has no room for are written as
+ * "\uXXXX" escapes, the same as g_convert_with_fallback() does.
+ */
+static gboolean
+source_file_write_encoded (GOutputStream      *output,
+                           GConverter         *converter,
+                           const gchar        *data,
+                           gsize               length,
+                           gboolean            at_end,
+                           gchar              *outbuf,
+                           gsize               outbuf_size,
+                           SourceFileWritten  *written,
+                           SourceFileStats    *stats,
+                           GCancellable       *cancellable,
+                           GError            **error)
 {
-  SourceFile *file;
+  GConverterResult result;
+  GError          *local_error;
+  gsize            n_read, n_written;
+  gunichar         ch;
+  gchar           *escape;
+  gboolean         success;
+  gint64           start;
+
+  for (;;)
+    {
+      if (!length && !at_end)
+        return TRUE;
+
+      local_error = NULL;
+      start = source_file_stats_phase_start ();
+      result = g_converter_convert (converter,
+                                    data, length,
+                                    outbuf, outbuf_size,
+                                    at_end ? G_CONVERTER_INPUT_AT_END : G_CONVERTER_NO_FLAGS,
+                                    &n_read, &n_written,
+                                    &local_error);
+      source_file_stats_phase_end (stats, SOURCE_FILE_PHASE_CONVERT, start,
+                                   result == G_CONVERTER_ERROR ? 0 : n_read);
+
+      if (result == G_CONVERTER_ERROR)
+        {
+          if (!g_error_matches (local_error, G_IO_ERROR, G_IO_ERROR_INVALID_DATA) ||
+              (ch = g_utf8_get_char_validated (data, length)) >= 0xfffffffe)
+            {
+              g_propagate_error (error, local_error);
+              return FALSE;
+            }
+          g_error_free (local_error);
 
-  file = SOURCE_FILE (g_object_new (SOURCE_TYPE_FILE, NULL));
+          escape = g_strdup_printf (ch < 0x10000 ? "\\u%04x" : "\\U%08x", ch);
+          success = source_file_write_encoded (output, converter,
+                                               escape, strlen (escape), FALSE,
+                                               outbuf, outbuf_size, written, stats,
+                                               cancellable, error);
+          g_free (escape);
 
-  if (filename)
-    source_file_set_filename (file, filename);
+          if (!success)
+            return FALSE;
 
-  if (charset)
-    source_file_set_charset (file, charset);
+          n_read = g_utf8_next_char (data) - data;
+          n_written = 0;
+        }
 
-  if (mime_type)
-    source_file_set_mime_type (file, mime_type);
+      if (n_written &&
+          !source_file_write_tracked (output, outbuf, n_written, written, stats,
+                                      cancellable, error))
+        return FALSE;
 
-  if (filename)
-    source_file_load_buffer (file);
+      if (result == G_CONVERTER_FINISHED)
+        return TRUE;
 
-  return file;
+      data += n_read;
+      length -= n_read;
+    }
 }
 
 
-const SourceFileBuffer *
-source_file_get_buffer (SourceFile *file)
+/*
+ * Flushes path, a file or a directory, to disk. Directories that can't
+ * be synced on this filesystem (EINVAL) are taken as done.
+ */
+static gboolean
+source_file_sync_path (const gchar *path, gboolean directory, GError **error)
 {
-  g_return_val_if_fail (SOURCE_IS_FILE (file), NULL);
-  return (const SourceFileBuffer *) file->priv->buffer;
-}
+  gint fd, flags = O_RDONLY;
+  gint saved_errno = 0;
 
+#ifdef O_DIRECTORY
+  if (directory)
+    flags |= O_DIRECTORY;
+#endif
 
-gboolean
-source_file_get_contents (SourceFile *file, gchar **buffer, gsize *length)
-{
-  g_return_val_if_fail (SOURCE_IS_FILE (file), FALSE);
-  g_return_val_if_fail (buffer, FALSE);
-
-  if (buffer && file->priv->buffer->data)
+  fd = g_open (path, flags, 0);
+  if (fd < 0)
+    saved_errno = errno;
+  else
     {
-      *buffer = g_malloc0 (file->priv->buffer->length);
-      memcpy (*buffer, file->priv->buffer->data, file->priv->buffer->length);
+      while (fsync (fd) != 0)
+        {
+          if (errno != EINTR)
+            {
+              saved_errno = errno;
+              break;
+            }
+        }
+      close (fd);
     }
-  else if (buffer)
-    *buffer = NULL;
 
-  if (length)
-    *length = file->priv->buffer->length;
+  if (saved_errno == 0 || (directory && saved_errno == EINVAL))
+    return TRUE;
 
-  return TRUE;
+  g_set_error (error, G_IO_ERROR, g_io_error_from_errno (saved_errno),
+               "Failed to sync '%s' to disk: %s", path, g_strerror (saved_errno));
+
+  return FALSE;
 }
 
 
-gboolean
-source_file_set_contents (SourceFile *file, const gchar *buffer, gsize length)
+/*
+ * Writes data out to filename over a g_file_replace() stream, a chunk at
+ * a time and converting from UTF-8 to charset as it goes, so no more
+ * than a chunk of encoded output is ever held in memory. The file is
+ * only replaced once everything has been written; failing or cancelling
+ * leaves it untouched. With sync, the new file and then the directory
+ * holding it are flushed to disk before returning, so both the contents
+ * and the rename survive a crash; if either fails the save does too,
+ * though the file has been replaced by then. How long it took goes into
+ * stats, and what the file now looks like into disk, from what was
+ * written and a stat; disk is left zeroed if the file wasn't replaced.
+ */
+static gboolean
+source_file_store_contents (const gchar            *filename,
+                            const gchar            *charset,
+                            const gchar            *data,
+                            gsize                   length,
+                            gboolean                make_backup,
+                            gboolean                sync,
+                            SourceFileStats        *stats,
+                            SourceFileDiskState    *disk,
+                            GCancellable           *cancellable,
+                            GFileProgressCallback   progress,
+                            gpointer                progress_data,
+                            GError                **error)
 {
-  g_return_val_if_fail (SOURCE_IS_FILE (file), FALSE);
-
-  g_free (file->priv->buffer);
-  file->priv->buffer->data = NULL;
-  file->priv->buffer->length = 0;
+  GFile             *gfile;
+  GFileOutputStream *stream = NULL;
+  GConverter        *converter = NULL;
+  GCancellable      *abort;
+  SourceFileWritten *tracked;
+  gchar             *outbuf = NULL, *dirname;
+  gsize              written, n;
+  gboolean           closed = FALSE, success = FALSE;
+  gint64             start;
+  gint               fd;
+
+  source_file_stats_start (stats);
+  memset (disk, 0, sizeof (SourceFileDiskState));
+
+  tracked = g_slice_new (SourceFileWritten);
+  source_file_hash_init (&tracked->content);
+  tracked->window_length = 0;
+
+  /* contents that never had a charset are saved as UTF-8 */
+  if (!charset)
+    charset = "UTF-8";
 
-  if (buffer)
+  /* UTF-8, and ASCII that is still ASCII, is written out as it is */
+  if (!source_file_charset_is_utf8 (charset) ||
+      (source_file_lookup_charset (charset) != source_file_lookup_charset ("UTF-8") &&
+       !source_file_is_ascii (data, length)))
     {
-      file->priv->buffer->data = g_malloc0 (length);
-      file->priv->buffer->length = length;
-      memcpy (file->priv->buffer->data, buffer, length);
+      converter = source_file_converter_new (charset, "UTF-8", error);
+      if (!converter)
+        goto out;
+      outbuf = g_malloc (SOURCE_FILE_LOAD_CHUNK_SIZE);
     }
 
-  return TRUE;
-}
+  gfile = g_file_new_for_path (filename);
+  start = source_file_stats_phase_start ();
+  stream = g_file_replace (gfile, NULL, make_backup, G_FILE_CREATE_NONE, cancellable, error);
+  source_file_stats_phase_end (stats, SOURCE_FILE_PHASE_WRITE, start, 0);
+  g_object_unref (gfile);
 
+  if (!stream)
+    goto out;
 
-gboolean
-source_file_reload (SourceFile *file)
-{
-  return source_file_load_buffer (file);
-}
+  written = 0;
+  do
+    {
+      n = MIN (SOURCE_FILE_LOAD_CHUNK_SIZE, length - written);
 
+      if (converter)
+        {
+          /* never split a character between two chunks */
+          if (written + n < length)
+            n -= source_file_utf8_incomplete_tail (data + written, n);
+
+          if (!source_file_write_encoded (G_OUTPUT_STREAM (stream),
+                                          converter,
+                                          data + written, n,
+                                          written + n == length,
+                                          outbuf, SOURCE_FILE_LOAD_CHUNK_SIZE,
+                                          tracked, stats, cancellable, error))
+            goto out;
+        }
+      else if (!source_file_write_tracked (G_OUTPUT_STREAM (stream), data + written, n,
+                                           tracked, stats, cancellable, error))
+        goto out;
 
-gboolean
-source_file_open (SourceFile  *file,
-                  const gchar *filename,
-                  const gchar *charset,
-                  const gchar *mime_type)
-{
-  g_return_val_if_fail (SOURCE_IS_FILE (file), FALSE);
-  g_return_val_if_fail (filename, FALSE);
+      written += n;
+
+      if (progress)
+        progress (written, length, progress_data);
+    }
+  while (written < length);
+
+  /* closing is what moves the new file into place */
+  start = source_file_stats_phase_start ();
+  closed = g_output_stream_close (G_OUTPUT_STREAM (stream), cancellable, error);
+  success = closed;
+
+  if (success && sync)
+    {
+      dirname = g_path_get_dirname (filename);
+      success = source_file_sync_path (filename, FALSE, error) &&
+                source_file_sync_path (dirname, TRUE, error);
+      g_free (dirname);
+    }
+  source_file_stats_phase_end (stats, SOURCE_FILE_PHASE_WRITE, start, 0);
+
+  if (closed)
+    {
+      /* the size tells if anyone else wrote to it since */
+      disk->exists = source_file_detect_key_init (&disk->key, filename, NULL, 0);
+      disk->known = disk->exists && disk->key.size == tracked->content.length;
+      disk->content = tracked->content;
+      disk->window_hash = source_file_hash_bytes (tracked->window, tracked->window_length);
+
+      /* a few blocks read back, what was written went through the converter */
+      fd = g_open (filename, O_RDONLY, 0);
+      if (fd < 0 || !source_file_hash_samples (NULL, fd, disk->key.size, &disk->sample_hash))
+        disk->known = FALSE;
+      if (fd >= 0)
+        close (fd);
+    }
+
+out:
+  if (stream && !closed)
+    {
+      /* closing with a cancelled cancellable throws the temporary file
+       * away instead of moving it over the original */
+      abort = g_cancellable_new ();
+      g_cancellable_cancel (abort);
+      g_output_stream_close (G_OUTPUT_STREAM (stream), abort, NULL);
+      g_object_unref (abort);
+    }
+
+  if (stream)
+    g_object_unref (stream);
+  if (converter)
+    g_object_unref (converter);
+  g_free (outbuf);
+  g_slice_free (SourceFileWritten, tracked);
+
+  source_file_stats_finish (stats, SOURCE_FILE_STATS_SAVE, filename,
+                            stats->phase_bytes[SOURCE_FILE_PHASE_WRITE], success);
+
+  return success;
+}
+
+
+static gboolean
+source_file_store_buffer (SourceFile *file)
+{
+  SourceFileDiskState disk;
+  GError *error;
+
+  g_return_val_if_fail (SOURCE_IS_FILE (file), FALSE);
+  g_return_val_if_fail (!file->priv->pager, FALSE);
+  g_return_val_if_fail (file->priv->filename, FALSE);
+
+  source_file_flatten_buffer (file);
+
+  error = NULL;
+  if (!source_file_store_contents (file->priv->filename,
+                                   file->priv->charset,
+                                   file->priv->buffer->data,
+                                   file->priv->buffer->length,
+                                   file->priv->make_backup,
+                                   file->priv->sync,
+                                   &file->priv->save_stats,
+                                   &disk,
+                                   NULL, NULL, NULL,
+                                   &error))
+    {
+      g_warning ("Failed to store file '%s': %s", file->priv->filename, error->message);
+      g_error_free (error);
+
+      /* replaced but not synced, it is still what's on disk now */
+      if (disk.exists)
+        source_file_set_disk_state (file, &disk);
+
+      return FALSE;
+    }
+
+  source_file_set_disk_state (file, &disk);
+
+  return TRUE;
+}
+
+
+/* make room for at least needed more bytes after length */
+static void
+source_file_reserve (gchar **data, gsize *alloc, gsize length, gsize needed)
+{
+  if (*alloc - length >= needed)
+    return;
+
+  *alloc = MAX (*alloc * 2, length + needed);
+  *data = g_realloc (*data, *alloc);
+}
+
+
+/*
+ * Runs one chunk of input through the converter, appending to data. Any
+ * trailing incomplete character is left unconsumed for the next chunk;
+ * the number of such bytes is returned in remaining.
+ */
+static gboolean
+source_file_convert_chunk (GConverter       *converter,
+                           const gchar      *input,
+                           gsize             input_length,
+                           GConverterFlags   flags,
+                           gchar           **data,
+                           gsize            *length,
+                           gsize            *alloc,
+                           gsize            *remaining,
+                           GError          **error)
+{
+  GConverterResult result;
+  gsize            bytes_read, bytes_written;
+  GError          *tmp_error;
+
+  while (input_length > 0 || (flags & G_CONVERTER_INPUT_AT_END))
+    {
+      source_file_reserve (data, alloc, *length, MAX (input_length, 16));
+
+      tmp_error = NULL;
+      result = g_converter_convert (converter,
+                                    input, input_length,
+                                    *data + *length, *alloc - *length,
+                                    flags,
+                                    &bytes_read, &bytes_written,
+                                    &tmp_error);
+
+      if (result == G_CONVERTER_ERROR)
+        {
+          if (g_error_matches (tmp_error, G_IO_ERROR, G_IO_ERROR_NO_SPACE))
+            {
+              g_error_free (tmp_error);
+              source_file_reserve (data, alloc, *length, *alloc - *length + 1);
+              continue;
+            }
+          else if (g_error_matches (tmp_error, G_IO_ERROR, G_IO_ERROR_PARTIAL_INPUT) &&
+                   !(flags & G_CONVERTER_INPUT_AT_END))
+            {
+              g_error_free (tmp_error);
+              break;
+            }
+          g_propagate_error (error, tmp_error);
+          return FALSE;
+        }
+
+      input += bytes_read;
+      input_length -= bytes_read;
+      *length += bytes_written;
+
+      if (result == G_CONVERTER_FINISHED)
+        break;
+    }
+
+  *remaining = input_length;
+
+  return TRUE;
+}
+
+
+/*
+ * The UTF-8 counterpart of source_file_convert_chunk(): input that is
+ * already UTF-8 (or ASCII) only needs validating, not converting.
+ */
+static gboolean
+source_file_append_utf8_chunk (const gchar  *input,
+                               gsize         input_length,
+                               gboolean      at_end,
+                               gchar       **data,
+                               gsize        *length,
+                               gsize        *alloc,
+                               gsize        *remaining,
+                               GError      **error)
+{
+  gsize tail;
+
+  tail = at_end ? 0 : source_file_utf8_incomplete_tail (input, input_length);
+
+  if (!source_file_utf8_validate (input, input_length - tail))
+    {
+      g_set_error_literal (error, G_CONVERT_ERROR, G_CONVERT_ERROR_ILLEGAL_SEQUENCE,
+                           "Invalid byte sequence in conversion input");
+      return FALSE;
+    }
+
+  source_file_reserve (data, alloc, *length, input_length - tail);
+  memcpy (*data + *length, input, input_length - tail);
+  *length += input_length - tail;
+  *remaining = tail;
+
+  return TRUE;
+}
+
+
+static inline void
+source_file_hash_word (SourceFileHash *h, guint64 word)
+{
+  h->hash = (h->hash ^ word) * G_GUINT64_CONSTANT (0x9e3779b97f4a7c15);
+  h->hash ^= h->hash >> 32;
+}
+
+
+static void
+source_file_hash_init (SourceFileHash *h)
+{
+  memset (h, 0, sizeof (SourceFileHash));
+  h->hash = G_GUINT64_CONSTANT (14695981039346656037);
+}
+
+
+/*
+ * Hashes 8 bytes at a time, it only has to notice that a file changed
+ * and must be a lot cheaper than loading it. The result doesn't depend
+ * on how the data is split up between calls.
+ */
+static void
+source_file_hash_update (SourceFileHash *h, const gchar *data, gsize length)
+{
+  guint64 word;
+
+  h->length += length;
+
+  for (; h->n_tail && length; data++, length--)
+    {
+      h->tail |= (guint64) (guchar) *data << (8 * h->n_tail);
+      if (++h->n_tail == 8)
+        {
+          source_file_hash_word (h, h->tail);
+          h->tail = 0;
+          h->n_tail = 0;
+        }
+    }
+
+  for (; length >= 8; data += 8, length -= 8)
+    {
+      memcpy (&word, data, 8);
+      source_file_hash_word (h, GUINT64_FROM_LE (word));
+    }
+
+  for (; length; data++, length--)
+    h->tail |= (guint64) (guchar) *data << (8 * h->n_tail++);
+}
+
+
+/* the hash of everything so far, h can still be updated afterwards */
+static guint64
+source_file_hash_value (const SourceFileHash *h)
+{
+  SourceFileHash end = *h;
+
+  if (end.n_tail)
+    source_file_hash_word (&end, end.tail);
+  source_file_hash_word (&end, end.length);
+
+  return end.hash;
+}
+
+
+static guint64
+source_file_hash_bytes (const gchar *data, gsize length)
+{
+  SourceFileHash h;
+
+  source_file_hash_init (&h);
+  source_file_hash_update (&h, data, length);
+
+  return source_file_hash_value (&h);
+}
+
+
+/* hashes the SOURCE_FILE_FOLLOW_WINDOW bytes of fd before end */
+static gboolean
+source_file_hash_window (gint fd, guint64 end, guint64 *hash)
+{
+  gchar  window[SOURCE_FILE_FOLLOW_WINDOW];
+  gsize  length, done = 0;
+  gssize n;
+
+  length = MIN (end, SOURCE_FILE_FOLLOW_WINDOW);
+
+  while (done < length)
+    {
+      n = pread (fd, window + done, length - done, end - length + done);
+      if (n < 0 && errno == EINTR)
+        continue;
+      if (n <= 0)
+        return FALSE;
+      done += n;
+    }
+
+  *hash = source_file_hash_bytes (window, length);
+
+  return TRUE;
+}
+
+
+/*
+ * Hashes SOURCE_FILE_FOLLOW_SAMPLES blocks of SOURCE_FILE_FOLLOW_WINDOW
+ * bytes spread evenly over the first end bytes, the first one at the
+ * very start, from data if given or else read from fd. Tells a rewrite
+ * from an append at a fixed cost, where hashing everything again would
+ * cost as much as the file is large.
+ */
+static gboolean
+source_file_hash_samples (const gchar *data, gint fd, guint64 end, guint64 *hash)
+{
+  SourceFileHash h;
+  gchar          block[SOURCE_FILE_FOLLOW_WINDOW];
+  guint64        offset;
+  gsize          length, done;
+  gssize         n;
+  guint          i;
+
+  source_file_hash_init (&h);
+  length = MIN (end, SOURCE_FILE_FOLLOW_WINDOW);
+
+  for (i = 0; i < SOURCE_FILE_FOLLOW_SAMPLES; i++)
+    {
+      offset = (end - length) / SOURCE_FILE_FOLLOW_SAMPLES * i;
+
+      if (data)
+        {
+          source_file_hash_update (&h, data + offset, length);
+          continue;
+        }
+
+      for (done = 0; done < length; done += n)
+        {
+          n = pread (fd, block + done, length - done, offset + done);
+          if (n < 0 && errno == EINTR)
+            n = 0;
+          else if (n <= 0)
+            return FALSE;
+        }
+      source_file_hash_update (&h, block, length);
+    }
+
+  *hash = source_file_hash_value (&h);
+
+  return TRUE;
+}
+
+
+/* stats and hashes filename as it is now */
+static void
+source_file_read_disk_state (const gchar *filename, SourceFileDiskState *disk)
+{
+  gchar  *chunk;
+  gssize  n;
+  gint    fd;
+
+  memset (disk, 0, sizeof (SourceFileDiskState));
+  disk->known = TRUE;
+  disk->exists = source_file_detect_key_init (&disk->key, filename, NULL, 0);
+  if (!disk->exists)
+    return;
+
+  fd = g_open (filename, O_RDONLY, 0);
+  if (fd < 0)
+    {
+      disk->known = FALSE;
+      return;
+    }
+
+  source_file_hash_init (&disk->content);
+  chunk = g_malloc (SOURCE_FILE_LOAD_CHUNK_SIZE);
+
+  while ((n = read (fd, chunk, SOURCE_FILE_LOAD_CHUNK_SIZE)) != 0)
+    {
+      if (n < 0)
+        {
+          if (errno == EINTR)
+            continue;
+          disk->known = FALSE;
+          break;
+        }
+      source_file_hash_update (&disk->content, chunk, n);
+    }
+
+  disk->key.size = disk->content.length;
+  if (!source_file_hash_window (fd, disk->key.size, &disk->window_hash) ||
+      !source_file_hash_samples (NULL, fd, disk->key.size, &disk->sample_hash))
+    disk->known = FALSE;
+
+  g_free (chunk);
+  close (fd);
+}
+
+
+/*
+ * Fills in whichever of the charset and MIME type aren't set yet from
+ * the detection cache. Returns TRUE if neither was set and the cache
+ * didn't know the file either, in which case key is ready for
+ * source_file_remember_detected() once they've been guessed.
+ */
+static gboolean
+source_file_lookup_detected (SourceFile          *file,
+                             const gchar         *head,
+                             gsize                head_length,
+                             SourceFileDetectKey *key)
+{
+  const gchar *charset = NULL, *mime_type = NULL;
+
+  if ((file->priv->charset && file->priv->mime_type) ||
+      !head_length ||
+      !source_file_detect_cache_is_enabled () ||
+      !source_file_detect_key_init (key, file->priv->filename, head, head_length))
+    return FALSE;
+
+  if (!source_file_detect_cache_lookup (key, &charset, &mime_type))
+    return !file->priv->charset && !file->priv->mime_type;
+
+  if (!file->priv->charset)
+    file->priv->charset = charset;
+
+  if (!file->priv->mime_type)
+    file->priv->mime_type = mime_type;
+
+  return FALSE;
+}
+
+
+static void
+source_file_remember_detected (SourceFile *file, const SourceFileDetectKey *key)
+{
+  if (file->priv->charset && file->priv->mime_type)
+    source_file_detect_cache_insert (key, file->priv->charset, file->priv->mime_type);
+}
+
+
+/*
+ * Guesses whatever of the charset and MIME type isn't set yet from the
+ * first chunk of the file. When the file is larger than that chunk its
+ * last few KiB are read as well, so that modelines at the end of the
+ * file are still found, and the stream is put back where it was.
+ */
+static gboolean
+source_file_sniff_stream (SourceFile    *file,
+                          GInputStream  *stream,
+                          const gchar   *head,
+                          gsize          head_length,
+                          goffset        size,
+                          GCancellable  *cancellable,
+                          GError       **error)
+{
+  SourceFileSniffPolicy policy;
+  SourceFileDetectKey   key;
+  gchar       *sniff = NULL;
+  const gchar *buffer = head;
+  gsize        length = head_length;
+  gboolean     remember;
+  gint64       start;
+
+  remember = source_file_lookup_detected (file, head, head_length, &key);
+
+  if (!file->priv->charset && head_length > 0 &&
+      size > (goffset) head_length &&
+      G_IS_SEEKABLE (stream) &&
+      g_seekable_can_seek (G_SEEKABLE (stream)))
+    {
+      gsize tail_length, n_read;
+
+      source_file_get_sniff_policy (file, &policy);
+      tail_length = policy.chunk_size ? policy.chunk_size : SOURCE_FILE_SNIFF_CHUNK_SIZE;
+      tail_length = MIN (tail_length, (gsize) (size - head_length));
+
+      sniff = g_malloc (head_length + 1 + tail_length);
+      memcpy (sniff, head, head_length);
+      sniff[head_length] = '\n';
+
+      start = source_file_stats_phase_start ();
+      if (g_seekable_seek (G_SEEKABLE (stream), size - tail_length, G_SEEK_SET, cancellable, NULL) &&
+          g_input_stream_read_all (stream, sniff + head_length + 1, tail_length,
+                                   &n_read, cancellable, NULL))
+        {
+          buffer = sniff;
+          length = head_length + 1 + n_read;
+        }
+      source_file_stats_phase_end (&file->priv->load_stats, SOURCE_FILE_PHASE_READ, start,
+                                   buffer == sniff ? length - head_length - 1 : 0);
+
+      if (!g_seekable_seek (G_SEEKABLE (stream), head_length, G_SEEK_SET, cancellable, error))
+        {
+          g_free (sniff);
+          return FALSE;
+        }
+    }
+
+  if (!file->priv->charset)
+    {
+      if (length > 0)
+        file->priv->charset = source_file_guess_charset (file, buffer, length);
+      else
+        file->priv->charset = source_file_intern_charset_name ("UTF-8");
+    }
+
+  if (!file->priv->mime_type && head_length > 0)
+    file->priv->mime_type = source_file_guess_mime_type (file, head, head_length);
+
+  if (remember)
+    source_file_remember_detected (file, &key);
+
+  g_free (sniff);
+
+  return TRUE;
+}
+
+
+static gboolean
+source_file_charset_is_utf8 (const gchar *charset)
+{
+  const SourceFileCharset *utf8, *ascii, *cs;
+
+  utf8 = source_file_lookup_charset ("UTF-8");
+  ascii = source_file_lookup_charset ("US-ASCII");
+
+  /* a file's own charset is the table's copy of the name */
+  if (charset == utf8->name || charset == ascii->name)
+    return TRUE;
+
+  cs = source_file_lookup_charset (charset);
+
+  return cs && (cs == utf8 || cs == ascii);
+}
+
+
+/* a built-in converter for single-byte charsets, UTF-16 and UTF-32, a
+ * cached iconv descriptor for the rest */
+static GConverter *
+source_file_converter_new (const gchar *to_charset, const gchar *from_charset, GError **error)
+{
+  GConverter *converter;
+
+  converter = source_file_codec_converter_new (to_charset, from_charset);
+  if (!converter)
+    converter = source_file_iconv_converter_new (source_file_charset_iconv_name (to_charset),
+                                                 source_file_charset_iconv_name (from_charset),
+                                                 error);
+
+  return converter;
+}
+
+
+/* whether the file is at least page_threshold bytes, so should be paged */
+static gboolean
+source_file_is_large (SourceFile *file)
+{
+  GStatBuf st;
+
+  return file->priv->page_threshold &&
+         g_stat (file->priv->filename, &st) == 0 &&
+         (guint64) st.st_size >= file->priv->page_threshold;
+}
+
+
+/*
+ * A file taken for ASCII from its first policy->max_bytes may still have
+ * valid UTF-8 further on, which loads fine but is then labelled UTF-8.
+ */
+static void
+source_file_relabel_ascii (SourceFile                  *file,
+                           const gchar                 *data,
+                           gsize                        length,
+                           const SourceFileSniffPolicy *policy)
+{
+  gsize checked;
+
+  if (file->priv->charset != source_file_intern_charset_name ("US-ASCII") ||
+      !policy->max_bytes || length <= policy->max_bytes)
+    return;
+
+  checked = policy->max_bytes;
+  if (!source_file_is_ascii (data + checked, length - checked))
+    file->priv->charset = source_file_intern_charset_name ("UTF-8");
+}
+
+
+/*
+ * Maps the file and, when it turns out to be valid UTF-8 already, uses
+ * the mapping itself as the buffer instead of copying and converting
+ * it. Otherwise the charset and MIME type guessed from the mapping are
+ * kept and FALSE is returned so the file is loaded the normal way.
+ */
+static gboolean
+source_file_map_contents (SourceFile *file)
+{
+  SourceFileSniffPolicy policy;
+  SourceFileDetectKey key;
+  SourceFileDiskState disk;
+  GMappedFile *mapped;
+  gchar       *data;
+  gsize        length;
+  gboolean     remember, valid, detected;
+  gint64       start;
+
+  /* pages are only read as they're touched, mostly while validating */
+  start = source_file_stats_phase_start ();
+  mapped = g_mapped_file_new (file->priv->filename, FALSE, NULL);
+  if (!mapped)
+    return FALSE;
+
+  data = g_mapped_file_get_contents (mapped);
+  length = g_mapped_file_get_length (mapped);
+  source_file_stats_phase_end (&file->priv->load_stats, SOURCE_FILE_PHASE_READ, start, length);
+
+  if (!data || !length)
+    {
+      g_mapped_file_unref (mapped);
+      return FALSE;
+    }
+
+  detected = !file->priv->charset;
+  remember = source_file_lookup_detected (file, data, length, &key);
+
+  if (!file->priv->charset)
+    file->priv->charset = source_file_guess_charset (file, data, length);
+
+  if (!file->priv->mime_type)
+    file->priv->mime_type =
+      source_file_guess_mime_type (file, data, MIN (length, SOURCE_FILE_LOAD_CHUNK_SIZE));
+
+  if (remember)
+    source_file_remember_detected (file, &key);
+
+  valid = source_file_charset_is_utf8 (file->priv->charset);
+  if (valid)
+    {
+      start = source_file_stats_phase_start ();
+      valid = source_file_utf8_validate (data, length);
+      source_file_stats_phase_end (&file->priv->load_stats, SOURCE_FILE_PHASE_CONVERT, start, length);
+    }
+
+  if (!valid)
+    {
+      g_mapped_file_unref (mapped);
+      return FALSE;
+    }
+
+  if (detected)
+    {
+      source_file_get_sniff_policy (file, &policy);
+      source_file_relabel_ascii (file, data, length, &policy);
+    }
+
+  file->priv->bytes = g_mapped_file_get_bytes (mapped);
+  file->priv->buffer->data = data;
+  file->priv->buffer->length = length;
+  g_mapped_file_unref (mapped);
+
+  disk.known = TRUE;
+  disk.exists = source_file_detect_key_init (&disk.key, file->priv->filename, NULL, 0);
+  disk.key.size = length;
+  source_file_hash_init (&disk.content);
+  source_file_hash_update (&disk.content, data, length);
+  disk.window_hash = source_file_hash_bytes (data + length - MIN (length, SOURCE_FILE_FOLLOW_WINDOW),
+                                             MIN (length, SOURCE_FILE_FOLLOW_WINDOW));
+  source_file_hash_samples (data, -1, length, &disk.sample_hash);
+  source_file_set_disk_state (file, &disk);
+
+  return TRUE;
+}
+
+
+/* decodes all of input from charset onto the end of data */
+static gboolean
+source_file_decode_all (const gchar  *charset,
+                        const gchar  *input,
+                        gsize         input_length,
+                        gchar       **data,
+                        gsize        *length,
+                        gsize        *alloc,
+                        GError      **error)
+{
+  GConverter *converter;
+  gsize       remaining;
+  gboolean    converted;
+
+  if (source_file_charset_is_utf8 (charset))
+    return source_file_append_utf8_chunk (input, input_length, TRUE,
+                                          data, length, alloc, &remaining, error);
+
+  converter = source_file_converter_new ("UTF-8", charset, error);
+  if (!converter)
+    return FALSE;
+
+  converted = source_file_convert_chunk (converter, input, input_length,
+                                         G_CONVERTER_INPUT_AT_END,
+                                         data, length, alloc, &remaining, error);
+  g_object_unref (converter);
+
+  return converted;
+}
+
+
+/*
+ * The charset guessed from the sniffing window doesn't decode the rest
+ * of the file, say ASCII at the start and Latin-1 further on. Reads all
+ * of it again, guesses over the whole file this time, and falls back to
+ * SOURCE_FILE_FALLBACK_CHARSET, which takes any bytes, if that doesn't
+ * decode it either. data is replaced, and content rehashed from what
+ * was read.
+ */
+static gboolean
+source_file_load_redetect (SourceFile      *file,
+                           GInputStream    *input,
+                           GCancellable    *cancellable,
+                           gchar          **data,
+                           gsize           *length,
+                           gsize           *alloc,
+                           goffset         *total,
+                           SourceFileHash  *content,
+                           GError         **error)
+{
+  SourceFileSniffPolicy policy;
+  SourceFileDetectKey key;
+  const gchar *failed, *fallback, *charset;
+  gchar       *raw = NULL;
+  gsize        raw_length = 0, raw_alloc = 0, n_read;
+  gboolean     decoded;
+  gint64       start;
+
+  start = source_file_stats_phase_start ();
+  if (!g_seekable_seek (G_SEEKABLE (input), 0, G_SEEK_SET, cancellable, error))
+    return FALSE;
+
+  do
+    {
+      source_file_reserve (&raw, &raw_alloc, raw_length, SOURCE_FILE_LOAD_CHUNK_SIZE);
+      if (!g_input_stream_read_all (input, raw + raw_length, raw_alloc - raw_length,
+                                    &n_read, cancellable, error))
+        {
+          g_free (raw);
+          return FALSE;
+        }
+      raw_length += n_read;
+    }
+  while (raw_length == raw_alloc);
+  source_file_stats_phase_end (&file->priv->load_stats, SOURCE_FILE_PHASE_READ, start, raw_length);
+
+  *total = raw_length;
+  source_file_hash_init (content);
+  source_file_hash_update (content, raw, raw_length);
+
+  /* no byte budget this time, the whole file is the evidence */
+  failed = file->priv->charset;
+  fallback = source_file_intern_charset_name (SOURCE_FILE_FALLBACK_CHARSET);
+  charset = fallback;
+  if (raw_length > 0)
+    {
+      source_file_get_sniff_policy (file, &policy);
+      policy.max_bytes = 0;
+      charset = source_file_guess_charset_policy (file, raw, raw_length, &policy, NULL);
+      if (charset == failed)
+        charset = fallback;
+    }
+
+  g_free (*data);
+  *data = NULL;
+  *length = 0;
+  *alloc = 0;
+
+  start = source_file_stats_phase_start ();
+  decoded = source_file_decode_all (charset, raw, raw_length, data, length, alloc,
+                                    charset == fallback ? error : NULL);
+  if (!decoded && charset != fallback)
+    {
+      charset = fallback;
+      *length = 0;
+      decoded = source_file_decode_all (charset, raw, raw_length, data, length, alloc, error);
+    }
+  source_file_stats_phase_end (&file->priv->load_stats, SOURCE_FILE_PHASE_CONVERT, start,
+                               decoded ? raw_length : 0);
+
+  if (decoded)
+    {
+      g_debug ("'%s' isn't %s past its first bytes, loaded as %s",
+                 file->priv->filename, failed, charset);
+      file->priv->charset = charset;
+
+      /* the cache would hand out the wrong guess again */
+      if (source_file_detect_cache_is_enabled () &&
+          source_file_detect_key_init (&key, file->priv->filename, raw, raw_length))
+        source_file_remember_detected (file, &key);
+    }
+
+  g_free (raw);
+
+  return decoded;
+}
+
+
+/*
+ * Reads the file in SOURCE_FILE_LOAD_CHUNK_SIZE chunks and decodes each
+ * one straight onto the end of the UTF-8 buffer, so at most one chunk of
+ * raw input is held in memory alongside the output. The file buffer is
+ * kept up to date after every chunk, which progress can look at.
+ */
+static gboolean
+source_file_load_contents (SourceFile              *file,
+                           GCancellable            *cancellable,
+                           GFileProgressCallback    progress,
+                           gpointer                 progress_data,
+                           GError                 **error)
+{
+  SourceFileSniffPolicy policy;
+  SourceFileDiskState disk;
+  GFile             *gfile;
+  GFileInputStream  *stream;
+  GFileInfo         *info;
+  GConverter        *converter = NULL;
+  GInputStream      *input;
+  GError            *tmp_error = NULL;
+  gchar             *chunk, *data = NULL;
+  gsize              chunk_size, n_read, carry = 0, length = 0, alloc;
+  goffset            size = -1, total = 0;
+  gboolean           eof, utf8, detected, success = FALSE;
+  gint64             start;
+  gint               fd;
+
+  source_file_stats_start (&file->priv->load_stats);
+  source_file_clear_buffer (file);
+
+  /* a guessed charset can still be wrong past the sniffing window */
+  detected = !file->priv->charset;
+
+  if (file->priv->zero_copy && !source_file_is_large (file) &&
+      source_file_map_contents (file))
+    {
+      source_file_stats_finish (&file->priv->load_stats, SOURCE_FILE_STATS_LOAD,
+                                file->priv->filename, file->priv->buffer->length, TRUE);
+      return TRUE;
+    }
+
+  gfile = g_file_new_for_path (file->priv->filename);
+  stream = g_file_read (gfile, cancellable, error);
+  g_object_unref (gfile);
+
+  if (!stream)
+    {
+      source_file_stats_finish (&file->priv->load_stats, SOURCE_FILE_STATS_LOAD,
+                                file->priv->filename, 0, FALSE);
+      return FALSE;
+    }
+
+  input = G_INPUT_STREAM (stream);
+
+  /* remembered so later change notifications can tell if it really changed */
+  disk.known = TRUE;
+  disk.exists = source_file_detect_key_init (&disk.key, file->priv->filename, NULL, 0);
+  source_file_hash_init (&disk.content);
+
+  info = g_file_input_stream_query_info (stream, G_FILE_ATTRIBUTE_STANDARD_SIZE, cancellable, NULL);
+  if (info)
+    {
+      size = g_file_info_get_size (info);
+      g_object_unref (info);
+    }
+
+  /* the first chunk doubles as the sniffing window */
+  source_file_get_sniff_policy (file, &policy);
+  chunk_size = MAX (SOURCE_FILE_LOAD_CHUNK_SIZE, policy.max_bytes);
+  chunk = g_malloc (chunk_size);
+
+  start = source_file_stats_phase_start ();
+  if (!g_input_stream_read_all (input, chunk, chunk_size, &n_read, cancellable, error))
+    goto out;
+  source_file_stats_phase_end (&file->priv->load_stats, SOURCE_FILE_PHASE_READ, start, n_read);
+
+  eof = n_read < chunk_size;
+  total = n_read;
+  source_file_hash_update (&disk.content, chunk, n_read);
+
+  if (!source_file_sniff_stream (file, input, chunk, n_read, eof ? -1 : size, cancellable, error))
+    goto out;
+
+  /*
+   * Too large to hold, the pager decodes it a page at a time as needed.
+   * Charsets it can't start decoding in the middle of are loaded whole.
+   */
+  if (file->priv->page_threshold && size >= 0 && (guint64) size >= file->priv->page_threshold)
+    {
+      file->priv->pager =
+        source_file_pager_new (file->priv->filename,
+                               source_file_charset_is_utf8 (file->priv->charset) ?
+                                 NULL : file->priv->charset,
+                               file->priv->page_budget,
+                               &tmp_error);
+      if (file->priv->pager ||
+          !g_error_matches (tmp_error, G_IO_ERROR, G_IO_ERROR_NOT_SUPPORTED))
+        {
+          success = file->priv->pager != NULL;
+          if (tmp_error)
+            g_propagate_error (error, tmp_error);
+          goto out;
+        }
+      g_clear_error (&tmp_error);
+    }
+
+  /* UTF-8 and ASCII are only validated, everything else is converted */
+  utf8 = source_file_charset_is_utf8 (file->priv->charset);
+  if (!utf8)
+    {
+      converter = source_file_converter_new ("UTF-8", file->priv->charset, error);
+      if (!converter)
+        goto out;
+    }
+
+  alloc = (size > 0 ? (gsize) size : chunk_size) + 1;
+  data = g_malloc (alloc);
+
+  for (;;)
+    {
+      gsize    input_length = carry + n_read;
+      gboolean converted;
+
+      start = source_file_stats_phase_start ();
+      if (utf8)
+        converted = source_file_append_utf8_chunk (chunk, input_length, eof,
+                                                   &data, &length, &alloc,
+                                                   &carry, &tmp_error);
+      else
+        converted = source_file_convert_chunk (converter,
+                                               chunk, input_length,
+                                               eof ? G_CONVERTER_INPUT_AT_END : G_CONVERTER_NO_FLAGS,
+                                               &data, &length, &alloc,
+                                               &carry, &tmp_error);
+      source_file_stats_phase_end (&file->priv->load_stats, SOURCE_FILE_PHASE_CONVERT, start,
+                                   converted ? input_length - carry : 0);
+
+      if (!converted && !detected)
+        {
+          g_propagate_error (error, tmp_error);
+          goto out;
+        }
+      else if (!converted)
+        {
+          g_clear_error (&tmp_error);
+          if (!source_file_load_redetect (file, input, cancellable,
+                                          &data, &length, &alloc,
+                                          &total, &disk.content, error))
+            goto out;
+
+          file->priv->buffer->data = data;
+          file->priv->buffer->length = length;
+
+          if (progress)
+            progress (total, size, progress_data);
+
+          break;
+        }
+
+      file->priv->buffer->data = data;
+      file->priv->buffer->length = length;
+
+      if (progress)
+        progress (total, size, progress_data);
+
+      if (eof)
+        break;
+
+      if (g_cancellable_set_error_if_cancelled (cancellable, error))
+        goto out;
+
+      /* keep the partial character at the end for the next round */
+      memmove (chunk, chunk + input_length - carry, carry);
+
+      start = source_file_stats_phase_start ();
+      if (!g_input_stream_read_all (input, chunk + carry, chunk_size - carry,
+                                    &n_read, cancellable, error))
+        goto out;
+      source_file_stats_phase_end (&file->priv->load_stats, SOURCE_FILE_PHASE_READ, start, n_read);
+
+      eof = n_read < chunk_size - carry;
+      total += n_read;
+      source_file_hash_update (&disk.content, chunk + carry, n_read);
+    }
+
+  if (utf8 && detected)
+    source_file_relabel_ascii (file, data, length, &policy);
+
+  source_file_reserve (&data, &alloc, length, 1);
+  data[length] = '\0';
+  success = TRUE;
+
+out:
+  if (success && file->priv->pager)
+    {
+      /* nothing is held that changes could be compared with */
+      disk.known = FALSE;
+      source_file_set_disk_state (file, &disk);
+    }
+  else if (success)
+    {
+      /* the terminating nul stays out of the bytes, but is still there */
+      file->priv->bytes = g_bytes_new_take (data, length);
+      file->priv->buffer->data = data;
+      file->priv->buffer->length = length;
+
+      /* what was read, in case it grew since the stat */
+      disk.key.size = total;
+      fd = g_open (file->priv->filename, O_RDONLY, 0);
+      disk.known = fd >= 0 &&
+                   source_file_hash_window (fd, total, &disk.window_hash) &&
+                   source_file_hash_samples (NULL, fd, total, &disk.sample_hash);
+      if (fd >= 0)
+        close (fd);
+      source_file_set_disk_state (file, &disk);
+    }
+  else
+    {
+      g_free (data);
+      file->priv->buffer->data = NULL;
+      file->priv->buffer->length = 0;
+    }
+
+  if (converter)
+    g_object_unref (converter);
+
+  g_input_stream_close (input, NULL, NULL);
+  g_object_unref (stream);
+  g_free (chunk);
+
+  source_file_stats_finish (&file->priv->load_stats, SOURCE_FILE_STATS_LOAD,
+                            file->priv->filename, total, success);
+
+  return success;
+}
+
+
+static gboolean
+source_file_load_buffer (SourceFile *file)
+{
+  GError *error;
+
+  g_return_val_if_fail (SOURCE_IS_FILE (file), FALSE);
+  g_return_val_if_fail (file->priv->filename, FALSE);
+  g_return_val_if_fail (g_file_test (file->priv->filename, G_FILE_TEST_EXISTS), FALSE);
+
+  error = NULL;
+  if (!source_file_load_contents (file, NULL, NULL, NULL, &error))
+    {
+      g_warning ("Failed to load file '%s': %s", file->priv->filename, error->message);
+      g_error_free (error);
+      return FALSE;
+    }
+
+  return TRUE;
+}
+
+
+SourceFile *
+source_file_new (const gchar *filename, const gchar *charset, const gchar *mime_type)
+{
+  SourceFile *file;
+
+  file = SOURCE_FILE (g_object_new (SOURCE_TYPE_FILE, NULL));
+
+  if (filename)
+    source_file_set_filename (file, filename);
+
+  if (charset)
+    source_file_set_charset (file, charset);
+
+  if (mime_type)
+    source_file_set_mime_type (file, mime_type);
+
+  if (filename)
+    source_file_load_buffer (file);
+
+  return file;
+}
+
+
+typedef struct
+{
+  const gchar *filename;
+  guint        index;
+  SourceFile  *file;
+  GError      *error;
+} SourceFileBatchJob;
+
+
+static void
+source_file_load_many_worker (gpointer data, gpointer user_data)
+{
+  SourceFileBatchJob *job = data;
+  GAsyncQueue        *done = user_data;
+
+  /* same as source_file_new(), minus the file monitor which has to be
+   * created in the caller's thread to report to its main context */
+  job->file = SOURCE_FILE (g_object_new (SOURCE_TYPE_FILE, NULL));
+  job->file->priv->filename = g_strdup (job->filename);
+
+  /* one missing file in a batch is to be expected, not a critical */
+  source_file_load_contents (job->file, NULL, NULL, NULL, &job->error);
+
+  g_async_queue_push (done, job);
+}
+
+
+/*
+ * Loads every file in the NULL-terminated filenames on a pool of at
+ * most max_threads threads (the number of processors when <= 0). func
+ * is called in the calling thread as each file finishes, in completion
+ * order, with the file's index in filenames and why it couldn't be
+ * loaded (NULL if it was); it takes ownership of the file, which is
+ * empty if loading failed. Returns once all files have been handed to
+ * func.
+ */
+void
+source_file_load_many_full (const gchar * const  *filenames,
+                            gint                  max_threads,
+                            SourceFileLoadedFunc  func,
+                            gpointer              user_data)
+{
+  SourceFileBatchJob *jobs;
+  GThreadPool        *pool;
+  GAsyncQueue        *done;
+  guint               i, n_files;
+
+  g_return_if_fail (filenames);
+  g_return_if_fail (func);
+
+  n_files = g_strv_length ((gchar **) filenames);
+  if (!n_files)
+    return;
+
+  if (max_threads <= 0)
+    max_threads = g_get_num_processors ();
+
+  jobs = g_new0 (SourceFileBatchJob, n_files);
+  done = g_async_queue_new ();
+  pool = g_thread_pool_new (source_file_load_many_worker, done,
+                            MIN ((guint) max_threads, n_files), FALSE, NULL);
+
+  for (i = 0; i < n_files; i++)
+    {
+      jobs[i].filename = filenames[i];
+      jobs[i].index = i;
+
+      /* no pool or no thread to be had, just do it here */
+      if (!pool || !g_thread_pool_push (pool, &jobs[i], NULL))
+        source_file_load_many_worker (&jobs[i], done);
+    }
+
+  for (i = 0; i < n_files; i++)
+    {
+      SourceFileBatchJob *job = g_async_queue_pop (done);
+
+      source_file_monitor_filename (job->file);
+      func (job->file, job->index, job->error, user_data);
+      g_clear_error (&job->error);
+    }
+
+  if (pool)
+    g_thread_pool_free (pool, FALSE, TRUE);
+
+  g_async_queue_unref (done);
+  g_free (jobs);
+}
+
+
+static void
+source_file_load_many_collect (SourceFile   *file,
+                               guint         index,
+                               const GError *error,
+                               gpointer      user_data)
+{
+  SourceFile **files = user_data;
+  files[index] = file;
+}
+
+
+/*
+ * Loads the NULL-terminated filenames in parallel, see
+ * source_file_load_many_full(). Returns a NULL-terminated array of new
+ * files in the same order as filenames; those that couldn't be loaded
+ * are empty, use source_file_load_many_full() to find out why.
+ */
+SourceFile **
+source_file_load_many (const gchar * const *filenames, gint max_threads)
+{
+  SourceFile **files;
+
+  g_return_val_if_fail (filenames, NULL);
+
+  files = g_new0 (SourceFile *, g_strv_length ((gchar **) filenames) + 1);
+  source_file_load_many_full (filenames, max_threads,
+                              source_file_load_many_collect, files);
+
+  return files;
+}
+
+
+/*
+ * Sets up a piece table the first time the contents are edited in
+ * place, sharing the current bytes as its original text.
+ */
+static void
+source_file_ensure_pieces (SourceFile *file)
+{
+  if (file->priv->pieces)
+    return;
+
+  if (file->priv->bytes)
+    file->priv->pieces = source_file_piece_table_new (file->priv->buffer->data,
+                                                      file->priv->buffer->length,
+                                                      (GDestroyNotify) g_bytes_unref,
+                                                      g_bytes_ref (file->priv->bytes));
+  else
+    file->priv->pieces = source_file_piece_table_new (NULL, 0, NULL, NULL);
+}
+
+
+/* makes the flat buffer current again after edits */
+static void
+source_file_flatten_buffer (SourceFile *file)
+{
+  gchar *data;
+
+  if (!file->priv->buffer_stale)
+    return;
+
+  /* the flat copy becomes the table's new original, so edits after
+   * this only ever cost as much as they change */
+  data = source_file_piece_table_flatten (file->priv->pieces);
+  file->priv->buffer->data = data;
+  file->priv->buffer->length = source_file_piece_table_length (file->priv->pieces);
+  file->priv->bytes = g_bytes_new_take (data, file->priv->buffer->length);
+  file->priv->buffer_stale = FALSE;
+
+  source_file_piece_table_rebase (file->priv->pieces, data,
+                                  (GDestroyNotify) g_bytes_unref,
+                                  g_bytes_ref (file->priv->bytes));
+}
+
+
+static void
+source_file_invalidate_buffer (SourceFile *file)
+{
+  if (file->priv->bytes)
+    {
+      g_bytes_unref (file->priv->bytes);
+      file->priv->bytes = NULL;
+    }
+
+  file->priv->buffer->data = NULL;
+  file->priv->buffer->length = source_file_piece_table_length (file->priv->pieces);
+  file->priv->buffer_stale = TRUE;
+}
+
+
+/* returns the length of the contents without flattening them */
+gsize
+source_file_get_length (SourceFile *file)
+{
+  g_return_val_if_fail (SOURCE_IS_FILE (file), 0);
+
+  if (file->priv->pager)
+    return source_file_pager_get_length (file->priv->pager);
+
+  if (file->priv->pieces)
+    return source_file_piece_table_length (file->priv->pieces);
+
+  return file->priv->buffer->length;
+}
+
+
+/* copies a range of the contents without flattening them */
+static void
+source_file_copy_range (SourceFile *file, gsize offset, gsize length, gchar *dest)
+{
+  if (file->priv->buffer_stale)
+    source_file_piece_table_copy (file->priv->pieces, offset, length, dest);
+  else
+    memcpy (dest, file->priv->buffer->data + offset, length);
+}
+
+
+/*
+ * Appends to starts the offset (plus base) of every line that starts in
+ * data, as long as it's between lo and hi. "\r\n" is one line break,
+ * and a "\r" at the very end of data is taken to be one on its own.
+ */
+static void
+source_file_scan_line_starts (const gchar *data,
+                              gsize        length,
+                              gsize        base,
+                              gsize        lo,
+                              gsize        hi,
+                              GArray      *starts)
+{
+  gsize i = 0, start;
+
+  while (i < length)
+    {
+      i += source_file_find_line_break (data + i, length - i);
+      if (i == length)
+        break;
+
+      if (data[i] == '\r' && i + 1 < length && data[i + 1] == '\n')
+        i++;
+      i++;
+
+      start = base + i;
+      if (start > hi)
+        break;
+      if (start >= lo)
+        g_array_append_val (starts, start);
+    }
+}
+
+
+/*
+ * The line index holds the offset each line starts at. After an edit,
+ * every line past it moves by the same amount, so rather than rewriting
+ * them all, that shift is kept pending for the lines from
+ * line_shift_from on and only applied as later edits move past them.
+ */
+static gsize
+source_file_line_start (SourceFile *file, guint line)
+{
+  gsize start = g_array_index (file->priv->line_starts, gsize, line);
+
+  if (line >= file->priv->line_shift_from)
+    start += file->priv->line_shift;
+
+  return start;
+}
+
+
+/* the first line starting at or after offset, or the number of lines */
+static guint
+source_file_line_lower_bound (SourceFile *file, gsize offset)
+{
+  guint lo = 0, hi = file->priv->line_starts->len;
+
+  while (lo < hi)
+    {
+      guint mid = lo + (hi - lo) / 2;
+
+      if (source_file_line_start (file, mid) < offset)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+
+  return lo;
+}
+
+
+static void
+source_file_move_line_shift (SourceFile *file, guint line)
+{
+  gsize *starts = (gsize *) file->priv->line_starts->data;
+  guint  i;
+
+  for (i = file->priv->line_shift_from; i < line; i++)
+    starts[i] += file->priv->line_shift;
+  for (i = line; i < file->priv->line_shift_from; i++)
+    starts[i] -= file->priv->line_shift;
+
+  file->priv->line_shift_from = line;
+}
+
+
+static void
+source_file_ensure_line_index (SourceFile *file)
+{
+  gsize start = 0;
+
+  if (file->priv->line_starts)
+    return;
+
+  source_file_flatten_buffer (file);
+
+  file->priv->line_starts = g_array_new (FALSE, FALSE, sizeof (gsize));
+  g_array_append_val (file->priv->line_starts, start);
+  source_file_scan_line_starts (file->priv->buffer->data,
+                                file->priv->buffer->length,
+                                0, 1, G_MAXSIZE,
+                                file->priv->line_starts);
+
+  file->priv->line_shift_from = file->priv->line_starts->len;
+  file->priv->line_shift = 0;
+}
+
+
+/*
+ * Fixes up the line index after deleted bytes at offset were replaced
+ * by inserted ones. Whether a line starts at some offset only depends
+ * on the two bytes before it, so only lines starting from offset up to
+ * one past the inserted text can have changed; context holds the new
+ * contents from context_offset over that stretch, with a byte either
+ * side, to rescan.
+ */
+static void
+source_file_update_line_index (SourceFile  *file,
+                               gsize        offset,
+                               gsize        deleted,
+                               gsize        inserted,
+                               const gchar *context,
+                               gsize        context_length,
+                               gsize        context_offset)
+{
+  GArray *added;
+  guint   lo, hi;
+
+  lo = MAX (1, source_file_line_lower_bound (file, offset));
+  hi = MAX (lo, source_file_line_lower_bound (file, offset + deleted + 2));
+
+  source_file_move_line_shift (file, hi);
+  if (hi > lo)
+    g_array_remove_range (file->priv->line_starts, lo, hi - lo);
+
+  added = g_array_new (FALSE, FALSE, sizeof (gsize));
+  source_file_scan_line_starts (context, context_length, context_offset,
+                                MAX (offset, 1), offset + inserted + 1,
+                                added);
+  g_array_insert_vals (file->priv->line_starts, lo, added->data, added->len);
+
+  file->priv->line_shift_from = lo + added->len;
+  if (file->priv->line_shift_from < file->priv->line_starts->len)
+    file->priv->line_shift += (gssize) inserted - (gssize) deleted;
+  else
+    file->priv->line_shift = 0;
+
+  g_array_unref (added);
+}
+
+
+/*
+ * Replaces deleted bytes at offset with inserted bytes of text. Edits go
+ * through a piece table, so they cost O(log n) plus the size of the edit
+ * instead of a copy of the whole buffer; the flat buffer is only rebuilt
+ * when asked for.
+ */
+static void
+source_file_splice (SourceFile  *file,
+                    gsize        offset,
+                    gsize        deleted,
+                    const gchar *text,
+                    gsize        inserted)
+{
+  gchar *context = NULL;
+  gsize  context_length = 0, context_offset = offset, after;
+
+  if (!deleted && !inserted)
+    return;
+
+  /* grab what the line index needs around the edit before it happens */
+  if (file->priv->line_starts)
+    {
+      after = MIN (2, source_file_get_length (file) - offset - deleted);
+      context = g_malloc (inserted + 3);
+
+      if (offset > 0)
+        {
+          context_offset = offset - 1;
+          source_file_copy_range (file, context_offset, 1, context);
+          context_length = 1;
+        }
+
+      if (inserted)
+        memcpy (context + context_length, text, inserted);
+      context_length += inserted;
+      source_file_copy_range (file, offset + deleted, after, context + context_length);
+      context_length += after;
+    }
+
+  source_file_ensure_pieces (file);
+  source_file_piece_table_delete (file->priv->pieces, offset, deleted);
+  source_file_piece_table_insert (file->priv->pieces, offset, text, inserted);
+  source_file_invalidate_buffer (file);
+
+  if (context)
+    {
+      source_file_update_line_index (file, offset, deleted, inserted,
+                                     context, context_length, context_offset);
+      g_free (context);
+    }
+}
+
+
+/* inserts length bytes of text, up to the first nul if length is negative */
+gboolean
+source_file_insert (SourceFile  *file,
+                    gsize        offset,
+                    const gchar *text,
+                    gssize       length)
+{
+  g_return_val_if_fail (SOURCE_IS_FILE (file), FALSE);
+  g_return_val_if_fail (!file->priv->pager, FALSE);
+  g_return_val_if_fail (text || length == 0, FALSE);
+  g_return_val_if_fail (offset <= source_file_get_length (file), FALSE);
+
+  if (length < 0)
+    length = strlen (text);
+
+  source_file_splice (file, offset, 0, text, length);
+
+  return TRUE;
+}
+
+
+gboolean
+source_file_delete (SourceFile *file,
+                    gsize       offset,
+                    gsize       length)
+{
+  g_return_val_if_fail (SOURCE_IS_FILE (file), FALSE);
+  g_return_val_if_fail (!file->priv->pager, FALSE);
+  g_return_val_if_fail (offset <= source_file_get_length (file), FALSE);
+  g_return_val_if_fail (length <= source_file_get_length (file) - offset, FALSE);
+
+  source_file_splice (file, offset, length, NULL, 0);
+
+  return TRUE;
+}
+
+
+/* replaces length bytes at offset with text_length bytes of text */
+gboolean
+source_file_replace (SourceFile  *file,
+                     gsize        offset,
+                     gsize        length,
+                     const gchar *text,
+                     gssize       text_length)
+{
+  g_return_val_if_fail (SOURCE_IS_FILE (file), FALSE);
+  g_return_val_if_fail (!file->priv->pager, FALSE);
+  g_return_val_if_fail (text || text_length == 0, FALSE);
+  g_return_val_if_fail (offset <= source_file_get_length (file), FALSE);
+  g_return_val_if_fail (length <= source_file_get_length (file) - offset, FALSE);
+
+  if (text_length < 0)
+    text_length = strlen (text);
+
+  source_file_splice (file, offset, length, text, text_length);
+
+  return TRUE;
+}
+
+
+/*
+ * Lines are split at "\n", "\r" and "\r\n", and an empty line follows a
+ * trailing line break. The index behind these is built on first use and
+ * kept up to date by the edit functions; columns are in bytes.
+ */
+gsize
+source_file_get_line_count (SourceFile *file)
+{
+  g_return_val_if_fail (SOURCE_IS_FILE (file), 0);
+
+  if (file->priv->pager)
+    return source_file_pager_get_line_count (file->priv->pager);
+
+  source_file_ensure_line_index (file);
+
+  return file->priv->line_starts->len;
+}
+
+
+/* the offset just past the last character of line, before its break */
+static gsize
+source_file_line_end (SourceFile *file, guint line)
+{
+  gsize start, next;
+  gchar tail[2];
+
+  if (line + 1 >= file->priv->line_starts->len)
+    return source_file_get_length (file);
+
+  start = source_file_line_start (file, line);
+  next = source_file_line_start (file, line + 1);
+
+  if (next - start >= 2)
+    {
+      source_file_copy_range (file, next - 2, 2, tail);
+      if (tail[0] == '\r' && tail[1] == '\n')
+        return next - 2;
+    }
+
+  return next - 1;
+}
+
+
+/* returns a newly allocated copy of line without its line break */
+static gchar *
+source_file_get_paged_line (SourceFile *file, gsize line, gsize *length)
+{
+  GPtrArray *lines;
+  GError    *error = NULL;
+  GString   *text = NULL;
+
+  lines = g_ptr_array_new ();
+
+  if (!source_file_pager_read_lines (file->priv->pager, line, 1, lines, &error))
+    {
+      g_warning ("Failed to read file '%s': %s", file->priv->filename, error->message);
+      g_error_free (error);
+    }
+  else if (lines->len)
+    text = g_ptr_array_index (lines, 0);
+
+  g_ptr_array_free (lines, TRUE);
+
+  if (!text)
+    return NULL;
+
+  if (length)
+    *length = text->len;
+
+  return g_string_free (text, FALSE);
+}
+
+
+gchar *
+source_file_get_line (SourceFile *file, gsize line, gsize *length)
+{
+  gchar *text;
+  gsize  start, end;
+
+  g_return_val_if_fail (SOURCE_IS_FILE (file), NULL);
+
+  if (file->priv->pager)
+    return source_file_get_paged_line (file, line, length);
+
+  source_file_ensure_line_index (file);
+
+  if (line >= file->priv->line_starts->len)
+    return NULL;
+
+  start = source_file_line_start (file, line);
+  end = source_file_line_end (file, line);
+
+  text = g_malloc (end - start + 1);
+  source_file_copy_range (file, start, end - start, text);
+  text[end - start] = '\0';
+
+  if (length)
+    *length = end - start;
+
+  return text;
+}
+
+
+gboolean
+source_file_offset_to_position (SourceFile *file,
+                                gsize       offset,
+                                gsize      *line,
+                                gsize      *column)
+{
+  guint n;
+
+  g_return_val_if_fail (SOURCE_IS_FILE (file), FALSE);
+  g_return_val_if_fail (!file->priv->pager, FALSE);
+
+  if (offset > source_file_get_length (file))
+    return FALSE;
+
+  source_file_ensure_line_index (file);
+
+  n = source_file_line_lower_bound (file, offset + 1) - 1;
+
+  if (line)
+    *line = n;
+  if (column)
+    *column = offset - source_file_line_start (file, n);
+
+  return TRUE;
+}
+
+
+gboolean
+source_file_position_to_offset (SourceFile *file,
+                                gsize       line,
+                                gsize       column,
+                                gsize      *offset)
+{
+  gsize start;
+
+  g_return_val_if_fail (SOURCE_IS_FILE (file), FALSE);
+  g_return_val_if_fail (!file->priv->pager, FALSE);
+
+  source_file_ensure_line_index (file);
+
+  if (line >= file->priv->line_starts->len)
+    return FALSE;
+
+  start = source_file_line_start (file, line);
+  if (column > source_file_line_end (file, line) - start)
+    return FALSE;
+
+  if (offset)
+    *offset = start + column;
+
+  return TRUE;
+}
+
+
+/*
+ * Returns a newly allocated copy of up to length bytes of the contents
+ * from offset on, nul-terminated, and sets n_read to how many there
+ * were. Paged files only read the pages the range is in.
+ */
+gchar *
+source_file_read_range (SourceFile *file,
+                        guint64     offset,
+                        gsize       length,
+                        gsize      *n_read)
+{
+  GString *text;
+  GError  *error = NULL;
+  guint64  total;
+
+  g_return_val_if_fail (SOURCE_IS_FILE (file), NULL);
+
+  if (!file->priv->pager)
+    {
+      total = source_file_get_length (file);
+      offset = MIN (offset, total);
+      length = MIN (length, total - offset);
+
+      text = g_string_sized_new (length);
+      g_string_set_size (text, length);
+      source_file_copy_range (file, offset, length, text->str);
+    }
+  else
+    {
+      text = g_string_new (NULL);
+      if (!source_file_pager_read (file->priv->pager, offset, length, text, &error))
+        {
+          g_warning ("Failed to read file '%s': %s", file->priv->filename, error->message);
+          g_error_free (error);
+          g_string_free (text, TRUE);
+          return NULL;
+        }
+    }
+
+  if (n_read)
+    *n_read = text->len;
+
+  return g_string_free (text, FALSE);
+}
+
+
+/*
+ * Returns up to n_lines lines from first on, without their line breaks,
+ * as a newly allocated NULL-terminated array. Empty if first is past
+ * the last line.
+ */
+gchar **
+source_file_read_lines (SourceFile *file,
+                        guint64     first,
+                        guint       n_lines)
+{
+  GPtrArray *lines;
+  GError    *error = NULL;
+  gchar     *text;
+  gsize      length;
+  guint      i;
+
+  g_return_val_if_fail (SOURCE_IS_FILE (file), NULL);
+
+  lines = g_ptr_array_new ();
+
+  if (file->priv->pager)
+    {
+      if (!source_file_pager_read_lines (file->priv->pager, first, n_lines, lines, &error))
+        {
+          g_warning ("Failed to read file '%s': %s", file->priv->filename, error->message);
+          g_error_free (error);
+        }
+
+      for (i = 0; i < lines->len; i++)
+        lines->pdata[i] = g_string_free (lines->pdata[i], FALSE);
+    }
+  else
+    for (i = 0; i < n_lines; i++)
+      {
+        text = source_file_get_line (file, first + i, &length);
+        if (!text)
+          break;
+        g_ptr_array_add (lines, text);
+      }
+
+  g_ptr_array_add (lines, NULL);
+
+  return (gchar **) g_ptr_array_free (lines, FALSE);
+}
+
+
+gboolean
+source_file_is_paged (SourceFile *file)
+{
+  g_return_val_if_fail (SOURCE_IS_FILE (file), FALSE);
+  return file->priv->pager != NULL;
+}
+
+
+guint64
+source_file_get_page_threshold (SourceFile *file)
+{
+  g_return_val_if_fail (SOURCE_IS_FILE (file), 0);
+  return file->priv->page_threshold;
+}
+
+
+void
+source_file_set_page_threshold (SourceFile *file, guint64 threshold)
+{
+  g_return_if_fail (SOURCE_IS_FILE (file));
+  file->priv->page_threshold = threshold;
+}
+
+
+gsize
+source_file_get_page_budget (SourceFile *file)
+{
+  g_return_val_if_fail (SOURCE_IS_FILE (file), 0);
+  return file->priv->page_budget;
+}
+
+
+void
+source_file_set_page_budget (SourceFile *file, gsize budget)
+{
+  g_return_if_fail (SOURCE_IS_FILE (file));
+
+  file->priv->page_budget = budget;
+
+  if (file->priv->pager)
+    source_file_pager_set_budget (file->priv->pager, budget);
+}
+
+
+SourceFileLineEnding
+source_file_get_line_ending (SourceFile *file)
+{
+  g_return_val_if_fail (SOURCE_IS_FILE (file), SOURCE_FILE_LINE_ENDING_LF);
+
+  /* not known without reading all of it */
+  if (file->priv->pager)
+    return SOURCE_FILE_LINE_ENDING_AUTO;
+
+  return source_file_guess_line_endings (file);
+}
+
+
+/* after in-place edits, the flat buffer is rebuilt here on demand */
+const SourceFileBuffer *
+source_file_get_buffer (SourceFile *file)
+{
+  g_return_val_if_fail (SOURCE_IS_FILE (file), NULL);
+  g_return_val_if_fail (!file->priv->pager, NULL);
+  source_file_flatten_buffer (file);
+  return (const SourceFileBuffer *) file->priv->buffer;
+}
+
+
+gboolean
+source_file_get_contents (SourceFile *file, gchar **buffer, gsize *length)
+{
+  g_return_val_if_fail (SOURCE_IS_FILE (file), FALSE);
+  g_return_val_if_fail (!file->priv->pager, FALSE);
+  g_return_val_if_fail (buffer, FALSE);
+
+  source_file_flatten_buffer (file);
+
+  if (buffer && file->priv->buffer->data)
+    {
+      *buffer = g_malloc0 (file->priv->buffer->length);
+      memcpy (*buffer, file->priv->buffer->data, file->priv->buffer->length);
+    }
+  else if (buffer)
+    *buffer = NULL;
+
+  if (length)
+    *length = file->priv->buffer->length;
+
+  return TRUE;
+}
+
+
+gboolean
+source_file_set_contents (SourceFile *file, const gchar *buffer, gsize length)
+{
+  g_return_val_if_fail (SOURCE_IS_FILE (file), FALSE);
+
+  /* also where a mapped file gets its private copy */
+  if (!buffer)
+    {
+      source_file_clear_buffer (file);
+      return TRUE;
+    }
+
+  return source_file_take_contents (file, g_memdup2 (buffer, length), length);
+}
+
+
+/*
+ * Returns the contents as an immutable GBytes sharing storage with the
+ * file, which stays valid however the file changes afterwards. Free
+ * with g_bytes_unref().
+ */
+GBytes *
+source_file_get_bytes (SourceFile *file)
+{
+  g_return_val_if_fail (SOURCE_IS_FILE (file), NULL);
+  g_return_val_if_fail (!file->priv->pager, NULL);
+
+  source_file_flatten_buffer (file);
+
+  if (!file->priv->bytes)
+    return g_bytes_new (NULL, 0);
+
+  return g_bytes_ref (file->priv->bytes);
+}
+
+
+/* replaces the contents with bytes, without copying them */
+gboolean
+source_file_set_bytes (SourceFile *file, GBytes *bytes)
+{
+  gsize length;
+
+  g_return_val_if_fail (SOURCE_IS_FILE (file), FALSE);
+  g_return_val_if_fail (bytes, FALSE);
+
+  bytes = g_bytes_ref (bytes);
+  source_file_clear_buffer (file);
+
+  file->priv->bytes = bytes;
+  file->priv->buffer->data = (gchar *) g_bytes_get_data (bytes, &length);
+  file->priv->buffer->length = length;
+
+  return TRUE;
+}
+
+
+/* replaces the contents with length bytes at buffer, which it takes over */
+gboolean
+source_file_take_contents (SourceFile *file, gchar *buffer, gsize length)
+{
+  GBytes *bytes;
+
+  g_return_val_if_fail (SOURCE_IS_FILE (file), FALSE);
+
+  bytes = g_bytes_new_take (buffer, length);
+  source_file_set_bytes (file, bytes);
+  g_bytes_unref (bytes);
+
+  return TRUE;
+}
+
+
+/*
+ * Appends whatever was added to the end of the file since it was loaded,
+ * if that's all that happened: same file, grown, and the window before
+ * the old end as well as the blocks sampled from the rest of it are
+ * unchanged. What that costs doesn't depend on the size of the file,
+ * only the new bytes are decoded. Returns FALSE if the file has to be
+ * loaded again from scratch.
+ */
+static gboolean
+source_file_follow_tail (SourceFile *file)
+{
+  SourceFilePrivate  *priv = file->priv;
+  SourceFileDetectKey key;
+  SourceFileStats     stats;
+  GConverter         *converter = NULL;
+  guint64             end, window_hash, sample_hash;
+  gchar              *chunk, *data = NULL;
+  gsize               length = 0, alloc = 0, carry = 0, input_length, offset;
+  gssize              n;
+  gboolean            eof = FALSE, converted, success = FALSE;
+  gint64              start;
+  gint                fd;
+
+  if (!priv->disk.known || !priv->disk.exists || !priv->charset ||
+      !source_file_charset_is_stateless (priv->charset) ||
+      !source_file_detect_key_init (&key, priv->filename, NULL, 0) ||
+      key.device != priv->disk.key.device ||
+      key.inode != priv->disk.key.inode ||
+      key.size < priv->disk.key.size)
+    return FALSE;
+
+  /* nothing new */
+  if (key.size == priv->disk.key.size)
+    return key.mtime == priv->disk.key.mtime &&
+           key.mtime_nsec == priv->disk.key.mtime_nsec;
+
+  fd = g_open (priv->filename, O_RDONLY, 0);
+  if (fd < 0)
+    return FALSE;
+
+  source_file_stats_start (&stats);
+
+  end = priv->disk.key.size;
+  start = source_file_stats_phase_start ();
+  if (!source_file_hash_window (fd, end, &window_hash) ||
+      window_hash != priv->disk.window_hash ||
+      !source_file_hash_samples (NULL, fd, end, &sample_hash) ||
+      sample_hash != priv->disk.sample_hash ||
+      lseek (fd, end, SEEK_SET) < 0)
+    {
+      close (fd);
+      return FALSE;
+    }
+  source_file_stats_phase_end (&stats, SOURCE_FILE_PHASE_READ, start,
+                               MIN (end, SOURCE_FILE_FOLLOW_WINDOW) * (1 + SOURCE_FILE_FOLLOW_SAMPLES));
+
+  if (!source_file_charset_is_utf8 (priv->charset))
+    {
+      converter = source_file_converter_new ("UTF-8", priv->charset, NULL);
+      if (!converter)
+        {
+          close (fd);
+          return FALSE;
+        }
+    }
+
+  chunk = g_malloc (SOURCE_FILE_LOAD_CHUNK_SIZE);
+
+  /* a partial character at the very end is left for next time */
+  while (!eof)
+    {
+      start = source_file_stats_phase_start ();
+      n = read (fd, chunk + carry, SOURCE_FILE_LOAD_CHUNK_SIZE - carry);
+      if (n < 0 && errno == EINTR)
+        continue;
+      if (n < 0)
+        goto out;
+      source_file_stats_phase_end (&stats, SOURCE_FILE_PHASE_READ, start, n);
+
+      eof = n == 0;
+      input_length = carry + n;
+
+      start = source_file_stats_phase_start ();
+      if (converter)
+        converted = source_file_convert_chunk (converter, chunk, input_length,
+                                               G_CONVERTER_NO_FLAGS,
+                                               &data, &length, &alloc, &carry, NULL);
+      else
+        converted = source_file_append_utf8_chunk (chunk, input_length, FALSE,
+                                                   &data, &length, &alloc, &carry, NULL);
+      source_file_stats_phase_end (&stats, SOURCE_FILE_PHASE_CONVERT, start,
+                                   converted ? input_length - carry : 0);
+
+      if (!converted)
+        goto out;
+
+      source_file_hash_update (&priv->disk.content, chunk, input_length - carry);
+      end += input_length - carry;
+      memmove (chunk, chunk + input_length - carry, carry);
+    }
+
+  success = TRUE;
+
+out:
+  if (success)
+    {
+      /* a failed follow is followed by a full load, which counts instead */
+      source_file_stats_finish (&stats, SOURCE_FILE_STATS_LOAD, priv->filename,
+                                end - priv->disk.key.size, TRUE);
+      priv->load_stats = stats;
+
+      priv->disk.key = key;
+      priv->disk.key.size = end;
+      if (!source_file_hash_window (fd, end, &priv->disk.window_hash) ||
+          !source_file_hash_samples (NULL, fd, end, &priv->disk.sample_hash))
+        priv->disk.known = FALSE;
+      priv->notified = FALSE;
+      priv->externally_modified = FALSE;
+
+      /* the tail went in unconverted, like source_file_relabel_ascii() */
+      if (priv->charset == source_file_intern_charset_name ("US-ASCII") &&
+          !source_file_is_ascii (data, length))
+        priv->charset = source_file_intern_charset_name ("UTF-8");
+
+      if (length)
+        {
+          offset = source_file_get_length (file);
+          source_file_splice (file, offset, 0, data, length);
+          g_signal_emit (file, source_file_signals[SIGNAL_APPENDED], 0,
+                         (guint64) offset, (guint64) length);
+        }
+    }
+  else
+    /* the hash has taken in part of the tail already */
+    priv->disk.known = FALSE;
+
+  if (converter)
+    g_object_unref (converter);
+  close (fd);
+  g_free (chunk);
+  g_free (data);
+
+  return success;
+}
+
+
+gboolean
+source_file_reload (SourceFile *file)
+{
+  g_return_val_if_fail (SOURCE_IS_FILE (file), FALSE);
+
+  if (file->priv->follow && source_file_follow_tail (file))
+    return TRUE;
+
+  return source_file_load_buffer (file);
+}
+
+
+gboolean
+source_file_get_follow (SourceFile *file)
+{
+  g_return_val_if_fail (SOURCE_IS_FILE (file), FALSE);
+  return file->priv->follow;
+}
+
+
+void
+source_file_set_follow (SourceFile *file, gboolean follow)
+{
+  g_return_if_fail (SOURCE_IS_FILE (file));
+  file->priv->follow = follow;
+}
+
+
+gboolean
+source_file_open (SourceFile  *file,
+                  const gchar *filename,
+                  const gchar *charset,
+                  const gchar *mime_type)
+{
+  g_return_val_if_fail (SOURCE_IS_FILE (file), FALSE);
+  g_return_val_if_fail (filename, FALSE);
+
+  source_file_set_filename (file, filename);
+
+  file->priv->charset = source_file_intern_charset_name (charset);
+  file->priv->mime_type = g_intern_string (mime_type);
+
+  return source_file_load_buffer (file);
+}
+
+
+gboolean
+source_file_save (SourceFile *file, const gchar *filename)
+{
+  g_return_val_if_fail (SOURCE_IS_FILE (file), FALSE);
+
+  if (filename)
+    source_file_set_filename (file, filename);
+
+  return source_file_store_buffer (file);
+}
+
+
+typedef struct
+{
+  SourceFile            *scratch;
+  gchar                 *filename;
+  const gchar           *charset;
+  GBytes                *bytes;
+  gboolean               make_backup;
+  gboolean               sync;
+  GFileProgressCallback  progress_callback;
+  gpointer               progress_data;
+  GMainContext          *context;
+  SourceFileDiskState    disk;
+  SourceFileStats        stats;
+} SourceFileAsyncData;
+
+
+typedef struct
+{
+  GFileProgressCallback  progress_callback;
+  gpointer               progress_data;
+  goffset                current;
+  goffset                total;
+} SourceFileAsyncProgress;
+
+
+static void
+source_file_async_data_free (SourceFileAsyncData *data)
+{
+  if (data->scratch)
+    g_object_unref (data->scratch);
+  if (data->context)
+    g_main_context_unref (data->context);
+  g_free (data->filename);
+  if (data->bytes)
+    g_bytes_unref (data->bytes);
+  g_slice_free (SourceFileAsyncData, data);
+}
+
+
+static gboolean
+source_file_async_progress_dispatch (gpointer user_data)
+{
+  SourceFileAsyncProgress *progress = user_data;
+
+  progress->progress_callback (progress->current, progress->total, progress->progress_data);
+
+  return FALSE;
+}
+
+
+/* called in the worker thread, hands progress over to the task's context */
+static void
+source_file_async_progress (goffset current, goffset total, gpointer user_data)
+{
+  SourceFileAsyncData     *data = user_data;
+  SourceFileAsyncProgress *progress;
+
+  progress = g_new0 (SourceFileAsyncProgress, 1);
+  progress->progress_callback = data->progress_callback;
+  progress->progress_data = data->progress_data;
+  progress->current = current;
+  progress->total = total;
+
+  g_main_context_invoke_full (data->context, G_PRIORITY_DEFAULT,
+                              source_file_async_progress_dispatch,
+                              progress, g_free);
+}
+
+
+static SourceFileAsyncData *
+source_file_async_data_new (GFileProgressCallback progress_callback,
+                            gpointer              progress_data)
+{
+  SourceFileAsyncData *data;
+
+  data = g_slice_new0 (SourceFileAsyncData);
+  data->progress_callback = progress_callback;
+  data->progress_data = progress_data;
+  data->context = g_main_context_ref_thread_default ();
+
+  return data;
+}
+
+
+static void
+source_file_load_thread (GTask        *task,
+                         gpointer      source_object,
+                         gpointer      task_data,
+                         GCancellable *cancellable)
+{
+  SourceFileAsyncData *data = task_data;
+  GError              *error = NULL;
+
+  if (!source_file_load_contents (data->scratch, cancellable,
+                                  data->progress_callback ? source_file_async_progress : NULL,
+                                  data,
+                                  &error))
+    g_task_return_error (task, error);
+  else
+    g_task_return_boolean (task, TRUE);
+}
+
+
+/*
+ * Loading is done on a scratch file holding a copy of everything the
+ * loader looks at, so the real file is never touched from the worker
+ * thread. Its results are moved over when the caller finishes.
+ */
+static void
+source_file_load_async (SourceFile            *file,
+                        GCancellable          *cancellable,
+                        GFileProgressCallback  progress_callback,
+                        gpointer               progress_data,
+                        GAsyncReadyCallback    callback,
+                        gpointer               user_data,
+                        gpointer               source_tag)
+{
+  SourceFileAsyncData *data;
+  SourceFile          *scratch;
+  GTask               *task;
+
+  scratch = SOURCE_FILE (g_object_new (SOURCE_TYPE_FILE, NULL));
+  scratch->priv->filename = g_strdup (file->priv->filename);
+  scratch->priv->charset = file->priv->charset;
+  scratch->priv->mime_type = file->priv->mime_type;
+  scratch->priv->zero_copy = file->priv->zero_copy;
+  scratch->priv->page_threshold = file->priv->page_threshold;
+  scratch->priv->page_budget = file->priv->page_budget;
+  if (file->priv->sniff_policy)
+    scratch->priv->sniff_policy = g_memdup2 (file->priv->sniff_policy,
+                                             sizeof (SourceFileSniffPolicy));
+
+  data = source_file_async_data_new (progress_callback, progress_data);
+  data->scratch = scratch;
+
+  task = g_task_new (file, cancellable, callback, user_data);
+  g_task_set_source_tag (task, source_tag);
+  g_task_set_task_data (task, data, (GDestroyNotify) source_file_async_data_free);
+  g_task_run_in_thread (task, source_file_load_thread);
+  g_object_unref (task);
+}
+
+
+static gboolean
+source_file_load_finish (SourceFile    *file,
+                         GAsyncResult  *result,
+                         gpointer       source_tag,
+                         GError       **error)
+{
+  SourceFileAsyncData *data;
+  SourceFile          *scratch;
+
+  g_return_val_if_fail (g_task_is_valid (result, file), FALSE);
+  g_return_val_if_fail (g_task_get_source_tag (G_TASK (result)) == source_tag, FALSE);
+
+  data = g_task_get_task_data (G_TASK (result));
+  scratch = data->scratch;
+  file->priv->load_stats = scratch->priv->load_stats;
+
+  if (!g_task_propagate_boolean (G_TASK (result), error))
+    return FALSE;
+
+  if (scratch->priv->bytes)
+    source_file_set_bytes (file, scratch->priv->bytes);
+  else
+    source_file_clear_buffer (file);
+
+  file->priv->pager = scratch->priv->pager;
+  scratch->priv->pager = NULL;
+
+  file->priv->charset = scratch->priv->charset;
+  file->priv->mime_type = scratch->priv->mime_type;
+
+  source_file_set_disk_state (file, &scratch->priv->disk);
+
+  return TRUE;
+}
+
+
+/*
+ * Like source_file_open() but loads in a worker thread. progress_callback
+ * (if any) and callback are called in the thread-default main context of
+ * the caller; the file's buffer, charset and MIME type are only updated
+ * by source_file_open_finish().
+ */
+void
+source_file_open_async (SourceFile            *file,
+                        const gchar           *filename,
+                        const gchar           *charset,
+                        const gchar           *mime_type,
+                        GCancellable          *cancellable,
+                        GFileProgressCallback  progress_callback,
+                        gpointer               progress_data,
+                        GAsyncReadyCallback    callback,
+                        gpointer               user_data)
+{
+  g_return_if_fail (SOURCE_IS_FILE (file));
+  g_return_if_fail (filename);
 
   source_file_set_filename (file, filename);
 
-  g_free (file->priv->charset);
-  file->priv->charset = NULL;
+  file->priv->charset = source_file_intern_charset_name (charset);
+  file->priv->mime_type = g_intern_string (mime_type);
 
-  if (charset)
-    file->priv->charset = g_strdup (charset);
+  source_file_load_async (file, cancellable, progress_callback, progress_data,
+                          callback, user_data, source_file_open_async);
+}
 
-  g_free (file->priv->mime_type);
-  file->priv->mime_type = NULL;
 
-  if (mime_type)
-    file->priv->mime_type = g_strdup (mime_type);
+gboolean
+source_file_open_finish (SourceFile    *file,
+                         GAsyncResult  *result,
+                         GError       **error)
+{
+  g_return_val_if_fail (SOURCE_IS_FILE (file), FALSE);
+  return source_file_load_finish (file, result, source_file_open_async, error);
+}
 
-  return source_file_load_buffer (file);
+
+void
+source_file_reload_async (SourceFile            *file,
+                          GCancellable          *cancellable,
+                          GFileProgressCallback  progress_callback,
+                          gpointer               progress_data,
+                          GAsyncReadyCallback    callback,
+                          gpointer               user_data)
+{
+  g_return_if_fail (SOURCE_IS_FILE (file));
+  g_return_if_fail (file->priv->filename);
+
+  source_file_load_async (file, cancellable, progress_callback, progress_data,
+                          callback, user_data, source_file_reload_async);
 }
 
 
 gboolean
-source_file_save (SourceFile *file, const gchar *filename)
+source_file_reload_finish (SourceFile    *file,
+                           GAsyncResult  *result,
+                           GError       **error)
 {
   g_return_val_if_fail (SOURCE_IS_FILE (file), FALSE);
+  return source_file_load_finish (file, result, source_file_reload_async, error);
+}
+
+
+static void
+source_file_save_thread (GTask        *task,
+                         gpointer      source_object,
+                         gpointer      task_data,
+                         GCancellable *cancellable)
+{
+  SourceFileAsyncData *data = task_data;
+  GError              *error = NULL;
+
+  if (!source_file_store_contents (data->filename, data->charset,
+                                   g_bytes_get_data (data->bytes, NULL),
+                                   g_bytes_get_size (data->bytes),
+                                   data->make_backup,
+                                   data->sync,
+                                   &data->stats,
+                                   &data->disk,
+                                   cancellable,
+                                   data->progress_callback ? source_file_async_progress : NULL,
+                                   data,
+                                   &error))
+    g_task_return_error (task, error);
+  else
+    g_task_return_boolean (task, TRUE);
+}
+
+
+/*
+ * Like source_file_save() but converts and writes in a worker thread,
+ * from a snapshot of the contents taken when called. If cancelled, the file
+ * on disk is left as it was.
+ */
+void
+source_file_save_async (SourceFile            *file,
+                        const gchar           *filename,
+                        GCancellable          *cancellable,
+                        GFileProgressCallback  progress_callback,
+                        gpointer               progress_data,
+                        GAsyncReadyCallback    callback,
+                        gpointer               user_data)
+{
+  SourceFileAsyncData *data;
+  GTask               *task;
+
+  g_return_if_fail (SOURCE_IS_FILE (file));
+  g_return_if_fail (filename || file->priv->filename);
+  g_return_if_fail (!file->priv->pager);
 
   if (filename)
     source_file_set_filename (file, filename);
 
-  return source_file_store_buffer (file);
+  data = source_file_async_data_new (progress_callback, progress_data);
+  data->filename = g_strdup (file->priv->filename);
+  data->charset = file->priv->charset;
+  data->bytes = source_file_get_bytes (file);
+  data->make_backup = file->priv->make_backup;
+  data->sync = file->priv->sync;
+
+  task = g_task_new (file, cancellable, callback, user_data);
+  g_task_set_source_tag (task, source_file_save_async);
+  g_task_set_task_data (task, data, (GDestroyNotify) source_file_async_data_free);
+  g_task_run_in_thread (task, source_file_save_thread);
+  g_object_unref (task);
+}
+
+
+gboolean
+source_file_save_finish (SourceFile    *file,
+                         GAsyncResult  *result,
+                         GError       **error)
+{
+  SourceFileAsyncData *data;
+  gboolean             success;
+
+  g_return_val_if_fail (SOURCE_IS_FILE (file), FALSE);
+  g_return_val_if_fail (g_task_is_valid (result, file), FALSE);
+  g_return_val_if_fail (g_task_get_source_tag (G_TASK (result)) == source_file_save_async, FALSE);
+
+  data = g_task_get_task_data (G_TASK (result));
+  file->priv->save_stats = data->stats;
+
+  success = g_task_propagate_boolean (G_TASK (result), error);
+
+  /* the file may have been replaced even though syncing it failed */
+  if ((success || data->disk.exists) &&
+      g_strcmp0 (data->filename, file->priv->filename) == 0)
+    source_file_set_disk_state (file, &data->disk);
+
+  return success;
 }
 
 
@@ -639,7 +3452,7 @@ const gchar *
 source_file_get_charset (SourceFile *file)
 {
   g_return_val_if_fail (SOURCE_IS_FILE (file), NULL);
-  return (const gchar *) file->priv->charset;
+  return file->priv->charset;
 }
 
 
@@ -649,11 +3462,10 @@ source_file_set_charset (SourceFile *file, const gchar  *charset)
   g_return_if_fail (SOURCE_IS_FILE (file));
   g_return_if_fail (charset);
 
-  g_free (file->priv->charset);
-  file->priv->charset = source_file_normalize_charset_name (charset);
-
-  if (!file->priv->charset)
-    file->priv->charset = g_strdup (SOURCE_FILE_FALLBACK_CHARSET);
+  if (source_file_lookup_charset (charset))
+    file->priv->charset = source_file_intern_charset_name (charset);
+  else
+    file->priv->charset = source_file_intern_charset_name (SOURCE_FILE_FALLBACK_CHARSET);
 }
 
 
@@ -661,7 +3473,7 @@ const gchar *
 source_file_get_mime_type (SourceFile *file)
 {
   g_return_val_if_fail (SOURCE_IS_FILE (file), NULL);
-  return (const gchar *) file->priv->mime_type;
+  return file->priv->mime_type;
 }
 
 
@@ -671,8 +3483,128 @@ source_file_set_mime_type (SourceFile *file, const gchar  *mime_type)
   g_return_if_fail (SOURCE_IS_FILE (file));
   g_return_if_fail (mime_type);
 
-  g_free (file->priv->mime_type);
-  file->priv->mime_type = g_strdup (mime_type);
+  file->priv->mime_type = g_intern_string (mime_type);
+}
+
+
+void
+source_file_get_default_sniff_policy (SourceFileSniffPolicy *policy)
+{
+  g_return_if_fail (policy);
+
+  G_LOCK (default_sniff_policy);
+  *policy = default_sniff_policy;
+  G_UNLOCK (default_sniff_policy);
+}
+
+
+void
+source_file_set_default_sniff_policy (const SourceFileSniffPolicy *policy)
+{
+  g_return_if_fail (policy);
+
+  G_LOCK (default_sniff_policy);
+  default_sniff_policy = *policy;
+  G_UNLOCK (default_sniff_policy);
+}
+
+
+void
+source_file_get_sniff_policy (SourceFile *file, SourceFileSniffPolicy *policy)
+{
+  g_return_if_fail (SOURCE_IS_FILE (file));
+  g_return_if_fail (policy);
+
+  if (file->priv->sniff_policy)
+    *policy = *file->priv->sniff_policy;
+  else
+    source_file_get_default_sniff_policy (policy);
+}
+
+
+/* passing NULL reverts to the default policy */
+void
+source_file_set_sniff_policy (SourceFile *file, const SourceFileSniffPolicy *policy)
+{
+  g_return_if_fail (SOURCE_IS_FILE (file));
+
+  if (!policy)
+    {
+      g_free (file->priv->sniff_policy);
+      file->priv->sniff_policy = NULL;
+      return;
+    }
+
+  if (!file->priv->sniff_policy)
+    file->priv->sniff_policy = g_new0 (SourceFileSniffPolicy, 1);
+
+  *file->priv->sniff_policy = *policy;
+}
+
+
+gboolean
+source_file_get_zero_copy (SourceFile *file)
+{
+  g_return_val_if_fail (SOURCE_IS_FILE (file), FALSE);
+  return file->priv->zero_copy;
+}
+
+
+void
+source_file_set_zero_copy (SourceFile *file, gboolean zero_copy)
+{
+  g_return_if_fail (SOURCE_IS_FILE (file));
+  file->priv->zero_copy = zero_copy;
+}
+
+
+gboolean
+source_file_get_make_backup (SourceFile *file)
+{
+  g_return_val_if_fail (SOURCE_IS_FILE (file), FALSE);
+  return file->priv->make_backup;
+}
+
+
+void
+source_file_set_make_backup (SourceFile *file, gboolean make_backup)
+{
+  g_return_if_fail (SOURCE_IS_FILE (file));
+  file->priv->make_backup = make_backup;
+}
+
+
+gboolean
+source_file_get_sync (SourceFile *file)
+{
+  g_return_val_if_fail (SOURCE_IS_FILE (file), FALSE);
+  return file->priv->sync;
+}
+
+
+void
+source_file_set_sync (SourceFile *file, gboolean sync)
+{
+  g_return_if_fail (SOURCE_IS_FILE (file));
+  file->priv->sync = sync;
+}
+
+
+void
+source_file_get_load_stats (SourceFile *file, SourceFileStats *stats)
+{
+  g_return_if_fail (SOURCE_IS_FILE (file));
+  g_return_if_fail (stats);
+  *stats = file->priv->load_stats;
+}
+
+
+void
+source_file_get_save_stats (SourceFile *file, SourceFileStats *stats)
+{
+  g_return_if_fail (SOURCE_IS_FILE (file));
+  g_return_if_fail (stats);
+  *stats = file->priv->save_stats;
 }
 
 
@@ -710,12 +3642,101 @@ source_file_get_extension (SourceFile *file)
 
 
 static void
-on_file_monitor_changed (GFileMonitor      *monitor,
-                         GFile             *gfile,
-                         GFile             *other_file,
-                         GFileMonitorEvent  event_type,
-                         SourceFile        *file)
+source_file_set_disk_state (SourceFile *file, const SourceFileDiskState *disk)
+{
+  file->priv->disk = *disk;
+  file->priv->notified = FALSE;
+  file->priv->externally_modified = FALSE;
+}
+
+
+/*
+ * Compares the file on disk with what was last loaded or saved. Only
+ * when the size matches but the metadata doesn't is the whole file read
+ * and hashed. Returns FALSE if nothing changed since then, or since the
+ * last change that was reported.
+ */
+static gboolean
+source_file_check_disk_state (SourceFile *file, SourceFileChange *change)
+{
+  SourceFilePrivate  *priv = file->priv;
+  SourceFileDetectKey key;
+  SourceFileDiskState now;
+  gboolean            exists, differs;
+
+  exists = source_file_detect_key_init (&key, priv->filename, NULL, 0);
+
+  /* seen this one already */
+  if (priv->notified && exists == priv->notified_exists &&
+      (!exists || memcmp (&key, &priv->notified_key, sizeof (key)) == 0))
+    return FALSE;
+
+  if (!exists)
+    differs = !priv->disk.known || priv->disk.exists || priv->notified;
+  else if (!priv->disk.known || !priv->disk.exists || key.size != priv->disk.key.size)
+    differs = TRUE;
+  else if (memcmp (&key, &priv->disk.key, sizeof (key)) == 0)
+    differs = FALSE;
+  else
+    {
+      source_file_read_disk_state (priv->filename, &now);
+      differs = !now.known || !now.exists ||
+                source_file_hash_value (&now.content) != source_file_hash_value (&priv->disk.content);
+      key = now.key;
+      exists = now.exists;
+    }
+
+  /* told it was gone, so it coming back is news even if unchanged */
+  if (exists && priv->notified && !priv->notified_exists)
+    differs = TRUE;
+
+  if (!exists)
+    *change = SOURCE_FILE_CHANGE_DELETED;
+  else if (priv->notified && !priv->notified_exists)
+    *change = SOURCE_FILE_CHANGE_CREATED;
+  else
+    *change = SOURCE_FILE_CHANGE_CONTENTS;
+
+  priv->notified = TRUE;
+  priv->notified_exists = exists;
+  priv->notified_key = key;
+
+  return differs;
+}
+
+
+static gboolean
+source_file_notify_timeout (gpointer user_data)
+{
+  SourceFile      *file = user_data;
+  SourceFileChange change;
+
+  g_source_unref (file->priv->notify_source);
+  file->priv->notify_source = NULL;
+
+  if (source_file_check_disk_state (file, &change))
+    {
+      g_debug ("File '%s' was externally modified",
+               source_file_get_filename (file));
+      file->priv->externally_modified = TRUE;
+      g_signal_emit (file, source_file_signals[SIGNAL_EXTERNALLY_MODIFIED], 0, change);
+    }
+
+  return FALSE;
+}
+
+
+/*
+ * Events are coalesced: the first one starts a timer of notify_delay
+ * milliseconds, and whatever arrives until it fires is checked and
+ * reported once.
+ */
+static void
+on_file_watch_changed (GFileMonitorEvent  event_type,
+                       gpointer           user_data)
 {
+  SourceFile *file = user_data;
+
   g_return_if_fail (SOURCE_IS_FILE (file));
 
   switch (event_type)
@@ -723,10 +3744,13 @@ on_file_monitor_changed (GFileMonitor      *monitor,
     case G_FILE_MONITOR_EVENT_CHANGED:
     case G_FILE_MONITOR_EVENT_CHANGES_DONE_HINT:
     case G_FILE_MONITOR_EVENT_DELETED:
+    case G_FILE_MONITOR_EVENT_CREATED:
     case G_FILE_MONITOR_EVENT_MOVED:
-      g_debug ("File '%s' was externally modified",
-               source_file_get_filename (file));
-      g_signal_emit_by_name (file, "externally-modified");
+      if (file->priv->notify_source)
+        break;
+      file->priv->notify_source = g_timeout_source_new (file->priv->notify_delay);
+      g_source_set_callback (file->priv->notify_source, source_file_notify_timeout, file, NULL);
+      g_source_attach (file->priv->notify_source, g_main_context_get_thread_default ());
       break;
     /* skip others */
     default:
@@ -735,6 +3759,22 @@ on_file_monitor_changed (GFileMonitor      *monitor,
 }
 
 
+guint
+source_file_get_notify_delay (SourceFile *file)
+{
+  g_return_val_if_fail (SOURCE_IS_FILE (file), 0);
+  return file->priv->notify_delay;
+}
+
+
+void
+source_file_set_notify_delay (SourceFile *file, guint delay)
+{
+  g_return_if_fail (SOURCE_IS_FILE (file));
+  file->priv->notify_delay = delay;
+}
+
+
 void
 source_file_set_filename (SourceFile *file, const gchar  *filename)
 {
@@ -747,35 +3787,45 @@ source_file_set_filename (SourceFile *file, const gchar  *filename)
   g_free (file->priv->filename);
   file->priv->filename = g_strdup (filename);
 
-  if (file->priv->file)
-    g_object_unref (file->priv->file);
+  /* whatever was known about the old one doesn't apply */
+  file->priv->disk.known = FALSE;
+  file->priv->notified = FALSE;
+  if (file->priv->notify_source)
+    {
+      g_source_destroy (file->priv->notify_source);
+      g_source_unref (file->priv->notify_source);
+      file->priv->notify_source = NULL;
+    }
 
-  if (file->priv->file_monitor)
-    g_object_unref (file->priv->file_monitor);
+  source_file_monitor_filename (file);
+}
 
-  if (g_file_test (filename, G_FILE_TEST_EXISTS))
-    {
-      file->priv->file = g_file_new_for_path (filename);
 
-      if (G_IS_FILE (file->priv->file))
-        {
-          file->priv->file_monitor =
-            g_file_monitor_file (file->priv->file,
-                                 G_FILE_MONITOR_SEND_MOVED,
-                                 NULL,
-                                 NULL);
+void
+source_file_set_sniff_filename (SourceFile *file, const gchar *filename)
+{
+  g_return_if_fail (SOURCE_IS_FILE (file));
 
+  source_file_watch_remove (file->priv->watch);
+  file->priv->watch = NULL;
 
-          if (G_IS_FILE_MONITOR (file->priv->file_monitor))
-            {
-              file->priv->file_handler_id =
-                g_signal_connect (file->priv->file_monitor,
-                                  "changed",
-                                  G_CALLBACK (on_file_monitor_changed),
-                                  file);
-            }
-        }
-    }
+  g_free (file->priv->filename);
+  file->priv->filename = g_strdup (filename);
+}
+
+
+/* (re)registers the current filename with the shared directory watcher,
+ * which reports to the thread-default main context of the calling thread */
+static void
+source_file_monitor_filename (SourceFile *file)
+{
+  source_file_watch_remove (file->priv->watch);
+  file->priv->watch = NULL;
+
+  if (g_file_test (file->priv->filename, G_FILE_TEST_EXISTS))
+    file->priv->watch = source_file_watch_add (file->priv->filename,
+                                               on_file_watch_changed,
+                                               file);
 }
 
 
@@ -2,14 +2,30 @@
 #define __SOURCEFILE_H__
 
 #include <glib-object.h>
+#include <gio/gio.h>
 
 G_BEGIN_DECLS
 
 
 #define SOURCE_FILE_FALLBACK_CHARSET "ISO-8859-1"
-#define SOURCE_FILE_CHARSET_PATTERN \
-  "(coding|charset|codepage)\\s*[:=]\\s*[\"']?\\s*([^'\"\\s]+)\\s*[\"']?"
-#define SOURCE_FILE_CHARSET_PATTERN_MATCH 2
+
+/* default charset sniffing policy, see SourceFileSniffPolicy */
+#define SOURCE_FILE_SNIFF_MODELINE_LINES 5
+#define SOURCE_FILE_SNIFF_CHUNK_SIZE     4096
+#define SOURCE_FILE_SNIFF_MAX_BYTES      65536
+
+/* size of the chunks files are read and decoded in */
+#define SOURCE_FILE_LOAD_CHUNK_SIZE      65536
+
+/* raw bytes per page of paged files, and the default budget for those in memory */
+#define SOURCE_FILE_PAGE_SIZE            (1024 * 1024)
+#define SOURCE_FILE_PAGE_BUDGET          (64 * 1024 * 1024)
+
+/* milliseconds external changes are collected for before being reported */
+#define SOURCE_FILE_NOTIFY_DELAY         100
+
+/* buckets in the duration histograms of SourceFileStatsTotals */
+#define SOURCE_FILE_STATS_BUCKETS        24
 
 
 #define SOURCE_TYPE_FILE            (source_file_get_type ())
@@ -24,9 +40,12 @@ typedef struct _SourceFile        SourceFile;
 typedef struct _SourceFileClass   SourceFileClass;
 typedef struct _SourceFilePrivate SourceFilePrivate;
 typedef struct _SourceFileBuffer  SourceFileBuffer;
+typedef struct _SourceFileSniffPolicy SourceFileSniffPolicy;
+typedef struct _SourceFileStats       SourceFileStats;
+typedef struct _SourceFileStatsTotals SourceFileStatsTotals;
+typedef struct _SourceFileGlobalStats SourceFileGlobalStats;
 
 
-#if 0
 typedef enum
 {
   SOURCE_FILE_LINE_ENDING_AUTO,
@@ -34,7 +53,37 @@ typedef enum
   SOURCE_FILE_LINE_ENDING_LF,
   SOURCE_FILE_LINE_ENDING_CRLF
 } SourceFileLineEnding;
-#endif
+
+
+/*
+ * Passed to "externally-modified". CREATED is used when the file comes
+ * back after DELETED was reported.
+ */
+typedef enum
+{
+  SOURCE_FILE_CHANGE_CONTENTS,
+  SOURCE_FILE_CHANGE_DELETED,
+  SOURCE_FILE_CHANGE_CREATED
+} SourceFileChange;
+
+
+/*
+ * What loading and saving spend their time on. READ and WRITE are the
+ * file I/O, MODELINE the search for a charset declaration, CHARSET the
+ * byte order mark, ASCII, UTF-8 and uchardet checks, MIME_TYPE libmagic
+ * or GIO, and CONVERT decoding to UTF-8 (or validating it) when loading
+ * and encoding when saving.
+ */
+typedef enum
+{
+  SOURCE_FILE_PHASE_READ,
+  SOURCE_FILE_PHASE_MODELINE,
+  SOURCE_FILE_PHASE_CHARSET,
+  SOURCE_FILE_PHASE_MIME_TYPE,
+  SOURCE_FILE_PHASE_CONVERT,
+  SOURCE_FILE_PHASE_WRITE,
+  SOURCE_FILE_N_PHASES
+} SourceFilePhase;
 
 
 struct _SourceFileBuffer
@@ -44,6 +93,66 @@ struct _SourceFileBuffer
 };
 
 
+/*
+ * Bounds how much of a file is looked at when guessing its charset.
+ * modeline_lines is the number of lines at the start and at the end of
+ * the file searched for a charset declaration, chunk_size how much of
+ * the end of the file is read along with the start, and max_bytes the
+ * most bytes checked for ASCII/UTF-8 or handed to the detector. Zero
+ * means no limit. A guess that turns out not to decode the rest of the
+ * file is redone over all of it when the file is loaded.
+ */
+struct _SourceFileSniffPolicy
+{
+  guint modeline_lines;
+  gsize chunk_size;
+  gsize max_bytes;
+};
+
+
+/*
+ * One load or save. Times are in microseconds, start_time on the
+ * g_get_monotonic_time() clock; bytes is the size of the file read or
+ * written, phase_bytes what each phase went through, raw or UTF-8.
+ * Whatever isn't in a phase (stat, the detection cache, allocation) is
+ * only in duration.
+ */
+struct _SourceFileStats
+{
+  gint64   start_time;
+  gint64   duration;
+  guint64  bytes;
+  gboolean success;
+  gint64   phase_time[SOURCE_FILE_N_PHASES];
+  guint64  phase_bytes[SOURCE_FILE_N_PHASES];
+};
+
+
+/*
+ * Totals over all loads or saves, or over all times a phase ran during
+ * them. histogram[0] counts durations under a microsecond, histogram[i]
+ * those from 2^(i-1) up to 2^i microseconds and the last bucket all
+ * longer ones.
+ */
+struct _SourceFileStatsTotals
+{
+  guint64 count;
+  guint64 failed;
+  guint64 time;
+  guint64 bytes;
+  guint64 histogram[SOURCE_FILE_STATS_BUCKETS];
+};
+
+
+struct _SourceFileGlobalStats
+{
+  SourceFileStatsTotals loads;
+  SourceFileStatsTotals saves;
+  SourceFileStatsTotals load_phases[SOURCE_FILE_N_PHASES];
+  SourceFileStatsTotals save_phases[SOURCE_FILE_N_PHASES];
+};
+
+
 struct _SourceFile
 {
   GObject             parent;
@@ -57,11 +166,30 @@ struct _SourceFileClass
 };
 
 
+typedef void (*SourceFileLoadedFunc) (SourceFile   *file,
+                                      guint         index,
+                                      const GError *error,
+                                      gpointer      user_data);
+
+typedef void (*SourceFileTraceFunc)  (const gchar *name,
+                                      gint64       start_time,
+                                      gint64       duration,
+                                      const gchar *message,
+                                      gpointer     user_data);
+
+
 GType        source_file_get_type         (void);
 SourceFile  *source_file_new              (const gchar  *filename,
                                            const gchar *charset,
                                            const gchar *mime_type);
 
+SourceFile **source_file_load_many        (const gchar * const  *filenames,
+                                           gint                  max_threads);
+void         source_file_load_many_full   (const gchar * const  *filenames,
+                                           gint                  max_threads,
+                                           SourceFileLoadedFunc  func,
+                                           gpointer              user_data);
+
 const gchar *source_file_get_charset      (SourceFile   *file);
 void         source_file_set_charset      (SourceFile   *file,
                                            const gchar  *charset);
@@ -85,6 +213,40 @@ gboolean     source_file_open             (SourceFile  *file,
 
 gboolean     source_file_reload           (SourceFile   *file);
 
+void         source_file_open_async       (SourceFile            *file,
+                                           const gchar           *filename,
+                                           const gchar           *charset,
+                                           const gchar           *mime_type,
+                                           GCancellable          *cancellable,
+                                           GFileProgressCallback  progress_callback,
+                                           gpointer               progress_data,
+                                           GAsyncReadyCallback    callback,
+                                           gpointer               user_data);
+gboolean     source_file_open_finish      (SourceFile            *file,
+                                           GAsyncResult          *result,
+                                           GError               **error);
+
+void         source_file_reload_async     (SourceFile            *file,
+                                           GCancellable          *cancellable,
+                                           GFileProgressCallback  progress_callback,
+                                           gpointer               progress_data,
+                                           GAsyncReadyCallback    callback,
+                                           gpointer               user_data);
+gboolean     source_file_reload_finish    (SourceFile            *file,
+                                           GAsyncResult          *result,
+                                           GError               **error);
+
+void         source_file_save_async       (SourceFile            *file,
+                                           const gchar           *filename,
+                                           GCancellable          *cancellable,
+                                           GFileProgressCallback  progress_callback,
+                                           gpointer               progress_data,
+                                           GAsyncReadyCallback    callback,
+                                           gpointer               user_data);
+gboolean     source_file_save_finish      (SourceFile            *file,
+                                           GAsyncResult          *result,
+                                           GError               **error);
+
 const SourceFileBuffer
             *source_file_get_buffer       (SourceFile   *file);
 
@@ -94,6 +256,174 @@ gboolean     source_file_get_contents     (SourceFile   *file,
 gboolean     source_file_set_contents     (SourceFile   *file,
                                            const gchar  *contents,
                                            gsize         length);
+gboolean     source_file_take_contents    (SourceFile   *file,
+                                           gchar        *contents,
+                                           gsize         length);
+
+GBytes      *source_file_get_bytes        (SourceFile   *file);
+gboolean     source_file_set_bytes        (SourceFile   *file,
+                                           GBytes       *bytes);
+
+gsize        source_file_get_length       (SourceFile   *file);
+gboolean     source_file_insert           (SourceFile   *file,
+                                           gsize         offset,
+                                           const gchar  *text,
+                                           gssize        length);
+gboolean     source_file_delete           (SourceFile   *file,
+                                           gsize         offset,
+                                           gsize         length);
+gboolean     source_file_replace          (SourceFile   *file,
+                                           gsize         offset,
+                                           gsize         length,
+                                           const gchar  *text,
+                                           gssize        text_length);
+
+gsize        source_file_get_line_count   (SourceFile   *file);
+gchar       *source_file_get_line         (SourceFile   *file,
+                                           gsize         line,
+                                           gsize        *length);
+gboolean     source_file_offset_to_position (SourceFile *file,
+                                             gsize       offset,
+                                             gsize      *line,
+                                             gsize      *column);
+gboolean     source_file_position_to_offset (SourceFile *file,
+                                             gsize       line,
+                                             gsize       column,
+                                             gsize      *offset);
+SourceFileLineEnding
+             source_file_get_line_ending  (SourceFile   *file);
+
+gchar       *source_file_read_range       (SourceFile   *file,
+                                           guint64       offset,
+                                           gsize         length,
+                                           gsize        *n_read);
+gchar      **source_file_read_lines       (SourceFile   *file,
+                                           guint64       first,
+                                           guint         n_lines);
+
+/*
+ * Files of at least page_threshold bytes (0, the default, for never) are
+ * paged: only the charset and MIME type are detected when loading, and
+ * the contents are decoded a page at a time as read_range(), read_lines()
+ * and get_line() need them, keeping at most page_budget bytes of decoded
+ * pages around. Paged files are read-only and have no buffer; their
+ * length and line count take one pass over the whole file. Files in a
+ * charset that can't be decoded from the middle, like ISO-2022-JP or
+ * UTF-16 and UTF-32 without a byte order mark, are loaded whole instead.
+ */
+gboolean     source_file_is_paged         (SourceFile   *file);
+guint64      source_file_get_page_threshold (SourceFile *file);
+void         source_file_set_page_threshold (SourceFile *file,
+                                             guint64     threshold);
+gsize        source_file_get_page_budget  (SourceFile   *file);
+void         source_file_set_page_budget  (SourceFile   *file,
+                                           gsize         budget);
+
+void         source_file_get_sniff_policy (SourceFile            *file,
+                                           SourceFileSniffPolicy *policy);
+void         source_file_set_sniff_policy (SourceFile                  *file,
+                                           const SourceFileSniffPolicy *policy);
+
+void         source_file_get_default_sniff_policy (SourceFileSniffPolicy *policy);
+void         source_file_set_default_sniff_policy (const SourceFileSniffPolicy *policy);
+
+/*
+ * When enabled, files that are already UTF-8 (or ASCII) are mapped and
+ * used in place instead of being copied, until the contents are set.
+ * The buffer is then read-only and not nul-terminated, and truncating
+ * the file on disk while it is mapped crashes the process (SIGBUS).
+ */
+gboolean     source_file_get_zero_copy    (SourceFile   *file);
+void         source_file_set_zero_copy    (SourceFile   *file,
+                                           gboolean      zero_copy);
+
+/*
+ * Saving always writes to a temporary file that replaces the original
+ * once complete. make_backup keeps the original as "filename~"; sync
+ * makes saving wait until the new contents and the directory entry
+ * pointing at them have reached the disk, and fail if they can't.
+ */
+gboolean     source_file_get_make_backup  (SourceFile   *file);
+void         source_file_set_make_backup  (SourceFile   *file,
+                                           gboolean      make_backup);
+gboolean     source_file_get_sync         (SourceFile   *file);
+void         source_file_set_sync         (SourceFile   *file,
+                                           gboolean      sync);
+
+void         source_file_magic_pool_clear (void);
+
+/*
+ * Persistent cache of detected charsets and MIME types, off by default.
+ * See detectcache.c.
+ */
+void         source_file_detect_cache_enable    (const gchar *path);
+void         source_file_detect_cache_disable   (void);
+gboolean     source_file_detect_cache_flush     (void);
+void         source_file_detect_cache_get_stats (guint       *hits,
+                                                 guint       *misses);
+
+/*
+ * iconv descriptors are reused within each thread, see iconvcache.c.
+ */
+void         source_file_iconv_cache_flush      (void);
+void         source_file_iconv_cache_get_stats  (guint       *hits,
+                                                 guint       *misses);
+
+/*
+ * For files that only ever grow, like logs. When follow is set and the
+ * file was only appended to since it was loaded, source_file_reload()
+ * reads, decodes and appends just the new data, then emits "appended"
+ * (SourceFile *file, guint64 offset, guint64 length) with the range it
+ * now takes up in the buffer. Anything else reloads the whole file.
+ * Only the last few KiB before the old end and a few blocks sampled
+ * from the rest are compared, so a rewrite that keeps exactly those
+ * and the same inode is taken for an append.
+ */
+gboolean     source_file_get_follow       (SourceFile   *file);
+void         source_file_set_follow       (SourceFile   *file,
+                                           gboolean      follow);
+
+/*
+ * Statistics of the last load (including appends read by follow) and
+ * the last save of a file, and totals over all files since the last
+ * reset. Asynchronous loads and saves show up in the file's stats once
+ * finished.
+ */
+void         source_file_get_load_stats   (SourceFile            *file,
+                                           SourceFileStats       *stats);
+void         source_file_get_save_stats   (SourceFile            *file,
+                                           SourceFileStats       *stats);
+void         source_file_get_global_stats (SourceFileGlobalStats *stats);
+void         source_file_reset_global_stats (void);
+const gchar *source_file_phase_get_name   (SourceFilePhase        phase);
+
+/*
+ * Every phase, load and save is reported to func as a trace mark named
+ * after it ("load", "save" with the filename as message, or the phase
+ * name), and to sysprof when built with HAVE_SYSPROF and it is
+ * recording. func is called from whichever thread did the work. With
+ * neither, a phase costs two clock reads and no tracing.
+ */
+void         source_file_set_trace_func   (SourceFileTraceFunc    func,
+                                           gpointer               user_data);
+
+/*
+ * Files are watched for external changes through one monitor per
+ * directory, see dirwatch.c.
+ */
+void         source_file_set_max_directory_watches (guint  max_watches);
+void         source_file_get_watch_stats           (guint *n_directories,
+                                                    guint *n_monitors,
+                                                    guint *n_polled_files);
+
+/*
+ * "externally-modified" (SourceFile *file, SourceFileChange change) is
+ * emitted at most once per notify_delay milliseconds, and only when the
+ * file on disk differs from what was last loaded or saved.
+ */
+guint        source_file_get_notify_delay (SourceFile   *file);
+void         source_file_set_notify_delay (SourceFile   *file,
+                                           guint         delay);
 
 
 G_END_DECLS
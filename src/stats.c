@@ -0,0 +1,189 @@
+#include <string.h>
+#include <glib.h>
+#include "sourcefile.h"
+#include "stats.h"
+
+#ifdef HAVE_SYSPROF
+#  include <sysprof-capture.h>
+#endif
+
+
+/*
+ * Per-phase timing of loads and saves. Each SourceFile keeps the stats of
+ * its own last load and save; finishing one also adds it to the global
+ * totals, which are only locked then, once per load or save. Phases are
+ * timed with g_get_monotonic_time() and reported as trace marks only
+ * while someone is listening.
+ */
+
+
+G_LOCK_DEFINE_STATIC (global_stats);
+static SourceFileGlobalStats global_stats;
+
+G_LOCK_DEFINE_STATIC (trace);
+static SourceFileTraceFunc trace_func = NULL;
+static gpointer            trace_data = NULL;
+
+
+static const gchar *phase_names[SOURCE_FILE_N_PHASES] =
+{
+  "read",
+  "modeline",
+  "charset",
+  "mime-type",
+  "convert",
+  "write"
+};
+
+
+static void
+source_file_stats_trace (const gchar *name, gint64 start, gint64 duration, const gchar *message)
+{
+  SourceFileTraceFunc func;
+  gpointer            data;
+
+  if (G_UNLIKELY (g_atomic_pointer_get (&trace_func)))
+    {
+      G_LOCK (trace);
+      func = trace_func;
+      data = trace_data;
+      G_UNLOCK (trace);
+
+      if (func)
+        func (name, start, duration, message, data);
+    }
+
+#ifdef HAVE_SYSPROF
+  if (sysprof_collector_is_active ())
+    sysprof_collector_mark (start * 1000, duration * 1000, "SourceFile", name, message);
+#endif
+}
+
+
+static void
+source_file_stats_add (SourceFileStatsTotals *totals, gint64 duration, guint64 bytes, gboolean success)
+{
+  guint bucket = 0;
+
+  if (duration > 0)
+    bucket = MIN (g_bit_storage ((gulong) duration), SOURCE_FILE_STATS_BUCKETS - 1);
+
+  totals->count++;
+  if (!success)
+    totals->failed++;
+  totals->time += MAX (duration, 0);
+  totals->bytes += bytes;
+  totals->histogram[bucket]++;
+}
+
+
+void
+source_file_stats_start (SourceFileStats *stats)
+{
+  memset (stats, 0, sizeof (SourceFileStats));
+  stats->start_time = g_get_monotonic_time ();
+}
+
+
+gint64
+source_file_stats_phase_start (void)
+{
+  return g_get_monotonic_time ();
+}
+
+
+/* phases that run more than once, like reading in chunks, add up */
+void
+source_file_stats_phase_end (SourceFileStats *stats,
+                             SourceFilePhase  phase,
+                             gint64           start,
+                             guint64          bytes)
+{
+  gint64 duration = g_get_monotonic_time () - start;
+
+  if (stats)
+    {
+      stats->phase_time[phase] += duration;
+      stats->phase_bytes[phase] += bytes;
+    }
+
+  source_file_stats_trace (phase_names[phase], start, duration, NULL);
+}
+
+
+void
+source_file_stats_finish (SourceFileStats          *stats,
+                          SourceFileStatsOperation  operation,
+                          const gchar              *filename,
+                          guint64                   bytes,
+                          gboolean                  success)
+{
+  SourceFileStatsTotals *totals, *phases;
+  guint                  i;
+
+  stats->duration = g_get_monotonic_time () - stats->start_time;
+  stats->bytes = bytes;
+  stats->success = success;
+
+  G_LOCK (global_stats);
+
+  if (operation == SOURCE_FILE_STATS_LOAD)
+    {
+      totals = &global_stats.loads;
+      phases = global_stats.load_phases;
+    }
+  else
+    {
+      totals = &global_stats.saves;
+      phases = global_stats.save_phases;
+    }
+
+  source_file_stats_add (totals, stats->duration, bytes, success);
+  for (i = 0; i < SOURCE_FILE_N_PHASES; i++)
+    if (stats->phase_time[i] || stats->phase_bytes[i])
+      source_file_stats_add (&phases[i], stats->phase_time[i], stats->phase_bytes[i], success);
+
+  G_UNLOCK (global_stats);
+
+  source_file_stats_trace (operation == SOURCE_FILE_STATS_LOAD ? "load" : "save",
+                           stats->start_time, stats->duration, filename);
+}
+
+
+void
+source_file_get_global_stats (SourceFileGlobalStats *stats)
+{
+  g_return_if_fail (stats);
+
+  G_LOCK (global_stats);
+  *stats = global_stats;
+  G_UNLOCK (global_stats);
+}
+
+
+void
+source_file_reset_global_stats (void)
+{
+  G_LOCK (global_stats);
+  memset (&global_stats, 0, sizeof (SourceFileGlobalStats));
+  G_UNLOCK (global_stats);
+}
+
+
+const gchar *
+source_file_phase_get_name (SourceFilePhase phase)
+{
+  g_return_val_if_fail (phase < SOURCE_FILE_N_PHASES, NULL);
+
+  return phase_names[phase];
+}
+
+
+void
+source_file_set_trace_func (SourceFileTraceFunc func, gpointer user_data)
+{
+  G_LOCK (trace);
+  trace_data = user_data;
+  g_atomic_pointer_set (&trace_func, func);
+  G_UNLOCK (trace);
+}
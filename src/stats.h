@@ -0,0 +1,29 @@
+#ifndef __SOURCESTATS_H__
+#define __SOURCESTATS_H__
+
+G_BEGIN_DECLS
+
+
+typedef enum
+{
+  SOURCE_FILE_STATS_LOAD,
+  SOURCE_FILE_STATS_SAVE
+} SourceFileStatsOperation;
+
+
+void   source_file_stats_start      (SourceFileStats          *stats);
+gint64 source_file_stats_phase_start (void);
+void   source_file_stats_phase_end  (SourceFileStats          *stats,
+                                     SourceFilePhase           phase,
+                                     gint64                    start,
+                                     guint64                   bytes);
+void   source_file_stats_finish     (SourceFileStats          *stats,
+                                     SourceFileStatsOperation  operation,
+                                     const gchar              *filename,
+                                     guint64                   bytes,
+                                     gboolean                  success);
+
+
+G_END_DECLS
+
+#endif /* __SOURCESTATS_H__ */
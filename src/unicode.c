@@ -0,0 +1,466 @@
+#include <string.h>
+#include <glib.h>
+#include <gio/gio.h>
+#include "charsets.h"
+#include "codec.h"
+#include "unicode.h"
+
+#ifdef __SSE2__
+#  include <emmintrin.h>
+#endif
+
+
+/*
+ * Built-in transcoders between UTF-8 and UTF-16 or UTF-32 with a fixed
+ * byte order, which is what source_file_scan_unicode_bom() names. Their
+ * byte order mark is an ordinary U+FEFF to these, so it stays at the start
+ * of the text and is written back as it was, in the same byte order, when
+ * saving.
+ *
+ * Runs of ASCII are converted 16 characters at a time with SSE2: packing
+ * code units down to bytes, or interleaving bytes with zeros the other way
+ * round. Everything else goes a character at a time and is checked as
+ * strictly as iconv does: surrogates must pair up in UTF-16 and can't be
+ * encoded on their own, and nothing past U+10FFFF is let through.
+ */
+
+
+struct _SourceFileUnicode
+{
+  gint     mib_enum;
+  guint    unit;        /* bytes per code unit */
+  gboolean big_endian;
+};
+
+
+static const SourceFileUnicode unicode_forms[] =
+{
+  { 1013, 2, TRUE  },   /* UTF-16BE */
+  { 1014, 2, FALSE },   /* UTF-16LE */
+  { 1018, 4, TRUE  },   /* UTF-32BE */
+  { 1019, 4, FALSE }    /* UTF-32LE */
+};
+
+
+static inline guint
+load_unit (const guchar *p, guint unit, gboolean big_endian)
+{
+  if (unit == 2)
+    return big_endian ? (p[0] << 8) | p[1] : (p[1] << 8) | p[0];
+
+  return big_endian ? ((guint) p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3] :
+                      ((guint) p[3] << 24) | (p[2] << 16) | (p[1] << 8) | p[0];
+}
+
+
+static inline void
+store_unit (gchar *o, guint u, guint unit, gboolean big_endian)
+{
+  guint i;
+
+  for (i = 0; i < unit; i++)
+    o[big_endian ? unit - 1 - i : i] = (u >> (8 * i)) & 0xff;
+}
+
+
+static inline guint
+utf8_length (gunichar ch)
+{
+  return ch < 0x80 ? 1 : ch < 0x800 ? 2 : ch < 0x10000 ? 3 : 4;
+}
+
+
+static inline void
+utf8_store (gchar *o, gunichar ch, guint n)
+{
+  static const guchar first[] = { 0, 0, 0xc0, 0xe0, 0xf0 };
+  guint i;
+
+  for (i = n - 1; i > 0; i--, ch >>= 6)
+    o[i] = 0x80 | (ch & 0x3f);
+  o[0] = first[n] | ch;
+}
+
+
+/* the non-ASCII character at p and its length, or 0 if it is cut off or
+ * invalid, per table 3-7 of the Unicode standard */
+static inline guint
+utf8_load (const guchar *p, const guchar *end, gunichar *ch, SourceFileCodecStatus *status)
+{
+  guchar c = p[0], lo = 0x80, hi = 0xbf;
+  guint  n, i;
+
+  if (c < 0xc2 || c > 0xf4)
+    {
+      *status = SOURCE_FILE_CODEC_INVALID;
+      return 0;
+    }
+
+  n = c < 0xe0 ? 2 : c < 0xf0 ? 3 : 4;
+
+  if (c == 0xe0)
+    lo = 0xa0;
+  else if (c == 0xed)
+    hi = 0x9f;
+  else if (c == 0xf0)
+    lo = 0x90;
+  else if (c == 0xf4)
+    hi = 0x8f;
+
+  *ch = c & (0x7f >> n);
+  for (i = 1; i < n; i++)
+    {
+      if (p + i == end)
+        {
+          *status = SOURCE_FILE_CODEC_PARTIAL;
+          return 0;
+        }
+      if (p[i] < (i == 1 ? lo : 0x80) || p[i] > (i == 1 ? hi : 0xbf))
+        {
+          *status = SOURCE_FILE_CODEC_INVALID;
+          return 0;
+        }
+      *ch = (*ch << 6) | (p[i] & 0x3f);
+    }
+
+  return n;
+}
+
+
+/* how many code units of ASCII from p were copied to o as bytes */
+static inline gsize
+ascii_units_to_utf8 (const guchar *p, const guchar *end, gchar *o, gchar *out_end,
+                     guint unit, gboolean big_endian)
+{
+  gsize n = 0;
+
+#ifdef __SSE2__
+  const __m128i zero = _mm_setzero_si128 ();
+  __m128i       a, b, c, d, high;
+
+  if (unit == 2)
+    {
+      /* the bits that make a unit non-ASCII, as loaded */
+      high = _mm_set1_epi16 (big_endian ? (gshort) 0x80ff : (gshort) 0xff80);
+
+      for (; end - p >= 32 && out_end - o >= 16; p += 32, o += 16, n += 16)
+        {
+          a = _mm_loadu_si128 ((const __m128i *) p);
+          b = _mm_loadu_si128 ((const __m128i *) (p + 16));
+          if (_mm_movemask_epi8 (_mm_cmpeq_epi8 (_mm_and_si128 (_mm_or_si128 (a, b), high),
+                                                 zero)) != 0xffff)
+            break;
+          if (big_endian)
+            {
+              a = _mm_srli_epi16 (a, 8);
+              b = _mm_srli_epi16 (b, 8);
+            }
+          _mm_storeu_si128 ((__m128i *) o, _mm_packus_epi16 (a, b));
+        }
+    }
+  else
+    {
+      high = _mm_set1_epi32 (big_endian ? (gint) 0x80ffffff : (gint) 0xffffff80);
+
+      for (; end - p >= 64 && out_end - o >= 16; p += 64, o += 16, n += 16)
+        {
+          a = _mm_loadu_si128 ((const __m128i *) p);
+          b = _mm_loadu_si128 ((const __m128i *) (p + 16));
+          c = _mm_loadu_si128 ((const __m128i *) (p + 32));
+          d = _mm_loadu_si128 ((const __m128i *) (p + 48));
+          if (_mm_movemask_epi8 (_mm_cmpeq_epi8 (_mm_and_si128 (_mm_or_si128 (_mm_or_si128 (a, b),
+                                                                              _mm_or_si128 (c, d)),
+                                                                high),
+                                                 zero)) != 0xffff)
+            break;
+          if (big_endian)
+            {
+              a = _mm_srli_epi32 (a, 24);
+              b = _mm_srli_epi32 (b, 24);
+              c = _mm_srli_epi32 (c, 24);
+              d = _mm_srli_epi32 (d, 24);
+            }
+          _mm_storeu_si128 ((__m128i *) o,
+                            _mm_packus_epi16 (_mm_packs_epi32 (a, b), _mm_packs_epi32 (c, d)));
+        }
+    }
+#endif
+
+  return n;
+}
+
+
+/* how many bytes of ASCII from p were widened into code units at o */
+static inline gsize
+ascii_utf8_to_units (const guchar *p, const guchar *end, gchar *o, gchar *out_end,
+                     guint unit, gboolean big_endian)
+{
+  gsize n = 0;
+
+#ifdef __SSE2__
+  const __m128i zero = _mm_setzero_si128 ();
+  __m128i       input, lo, hi;
+
+  for (; end - p >= 16 && out_end - o >= 16 * unit; p += 16, o += 16 * unit, n += 16)
+    {
+      input = _mm_loadu_si128 ((const __m128i *) p);
+      if (_mm_movemask_epi8 (input))
+        break;
+
+      lo = _mm_unpacklo_epi8 (input, zero);
+      hi = _mm_unpackhi_epi8 (input, zero);
+
+      if (unit == 2)
+        {
+          if (big_endian)
+            {
+              lo = _mm_slli_epi16 (lo, 8);
+              hi = _mm_slli_epi16 (hi, 8);
+            }
+          _mm_storeu_si128 ((__m128i *) o, lo);
+          _mm_storeu_si128 ((__m128i *) (o + 16), hi);
+        }
+      else
+        {
+          __m128i q[4] = { _mm_unpacklo_epi16 (lo, zero), _mm_unpackhi_epi16 (lo, zero),
+                           _mm_unpacklo_epi16 (hi, zero), _mm_unpackhi_epi16 (hi, zero) };
+          guint   i;
+
+          for (i = 0; i < 4; i++)
+            _mm_storeu_si128 ((__m128i *) (o + 16 * i),
+                              big_endian ? _mm_slli_epi32 (q[i], 24) : q[i]);
+        }
+    }
+#endif
+
+  return n;
+}
+
+
+static inline SourceFileCodecStatus
+unicode_decode (const guchar *p, const guchar *end, gchar *o, gchar *out_end,
+                guint unit, gboolean big_endian, gboolean simd,
+                gsize *n_read, gsize *n_written)
+{
+  const guchar          *start = p, *retry = p;
+  gchar                 *out = o;
+  SourceFileCodecStatus  status = SOURCE_FILE_CODEC_DONE;
+  gunichar               ch, low;
+  gsize                  n;
+  guint                  length, consumed;
+
+  while (p < end)
+    {
+      if ((gsize) (end - p) < unit)
+        {
+          status = SOURCE_FILE_CODEC_PARTIAL;
+          break;
+        }
+
+      ch = load_unit (p, unit, big_endian);
+      consumed = unit;
+
+      if (ch < 0x80)
+        {
+          /* a block that wasn't all ASCII isn't looked at again */
+          if (simd && p >= retry)
+            {
+              if ((n = ascii_units_to_utf8 (p, end, o, out_end, unit, big_endian)))
+                {
+                  p += n * unit;
+                  o += n;
+                  continue;
+                }
+              retry = p + 16 * unit;
+            }
+          if (o == out_end)
+            {
+              status = SOURCE_FILE_CODEC_NO_SPACE;
+              break;
+            }
+          *o++ = ch;
+          p += unit;
+          continue;
+        }
+
+      if (ch >= 0xd800 && ch < 0xdc00 && unit == 2)
+        {
+          if (end - p < 4)
+            {
+              status = SOURCE_FILE_CODEC_PARTIAL;
+              break;
+            }
+          low = load_unit (p + 2, 2, big_endian);
+          if (low < 0xdc00 || low >= 0xe000)
+            {
+              status = SOURCE_FILE_CODEC_INVALID;
+              break;
+            }
+          ch = 0x10000 + ((ch - 0xd800) << 10) + (low - 0xdc00);
+          consumed = 4;
+        }
+      else if ((ch >= 0xd800 && ch < 0xe000) || ch > 0x10ffff)
+        {
+          status = SOURCE_FILE_CODEC_INVALID;
+          break;
+        }
+
+      length = utf8_length (ch);
+      if ((gsize) (out_end - o) < length)
+        {
+          status = SOURCE_FILE_CODEC_NO_SPACE;
+          break;
+        }
+      utf8_store (o, ch, length);
+      o += length;
+      p += consumed;
+    }
+
+  *n_read = p - start;
+  *n_written = o - out;
+
+  return status;
+}
+
+
+static inline SourceFileCodecStatus
+unicode_encode (const guchar *p, const guchar *end, gchar *o, gchar *out_end,
+                guint unit, gboolean big_endian, gboolean simd,
+                gsize *n_read, gsize *n_written)
+{
+  const guchar          *start = p, *retry = p;
+  gchar                 *out = o;
+  SourceFileCodecStatus  status = SOURCE_FILE_CODEC_DONE;
+  gunichar               ch;
+  gsize                  n;
+  guint                  length;
+
+  while (p < end)
+    {
+      if (*p < 0x80)
+        {
+          if (simd && p >= retry)
+            {
+              if ((n = ascii_utf8_to_units (p, end, o, out_end, unit, big_endian)))
+                {
+                  p += n;
+                  o += n * unit;
+                  continue;
+                }
+              retry = p + 16;
+            }
+          ch = *p;
+          length = 1;
+        }
+      else if (!(length = utf8_load (p, end, &ch, &status)))
+        break;
+
+      if (unit == 2 && ch >= 0x10000)
+        {
+          if (out_end - o < 4)
+            {
+              status = SOURCE_FILE_CODEC_NO_SPACE;
+              break;
+            }
+          store_unit (o, 0xd800 + ((ch - 0x10000) >> 10), 2, big_endian);
+          store_unit (o + 2, 0xdc00 + ((ch - 0x10000) & 0x3ff), 2, big_endian);
+          o += 4;
+        }
+      else
+        {
+          if ((gsize) (out_end - o) < unit)
+            {
+              status = SOURCE_FILE_CODEC_NO_SPACE;
+              break;
+            }
+          store_unit (o, ch, unit, big_endian);
+          o += unit;
+        }
+
+      p += length;
+    }
+
+  *n_read = p - start;
+  *n_written = o - out;
+
+  return status;
+}
+
+
+const SourceFileUnicode *
+source_file_unicode_lookup (const gchar *charset_name)
+{
+  const SourceFileCharset *charset;
+  guint                    i;
+
+  charset = source_file_lookup_charset (charset_name);
+  if (!charset)
+    return NULL;
+
+  for (i = 0; i < G_N_ELEMENTS (unicode_forms); i++)
+    if (unicode_forms[i].mib_enum == charset->mib_enum)
+      return &unicode_forms[i];
+
+  return NULL;
+}
+
+
+/*
+ * Decodes as much of input as fits into output, stopping early at a code
+ * unit that is cut off or doesn't make a character. codec is a
+ * SourceFileUnicode. The output is never more than 1.5 times the input.
+ */
+SourceFileCodecStatus
+source_file_unicode_decode (gconstpointer  codec,
+                            const gchar   *input,
+                            gsize          input_length,
+                            gchar         *output,
+                            gsize          output_size,
+                            gsize         *n_read,
+                            gsize         *n_written)
+{
+  const SourceFileUnicode *form = codec;
+  const guchar            *p = (const guchar *) input;
+  gchar                   *out_end = output + output_size;
+  gboolean                 simd = source_file_codec_use_simd ();
+
+  /* one copy each, so the byte order is never looked at per character */
+  if (form->unit == 2 && form->big_endian)
+    return unicode_decode (p, p + input_length, output, out_end, 2, TRUE, simd, n_read, n_written);
+  else if (form->unit == 2)
+    return unicode_decode (p, p + input_length, output, out_end, 2, FALSE, simd, n_read, n_written);
+  else if (form->big_endian)
+    return unicode_decode (p, p + input_length, output, out_end, 4, TRUE, simd, n_read, n_written);
+  else
+    return unicode_decode (p, p + input_length, output, out_end, 4, FALSE, simd, n_read, n_written);
+}
+
+
+/*
+ * Encodes UTF-8 input into output, stopping early at a character that is
+ * cut off or invalid. UTF-16 output is at most twice the input, UTF-32
+ * four times.
+ */
+SourceFileCodecStatus
+source_file_unicode_encode (gconstpointer  codec,
+                            const gchar   *input,
+                            gsize          input_length,
+                            gchar         *output,
+                            gsize          output_size,
+                            gsize         *n_read,
+                            gsize         *n_written)
+{
+  const SourceFileUnicode *form = codec;
+  const guchar            *p = (const guchar *) input;
+  gchar                   *out_end = output + output_size;
+  gboolean                 simd = source_file_codec_use_simd ();
+
+  if (form->unit == 2 && form->big_endian)
+    return unicode_encode (p, p + input_length, output, out_end, 2, TRUE, simd, n_read, n_written);
+  else if (form->unit == 2)
+    return unicode_encode (p, p + input_length, output, out_end, 2, FALSE, simd, n_read, n_written);
+  else if (form->big_endian)
+    return unicode_encode (p, p + input_length, output, out_end, 4, TRUE, simd, n_read, n_written);
+  else
+    return unicode_encode (p, p + input_length, output, out_end, 4, FALSE, simd, n_read, n_written);
+}
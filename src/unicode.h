@@ -0,0 +1,31 @@
+#ifndef __SOURCEUNICODE_H__
+#define __SOURCEUNICODE_H__
+
+G_BEGIN_DECLS
+
+
+/* UTF-16 or UTF-32 in one byte order, NULL for any other charset */
+typedef struct _SourceFileUnicode SourceFileUnicode;
+
+
+/* both are SourceFileCodecFuncs over a SourceFileUnicode */
+const SourceFileUnicode *source_file_unicode_lookup (const gchar   *charset_name);
+SourceFileCodecStatus    source_file_unicode_decode (gconstpointer  codec,
+                                                     const gchar   *input,
+                                                     gsize          input_length,
+                                                     gchar         *output,
+                                                     gsize          output_size,
+                                                     gsize         *n_read,
+                                                     gsize         *n_written);
+SourceFileCodecStatus    source_file_unicode_encode (gconstpointer  codec,
+                                                     const gchar   *input,
+                                                     gsize          input_length,
+                                                     gchar         *output,
+                                                     gsize          output_size,
+                                                     gsize         *n_read,
+                                                     gsize         *n_written);
+
+
+G_END_DECLS
+
+#endif /* __SOURCEUNICODE_H__ */
@@ -0,0 +1,571 @@
+#include <string.h>
+#include <glib.h>
+#include "utf8scan.h"
+
+
+/*
+ * UTF-8 validation, ASCII and line break scanning kernels for the load
+ * path and the line index.
+ *
+ * The AVX2 validator is the lookup-table algorithm of Keiser & Lemire,
+ * "Validating UTF-8 In Less Than One Instruction Per Byte" (2021): every
+ * byte is classified from its own high nibble and the previous byte's
+ * nibbles, which catches every error in two-byte windows, and the
+ * remaining "must be a 3rd/4th byte" cases are checked with saturating
+ * subtractions. The SSE2 and plain C versions skip ASCII runs 16 resp.
+ * 8 bytes at a time and validate the rest a character at a time.
+ *
+ * Line breaks are found by comparing whole vectors (or 8-byte words)
+ * against '\n' and '\r' at once.
+ */
+
+#if defined (__GNUC__) && (defined (__x86_64__) || defined (__i386__))
+#  define HAVE_X86_SIMD 1
+#  include <immintrin.h>
+#endif
+
+
+typedef gboolean (*ScanFunc) (const guchar *p, const guchar *end);
+typedef const guchar *(*FindFunc) (const guchar *p, const guchar *end);
+
+typedef struct
+{
+  const gchar *name;
+  ScanFunc     validate;
+  ScanFunc     is_ascii;
+  FindFunc     find_line_break;
+} ScanImpl;
+
+
+/* returns the byte after the character at p or NULL if it's invalid,
+ * per table 3-7 of the Unicode standard */
+static inline const guchar *
+utf8_validate_char (const guchar *p, const guchar *end)
+{
+  guchar c = p[0], lo = 0x80, hi = 0xbf;
+
+  if (c < 0x80)
+    return p + 1;
+  else if (c < 0xc2)
+    return NULL;
+  else if (c < 0xe0)
+    {
+      if (end - p < 2 || (p[1] & 0xc0) != 0x80)
+        return NULL;
+      return p + 2;
+    }
+  else if (c < 0xf0)
+    {
+      if (end - p < 3)
+        return NULL;
+      if (c == 0xe0)
+        lo = 0xa0;
+      else if (c == 0xed)
+        hi = 0x9f;
+      if (p[1] < lo || p[1] > hi || (p[2] & 0xc0) != 0x80)
+        return NULL;
+      return p + 3;
+    }
+  else if (c < 0xf5)
+    {
+      if (end - p < 4)
+        return NULL;
+      if (c == 0xf0)
+        lo = 0x90;
+      else if (c == 0xf4)
+        hi = 0x8f;
+      if (p[1] < lo || p[1] > hi ||
+          (p[2] & 0xc0) != 0x80 ||
+          (p[3] & 0xc0) != 0x80)
+        return NULL;
+      return p + 4;
+    }
+
+  return NULL;
+}
+
+
+#define ASCII_MASK_64 G_GUINT64_CONSTANT (0x8080808080808080)
+
+
+static gboolean
+utf8_validate_scalar (const guchar *p, const guchar *end)
+{
+  guint64 w;
+
+  while (p < end)
+    {
+      while (end - p >= 8)
+        {
+          memcpy (&w, p, 8);
+          if (w & ASCII_MASK_64)
+            break;
+          p += 8;
+        }
+
+      while (p < end && *p < 0x80)
+        p++;
+
+      if (p == end)
+        break;
+
+      p = utf8_validate_char (p, end);
+      if (!p)
+        return FALSE;
+    }
+
+  return TRUE;
+}
+
+
+static gboolean
+is_ascii_scalar (const guchar *p, const guchar *end)
+{
+  guint64 w, acc = 0;
+
+  for (; end - p >= 8; p += 8)
+    {
+      memcpy (&w, p, 8);
+      acc |= w;
+    }
+
+  for (; p < end; p++)
+    acc |= *p;
+
+  return (acc & ASCII_MASK_64) == 0;
+}
+
+
+#define ONES_64 G_GUINT64_CONSTANT (0x0101010101010101)
+
+/* high bit set in every byte of w that equals c */
+static inline guint64
+word_has_byte (guint64 w, guchar c)
+{
+  guint64 x = w ^ (ONES_64 * c);
+
+  return (x - ONES_64) & ~x & ASCII_MASK_64;
+}
+
+
+static const guchar *
+find_line_break_scalar (const guchar *p, const guchar *end)
+{
+  guint64 w;
+
+  for (; end - p >= 8; p += 8)
+    {
+      memcpy (&w, p, 8);
+      if (word_has_byte (w, '\n') | word_has_byte (w, '\r'))
+        break;
+    }
+
+  for (; p < end; p++)
+    {
+      if (*p == '\n' || *p == '\r')
+        return p;
+    }
+
+  return end;
+}
+
+
+#ifdef HAVE_X86_SIMD
+
+#define SSE2_TARGET __attribute__ ((target ("sse2")))
+#define AVX2_TARGET __attribute__ ((target ("avx2")))
+
+
+SSE2_TARGET static gboolean
+utf8_validate_sse2 (const guchar *p, const guchar *end)
+{
+  gint mask;
+
+  while (p < end)
+    {
+      while (end - p >= 16)
+        {
+          mask = _mm_movemask_epi8 (_mm_loadu_si128 ((const __m128i *) p));
+          if (mask)
+            {
+              p += __builtin_ctz (mask);
+              break;
+            }
+          p += 16;
+        }
+
+      while (p < end && *p < 0x80)
+        p++;
+
+      if (p == end)
+        break;
+
+      p = utf8_validate_char (p, end);
+      if (!p)
+        return FALSE;
+    }
+
+  return TRUE;
+}
+
+
+SSE2_TARGET static gboolean
+is_ascii_sse2 (const guchar *p, const guchar *end)
+{
+  __m128i acc = _mm_setzero_si128 ();
+
+  for (; end - p >= 64; p += 64)
+    {
+      acc = _mm_or_si128 (acc, _mm_loadu_si128 ((const __m128i *) p));
+      acc = _mm_or_si128 (acc, _mm_loadu_si128 ((const __m128i *) (p + 16)));
+      acc = _mm_or_si128 (acc, _mm_loadu_si128 ((const __m128i *) (p + 32)));
+      acc = _mm_or_si128 (acc, _mm_loadu_si128 ((const __m128i *) (p + 48)));
+    }
+
+  if (_mm_movemask_epi8 (acc))
+    return FALSE;
+
+  return is_ascii_scalar (p, end);
+}
+
+
+SSE2_TARGET static const guchar *
+find_line_break_sse2 (const guchar *p, const guchar *end)
+{
+  const __m128i lf = _mm_set1_epi8 ('\n');
+  const __m128i cr = _mm_set1_epi8 ('\r');
+  __m128i       input;
+  gint          mask;
+
+  for (; end - p >= 16; p += 16)
+    {
+      input = _mm_loadu_si128 ((const __m128i *) p);
+      mask = _mm_movemask_epi8 (_mm_or_si128 (_mm_cmpeq_epi8 (input, lf),
+                                              _mm_cmpeq_epi8 (input, cr)));
+      if (mask)
+        return p + __builtin_ctz (mask);
+    }
+
+  return find_line_break_scalar (p, end);
+}
+
+
+/* error classes, one bit each, see Keiser & Lemire table 8 */
+#define TOO_SHORT      (1 << 0)  /* 11______ 0_______ or 11______ 11______ */
+#define TOO_LONG       (1 << 1)  /* 0_______ 10______ */
+#define OVERLONG_3     (1 << 2)  /* 11100000 100_____ */
+#define TOO_LARGE      (1 << 3)  /* 11110100 1001____ and above */
+#define SURROGATE      (1 << 4)  /* 11101101 101_____ */
+#define OVERLONG_2     (1 << 5)  /* 1100000_ 10______ */
+#define TOO_LARGE_1000 (1 << 6)  /* 11110101 1000____ and above */
+#define OVERLONG_4     (1 << 6)  /* 11110000 1000____ */
+#define TWO_CONTS      (1 << 7)  /* 10______ 10______ */
+#define CARRY          (TOO_SHORT | TOO_LONG | TWO_CONTS)
+
+#define AVX2_TABLE(a,b,c,d,e,f,g,h,i,j,k,l,m,n,o,p) \
+  _mm256_setr_epi8 ((char) (a), (char) (b), (char) (c), (char) (d), \
+                    (char) (e), (char) (f), (char) (g), (char) (h), \
+                    (char) (i), (char) (j), (char) (k), (char) (l), \
+                    (char) (m), (char) (n), (char) (o), (char) (p), \
+                    (char) (a), (char) (b), (char) (c), (char) (d), \
+                    (char) (e), (char) (f), (char) (g), (char) (h), \
+                    (char) (i), (char) (j), (char) (k), (char) (l), \
+                    (char) (m), (char) (n), (char) (o), (char) (p))
+
+/* the last n bytes of prev followed by all but the last n of input */
+#define AVX2_PREV(input, prev, n) \
+  _mm256_alignr_epi8 ((input), _mm256_permute2x128_si256 ((prev), (input), 0x21), 16 - (n))
+
+
+AVX2_TARGET static inline __m256i
+avx2_check_block (__m256i input, __m256i prev_input)
+{
+  const __m256i nibble = _mm256_set1_epi8 (0x0f);
+  __m256i prev1, prev2, prev3;
+  __m256i byte_1_high, byte_1_low, byte_2_high, special;
+  __m256i third, fourth, must23_80;
+
+  prev1 = AVX2_PREV (input, prev_input, 1);
+
+  byte_1_high = _mm256_shuffle_epi8 (
+    AVX2_TABLE (TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+                TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG,
+                TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS,
+                TOO_SHORT | OVERLONG_2,
+                TOO_SHORT,
+                TOO_SHORT | OVERLONG_3 | SURROGATE,
+                TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4),
+    _mm256_and_si256 (_mm256_srli_epi16 (prev1, 4), nibble));
+
+  byte_1_low = _mm256_shuffle_epi8 (
+    AVX2_TABLE (CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4,
+                CARRY | OVERLONG_2,
+                CARRY,
+                CARRY,
+                CARRY | TOO_LARGE,
+                CARRY | TOO_LARGE | TOO_LARGE_1000,
+                CARRY | TOO_LARGE | TOO_LARGE_1000,
+                CARRY | TOO_LARGE | TOO_LARGE_1000,
+                CARRY | TOO_LARGE | TOO_LARGE_1000,
+                CARRY | TOO_LARGE | TOO_LARGE_1000,
+                CARRY | TOO_LARGE | TOO_LARGE_1000,
+                CARRY | TOO_LARGE | TOO_LARGE_1000,
+                CARRY | TOO_LARGE | TOO_LARGE_1000,
+                CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE,
+                CARRY | TOO_LARGE | TOO_LARGE_1000,
+                CARRY | TOO_LARGE | TOO_LARGE_1000),
+    _mm256_and_si256 (prev1, nibble));
+
+  byte_2_high = _mm256_shuffle_epi8 (
+    AVX2_TABLE (TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+                TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT,
+                TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4,
+                TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE,
+                TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+                TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE,
+                TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT),
+    _mm256_and_si256 (_mm256_srli_epi16 (input, 4), nibble));
+
+  special = _mm256_and_si256 (_mm256_and_si256 (byte_1_high, byte_1_low), byte_2_high);
+
+  /* only 111_____ two back or 1111____ three back end up >= 0x80 */
+  prev2 = AVX2_PREV (input, prev_input, 2);
+  prev3 = AVX2_PREV (input, prev_input, 3);
+  third = _mm256_subs_epu8 (prev2, _mm256_set1_epi8 ((char) (0xe0 - 0x80)));
+  fourth = _mm256_subs_epu8 (prev3, _mm256_set1_epi8 ((char) (0xf0 - 0x80)));
+  must23_80 = _mm256_and_si256 (_mm256_or_si256 (third, fourth),
+                                _mm256_set1_epi8 ((char) 0x80));
+
+  return _mm256_xor_si256 (must23_80, special);
+}
+
+
+/* non-zero where a sequence started in the last three bytes runs past
+ * the end of the block */
+AVX2_TARGET static inline __m256i
+avx2_incomplete (__m256i input)
+{
+  const __m256i max = _mm256_setr_epi8 (
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    (char) (0xf0 - 1), (char) (0xe0 - 1), (char) (0xc0 - 1));
+
+  return _mm256_subs_epu8 (input, max);
+}
+
+
+AVX2_TARGET static gboolean
+utf8_validate_avx2 (const guchar *p, const guchar *end)
+{
+  __m256i input, error, prev_input, prev_incomplete;
+  guchar  tail[32];
+
+  error = _mm256_setzero_si256 ();
+  prev_input = _mm256_setzero_si256 ();
+  prev_incomplete = _mm256_setzero_si256 ();
+
+  for (; end - p >= 32; p += 32)
+    {
+      input = _mm256_loadu_si256 ((const __m256i *) p);
+
+      if (_mm256_movemask_epi8 (input) == 0)
+        {
+          /* all ASCII, so nothing can have been continued into it */
+          error = _mm256_or_si256 (error, prev_incomplete);
+          prev_incomplete = _mm256_setzero_si256 ();
+        }
+      else
+        {
+          error = _mm256_or_si256 (error, avx2_check_block (input, prev_input));
+          prev_incomplete = avx2_incomplete (input);
+        }
+
+      prev_input = input;
+
+      if (!_mm256_testz_si256 (error, error))
+        return FALSE;
+    }
+
+  if (p < end)
+    {
+      /* pad with ASCII, which cuts off any unfinished sequence */
+      memset (tail, 0, sizeof (tail));
+      memcpy (tail, p, end - p);
+      input = _mm256_loadu_si256 ((const __m256i *) tail);
+      error = _mm256_or_si256 (error, avx2_check_block (input, prev_input));
+    }
+  else
+    error = _mm256_or_si256 (error, prev_incomplete);
+
+  return _mm256_testz_si256 (error, error);
+}
+
+
+AVX2_TARGET static gboolean
+is_ascii_avx2 (const guchar *p, const guchar *end)
+{
+  __m256i acc = _mm256_setzero_si256 ();
+
+  for (; end - p >= 128; p += 128)
+    {
+      acc = _mm256_or_si256 (acc, _mm256_loadu_si256 ((const __m256i *) p));
+      acc = _mm256_or_si256 (acc, _mm256_loadu_si256 ((const __m256i *) (p + 32)));
+      acc = _mm256_or_si256 (acc, _mm256_loadu_si256 ((const __m256i *) (p + 64)));
+      acc = _mm256_or_si256 (acc, _mm256_loadu_si256 ((const __m256i *) (p + 96)));
+    }
+
+  if (_mm256_movemask_epi8 (acc))
+    return FALSE;
+
+  return is_ascii_scalar (p, end);
+}
+
+AVX2_TARGET static const guchar *
+find_line_break_avx2 (const guchar *p, const guchar *end)
+{
+  const __m256i lf = _mm256_set1_epi8 ('\n');
+  const __m256i cr = _mm256_set1_epi8 ('\r');
+  __m256i       input;
+  guint         mask;
+
+  for (; end - p >= 32; p += 32)
+    {
+      input = _mm256_loadu_si256 ((const __m256i *) p);
+      mask = _mm256_movemask_epi8 (_mm256_or_si256 (_mm256_cmpeq_epi8 (input, lf),
+                                                    _mm256_cmpeq_epi8 (input, cr)));
+      if (mask)
+        return p + __builtin_ctz (mask);
+    }
+
+  return find_line_break_scalar (p, end);
+}
+
+#endif /* HAVE_X86_SIMD */
+
+
+static const ScanImpl scan_impls[] =
+{
+#ifdef HAVE_X86_SIMD
+  { "avx2", utf8_validate_avx2,   is_ascii_avx2,   find_line_break_avx2 },
+  { "sse2", utf8_validate_sse2,   is_ascii_sse2,   find_line_break_sse2 },
+#endif
+  { "none", utf8_validate_scalar, is_ascii_scalar, find_line_break_scalar }
+};
+
+
+static gboolean
+scan_impl_supported (const ScanImpl *impl)
+{
+#ifdef HAVE_X86_SIMD
+  __builtin_cpu_init ();
+  if (strcmp (impl->name, "avx2") == 0)
+    return __builtin_cpu_supports ("avx2");
+  if (strcmp (impl->name, "sse2") == 0)
+    return __builtin_cpu_supports ("sse2");
+#endif
+  return TRUE;
+}
+
+
+static const ScanImpl *
+scan_impl_get (void)
+{
+  static gsize impl = 0;
+
+  if (g_once_init_enter (&impl))
+    {
+      const ScanImpl *chosen = NULL;
+      const gchar    *forced;
+      guint           i;
+
+      forced = g_getenv ("SOURCE_FILE_SIMD");
+
+      for (i = 0; i < G_N_ELEMENTS (scan_impls) && !chosen; i++)
+        {
+          if (forced && strcmp (forced, scan_impls[i].name) != 0)
+            continue;
+          if (scan_impl_supported (&scan_impls[i]))
+            chosen = &scan_impls[i];
+        }
+
+      /* the plain C version is always last and always supported */
+      if (!chosen)
+        chosen = &scan_impls[G_N_ELEMENTS (scan_impls) - 1];
+
+      g_once_init_leave (&impl, (gsize) chosen);
+    }
+
+  return (const ScanImpl *) impl;
+}
+
+
+gboolean
+source_file_utf8_validate (const gchar *data, gsize length)
+{
+  const guchar *p = (const guchar *) data;
+
+  g_return_val_if_fail (data || !length, FALSE);
+
+  return scan_impl_get ()->validate (p, p + length);
+}
+
+
+gboolean
+source_file_is_ascii (const gchar *data, gsize length)
+{
+  const guchar *p = (const guchar *) data;
+
+  g_return_val_if_fail (data || !length, FALSE);
+
+  return scan_impl_get ()->is_ascii (p, p + length);
+}
+
+
+/* offset of the first '\n' or '\r' in data, or length if there's none */
+gsize
+source_file_find_line_break (const gchar *data, gsize length)
+{
+  const guchar *p = (const guchar *) data;
+
+  g_return_val_if_fail (data || !length, 0);
+
+  return scan_impl_get ()->find_line_break (p, p + length) - p;
+}
+
+
+/* number of bytes at the end of data that are the start of a character
+ * the rest of which is still to come, e.g. at the end of a read chunk */
+gsize
+source_file_utf8_incomplete_tail (const gchar *data, gsize length)
+{
+  const guchar *p = (const guchar *) data;
+  gsize         i, n;
+
+  for (i = 1; i <= MIN (length, 4); i++)
+    {
+      guchar c = p[length - i];
+
+      if ((c & 0xc0) == 0x80)
+        continue;
+
+      if (c >= 0xf0)
+        n = 4;
+      else if (c >= 0xe0)
+        n = 3;
+      else if (c >= 0xc0)
+        n = 2;
+      else
+        n = 1;
+
+      return n > i ? i : 0;
+    }
+
+  return 0;
+}
+
+
+const gchar *
+source_file_utf8_scan_impl (void)
+{
+  return scan_impl_get ()->name;
+}
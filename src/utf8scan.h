@@ -0,0 +1,26 @@
+#ifndef __SOURCEUTF8SCAN_H__
+#define __SOURCEUTF8SCAN_H__
+
+G_BEGIN_DECLS
+
+
+/*
+ * Unlike g_utf8_validate(), embedded nul characters are valid here, the
+ * same as when converting with iconv. The implementation (AVX2, SSE2 or
+ * plain C) is picked at runtime and can be forced for benchmarking with
+ * SOURCE_FILE_SIMD=avx2|sse2|none in the environment.
+ */
+gboolean     source_file_utf8_validate        (const gchar *data,
+                                               gsize        length);
+gboolean     source_file_is_ascii             (const gchar *data,
+                                               gsize        length);
+gsize        source_file_utf8_incomplete_tail (const gchar *data,
+                                               gsize        length);
+gsize        source_file_find_line_break      (const gchar *data,
+                                               gsize        length);
+const gchar *source_file_utf8_scan_impl       (void);
+
+
+G_END_DECLS
+
+#endif /* __SOURCEUTF8SCAN_H__ */
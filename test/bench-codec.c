@@ -0,0 +1,171 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <glib.h>
+#include <gio/gio.h>
+#include <codec.h>
+
+
+/*
+ * Compares the built-in converters against GCharsetConverter (iconv), both
+ * ways, over text that is mostly ASCII and text that is mostly not. Run
+ * with SOURCE_FILE_SIMD=none for the plain C version.
+ */
+
+
+#define BYTES_PER_RUN (64 * 1024 * 1024)
+#define TEXT_LENGTH   (1024 * 1024)
+
+
+/* keeps the results alive so the calls aren't optimized away */
+static volatile gsize sink = 0;
+
+
+/* one character in every `every' is taken from outside ASCII: the
+ * charset's upper half, or for UTF-16 and UTF-32 Cyrillic, CJK and the
+ * odd emoji */
+static gchar *
+make_text (const gchar *charset, guint every, gsize *length)
+{
+  GConverter *decoder;
+  GRand      *rand;
+  GString    *utf8;
+  gchar      *text;
+  gchar       out[4];
+  gsize       n_read, n_written;
+  gboolean    unicode;
+  guchar      c;
+
+  unicode = g_str_has_prefix (charset, "UTF-");
+  decoder = unicode ? NULL : source_file_codec_converter_new ("UTF-8", charset);
+  rand = g_rand_new_with_seed (1);
+  utf8 = g_string_sized_new (TEXT_LENGTH);
+
+  while (utf8->len < TEXT_LENGTH)
+    {
+      if (g_rand_int_range (rand, 0, every) != 0)
+        g_string_append_c (utf8, g_rand_int_range (rand, 0, 40) ?
+                                 g_rand_int_range (rand, 0x20, 0x7f) : '\n');
+      else if (unicode)
+        {
+          switch (g_rand_int_range (rand, 0, 10))
+            {
+            case 0:
+              g_string_append_unichar (utf8, g_rand_int_range (rand, 0x1f600, 0x1f650));
+              break;
+            case 1: case 2: case 3:
+              g_string_append_unichar (utf8, g_rand_int_range (rand, 0x4e00, 0xa000));
+              break;
+            default:
+              g_string_append_unichar (utf8, g_rand_int_range (rand, 0x410, 0x450));
+            }
+        }
+      else
+        {
+          /* only bytes the charset has */
+          do
+            c = g_rand_int_range (rand, 0xa0, 0x100);
+          while (g_converter_convert (decoder, &c, 1, out, sizeof (out),
+                                      G_CONVERTER_NO_FLAGS, &n_read, &n_written,
+                                      NULL) == G_CONVERTER_ERROR);
+          g_string_append_len (utf8, out, n_written);
+        }
+    }
+
+  text = g_convert (utf8->str, utf8->len, charset, "UTF-8", NULL, length, NULL);
+
+  g_rand_free (rand);
+  g_string_free (utf8, TRUE);
+  if (decoder)
+    g_object_unref (decoder);
+
+  return text;
+}
+
+
+static gdouble
+measure (GConverter *converter, const gchar *text, gsize length)
+{
+  gchar  *outbuf;
+  gsize   i, runs, n_read, n_written, done;
+  gint64  start, elapsed;
+
+  runs = MAX (1, BYTES_PER_RUN / length);
+  outbuf = g_malloc (4 * length + 16);
+
+  start = g_get_monotonic_time ();
+  for (i = 0; i < runs; i++)
+    {
+      g_converter_reset (converter);
+      for (done = 0; done < length; done += n_read)
+        {
+          if (g_converter_convert (converter, text + done, length - done,
+                                   outbuf, 4 * length + 16, G_CONVERTER_INPUT_AT_END,
+                                   &n_read, &n_written, NULL) == G_CONVERTER_ERROR)
+            {
+              fprintf (stderr, "conversion failed\n");
+              exit (1);
+            }
+          sink += n_written;
+        }
+    }
+  elapsed = MAX (1, g_get_monotonic_time () - start);
+
+  g_free (outbuf);
+
+  return (gdouble) (runs * length) / elapsed;   /* bytes/us == MB/s */
+}
+
+
+static gchar *
+convert (const gchar *text, gsize length, const gchar *to, const gchar *from, gsize *converted)
+{
+  return g_convert (text, length, to, from, NULL, converted, NULL);
+}
+
+
+int
+main (int argc, char *argv[])
+{
+  static const gchar *charsets[] = { "ISO-8859-1", "windows-1252", "KOI8-R",
+                                     "UTF-16LE", "UTF-16BE", "UTF-32LE" };
+  static const guint  every[] = { 50, 2 };
+  guint i, j;
+
+  printf ("%-14s %6s %14s %14s %14s %14s\n",
+          "charset", "upper", "iconv decode", "decode", "iconv encode", "encode");
+
+  for (i = 0; i < G_N_ELEMENTS (charsets); i++)
+    {
+      for (j = 0; j < G_N_ELEMENTS (every); j++)
+        {
+          GConverter *decoder, *encoder, *iconv_decoder, *iconv_encoder;
+          gchar      *text, *utf8;
+          gsize       length, utf8_length;
+
+          text = make_text (charsets[i], every[j], &length);
+          utf8 = convert (text, length, "UTF-8", charsets[i], &utf8_length);
+
+          decoder = source_file_codec_converter_new ("UTF-8", charsets[i]);
+          encoder = source_file_codec_converter_new (charsets[i], "UTF-8");
+          iconv_decoder = G_CONVERTER (g_charset_converter_new ("UTF-8", charsets[i], NULL));
+          iconv_encoder = G_CONVERTER (g_charset_converter_new (charsets[i], "UTF-8", NULL));
+
+          printf ("%-14s %5u%% %9.0f MB/s %9.0f MB/s %9.0f MB/s %9.0f MB/s\n",
+                  charsets[i], 100 / every[j],
+                  measure (iconv_decoder, text, length),
+                  measure (decoder, text, length),
+                  measure (iconv_encoder, utf8, utf8_length),
+                  measure (encoder, utf8, utf8_length));
+
+          g_object_unref (decoder);
+          g_object_unref (encoder);
+          g_object_unref (iconv_decoder);
+          g_object_unref (iconv_encoder);
+          g_free (utf8);
+          g_free (text);
+        }
+    }
+
+  return 0;
+}
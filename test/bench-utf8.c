@@ -0,0 +1,116 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <glib.h>
+#include <utf8scan.h>
+
+
+/*
+ * Compares source_file_utf8_validate()/source_file_is_ascii() against
+ * g_utf8_validate() over typical source file sizes. Run with
+ * SOURCE_FILE_SIMD=avx2|sse2|none to compare the implementations.
+ */
+
+
+#define BYTES_PER_RUN (64 * 1024 * 1024)
+
+
+/* keeps the results alive so the calls aren't optimized away */
+static volatile guint sink = 0;
+
+
+static const gsize sizes[] = { 1024, 4096, 65536, 1024 * 1024, 16 * 1024 * 1024 };
+
+
+/* roughly what a source file in the given script looks like */
+static gchar *
+make_text (const gchar *kind, gsize length)
+{
+  static const gchar *ascii[] = { "int", " ", "x", " = ", "foo", "(", "bar", ");", "\n", "  " };
+  static const gchar *latin[] = { "caf\xc3\xa9", " ", "na\xc3\xafve", "\n", "x = 1;", " /* ", "\xc3\xbc", " */" };
+  static const gchar *cjk[]   = { "\xe6\x96\x87", "\xe5\xad\x97", "\xe5\x88\x97", "\xe3\x80\x82", "\n", " ", "\xf0\x9f\x98\x80" };
+  const gchar **pieces;
+  guint         n_pieces;
+  GString      *text;
+  GRand        *rand;
+
+  if (strcmp (kind, "ascii") == 0)
+    pieces = ascii, n_pieces = G_N_ELEMENTS (ascii);
+  else if (strcmp (kind, "latin") == 0)
+    pieces = latin, n_pieces = G_N_ELEMENTS (latin);
+  else
+    pieces = cjk, n_pieces = G_N_ELEMENTS (cjk);
+
+  rand = g_rand_new_with_seed (1);
+  text = g_string_sized_new (length + 8);
+
+  while (text->len < length)
+    g_string_append (text, pieces[g_rand_int_range (rand, 0, n_pieces)]);
+
+  /* cut back to a character boundary */
+  while (text->len > length || ((guchar) text->str[text->len - 1] & 0xc0) == 0x80 ||
+         ((guchar) text->str[text->len - 1] >= 0xc0))
+    g_string_truncate (text, text->len - 1);
+
+  g_rand_free (rand);
+
+  return g_string_free (text, FALSE);
+}
+
+
+static gdouble
+measure (gboolean (*func) (const gchar *, gsize), const gchar *text, gsize length)
+{
+  gint64 start, elapsed;
+  gsize  i, runs;
+
+  runs = MAX (1, BYTES_PER_RUN / length);
+
+  start = g_get_monotonic_time ();
+  for (i = 0; i < runs; i++)
+    sink += func (text, length);
+  elapsed = MAX (1, g_get_monotonic_time () - start);
+
+  return (gdouble) (runs * length) / elapsed;   /* bytes/us == MB/s */
+}
+
+
+static gboolean
+glib_validate (const gchar *text, gsize length)
+{
+  return g_utf8_validate (text, length, NULL);
+}
+
+
+int
+main (int argc, char *argv[])
+{
+  static const gchar *kinds[] = { "ascii", "latin", "cjk" };
+  guint i, j;
+
+  printf ("implementation: %s\n", source_file_utf8_scan_impl ());
+  printf ("%-6s %10s %16s %16s %16s\n",
+          "text", "size", "g_utf8_validate", "utf8_validate", "is_ascii");
+
+  for (i = 0; i < G_N_ELEMENTS (kinds); i++)
+    {
+      for (j = 0; j < G_N_ELEMENTS (sizes); j++)
+        {
+          gchar *text;
+          gsize  length;
+
+          text = make_text (kinds[i], sizes[j]);
+          length = strlen (text);
+
+          printf ("%-6s %10" G_GSIZE_FORMAT " %11.0f MB/s %11.0f MB/s %11.0f MB/s\n",
+                  kinds[i], length,
+                  measure (glib_validate, text, length),
+                  measure (source_file_utf8_validate, text, length),
+                  measure (source_file_is_ascii, text, length));
+
+          g_free (text);
+        }
+    }
+
+  return 0;
+}
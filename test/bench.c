@@ -0,0 +1,869 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <glib.h>
+#include <glib/gstdio.h>
+#include <sourcefile.h>
+#include <sourcefile-private.h>
+#include <charsets.h>
+#include <utf8scan.h>
+
+
+/*
+ * Headless benchmark. Generates a reproducible corpus (every charset in
+ * data/charsets.conf that iconv supports, at several sizes, with and
+ * without a byte order mark and a coding modeline), times each stage of
+ * opening and saving a file separately and writes the results as JSON:
+ *
+ *   ./bench [--corpus DIR] [--output FILE] > results.json
+ *
+ * Each case is repeated for at least --min-time milliseconds and
+ * --min-runs runs. Throughput is in MB/s (10^6 bytes), latencies in
+ * microseconds.
+ */
+
+
+#define BENCH_SEED       0x5eed
+#define BENCH_SMALL_SIZE 4096
+#define BENCH_MAX_RUNS   10000
+
+
+typedef struct
+{
+  gchar   *charset;    /* as named in charsets.conf */
+  gchar   *encoding;   /* the name iconv knows it by */
+  gchar   *path;
+  gsize    size;       /* requested, the file is within a line of it */
+  gsize    length;     /* actual */
+  gboolean bom;
+  gboolean modeline;
+} CorpusFile;
+
+
+typedef struct
+{
+  const gchar *operation;
+  CorpusFile  *file;       /* NULL for lookup_charset */
+  gsize        bytes;      /* per run */
+  GArray      *samples;    /* gdouble, microseconds */
+  gchar       *detected;
+} Result;
+
+
+typedef gboolean (*BenchFunc) (CorpusFile *file, gpointer data);
+
+
+static gchar   *opt_corpus = NULL;
+static gchar   *opt_output = NULL;
+static gchar   *opt_charsets = "../data/charsets.conf";
+static gchar   *opt_sizes = "4096,262144,4194304";
+static gint     opt_min_time = 50;
+static gint     opt_min_runs = 5;
+static gboolean opt_keep = FALSE;
+
+static GOptionEntry entries[] =
+{
+  { "corpus", 'c', 0, G_OPTION_ARG_FILENAME, &opt_corpus, "Write the corpus to DIR and keep it", "DIR" },
+  { "output", 'o', 0, G_OPTION_ARG_FILENAME, &opt_output, "Write the JSON to FILE instead of stdout", "FILE" },
+  { "charsets", 0, 0, G_OPTION_ARG_FILENAME, &opt_charsets, "The charsets to cover", "FILE" },
+  { "sizes", 's', 0, G_OPTION_ARG_STRING, &opt_sizes, "File sizes for the common charsets", "N,N,..." },
+  { "min-time", 't', 0, G_OPTION_ARG_INT, &opt_min_time, "Least milliseconds per case", "MS" },
+  { "min-runs", 'r', 0, G_OPTION_ARG_INT, &opt_min_runs, "Least runs per case", "N" },
+  { "keep", 'k', 0, G_OPTION_ARG_NONE, &opt_keep, "Don't delete the generated corpus", NULL },
+  { NULL }
+};
+
+
+/* benchmarked at every size, the rest only at BENCH_SMALL_SIZE */
+static const gchar *common_charsets[] =
+{
+  "UTF-8", "ISO-8859-1", "windows-1252", "ISO-8859-5", "KOI8-R",
+  "Shift_JIS", "EUC-JP", "GB18030", "Big5", "EUC-KR", "UTF-16LE", NULL
+};
+
+/* and these with a byte order mark as well */
+static const struct
+{
+  const gchar *charset;
+  const gchar *bom;
+  gsize        bom_length;
+} bom_charsets[] =
+{
+  { "UTF-8",    "\xef\xbb\xbf",     3 },
+  { "UTF-16LE", "\xff\xfe",         2 },
+  { "UTF-16BE", "\xfe\xff",         2 },
+  { "UTF-32LE", "\xff\xfe\x00\x00", 4 },
+  { "UTF-32BE", "\x00\x00\xfe\xff", 4 },
+};
+
+/* text in various scripts, a charset gets whichever of these it can encode */
+static const gchar *words[] =
+{
+  "caf\xc3\xa9", "na\xc3\xafve", "\xc3\xbc" "ber", "\xc3\xa5r", "se\xc3\xb1or",
+  "\xc5\x82\xc3\xb3" "d\xc5\xba", "\xc4\x8d" "esk\xc3\xbd",
+  "\xd0\xbf\xd1\x80\xd0\xb8\xd0\xb2\xd0\xb5\xd1\x82", "\xd0\xbc\xd0\xb8\xd1\x80",
+  "\xce\xba\xce\xb1\xce\xbb\xce\xb7\xce\xbc\xce\xad\xcf\x81\xce\xb1",
+  "\xd9\x85\xd8\xb1\xd8\xad\xd8\xa8\xd8\xa7", "\xd7\xa9\xd7\x9c\xd7\x95\xd7\x9d",
+  "\xe0\xb8\xaa\xe0\xb8\xa7\xe0\xb8\xb1\xe0\xb8\xaa\xe0\xb8\x94\xe0\xb8\xb5",
+  "\xe3\x81\x93\xe3\x82\x93\xe3\x81\xab\xe3\x81\xa1\xe3\x81\xaf", "\xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e",
+  "\xe4\xbd\xa0\xe5\xa5\xbd", "\xe4\xb8\xad\xe6\x96\x87",
+  "\xec\x95\x88\xeb\x85\x95\xed\x95\x98\xec\x84\xb8\xec\x9a\x94",
+};
+
+static const gchar *code[] =
+{
+  "int", "return", "foo", "bar_baz", "x", "(", ")", "{", "}", " = ", ";", "if", "0", "42",
+};
+
+
+static volatile gsize sink = 0;
+
+
+static gchar *
+json_string (const gchar *str)
+{
+  GString *out = g_string_new ("\"");
+
+  for (; str && *str; str++)
+    {
+      if (*str == '"' || *str == '\\')
+        g_string_append_printf (out, "\\%c", *str);
+      else if ((guchar) *str < 0x20)
+        g_string_append_printf (out, "\\u%04x", (guchar) *str);
+      else
+        g_string_append_c (out, *str);
+    }
+
+  g_string_append_c (out, '"');
+
+  return g_string_free (out, FALSE);
+}
+
+
+static gchar *
+encode (const gchar *text, const gchar *encoding, gsize *length)
+{
+  return g_convert (text, -1, encoding, "UTF-8", NULL, length, NULL);
+}
+
+
+/* the first of the charset's names iconv accepts */
+static gchar *
+find_encoding (GKeyFile *conf, const gchar *charset)
+{
+  gchar  *mime_name, **aliases, *found = NULL;
+  GIConv  cd;
+  gsize   i;
+
+  mime_name = g_key_file_get_string (conf, charset, "mime_name", NULL);
+  aliases = g_key_file_get_string_list (conf, charset, "aliases", NULL, NULL);
+
+  for (i = 0; !found; i++)
+    {
+      const gchar *name;
+
+      if (i == 0)
+        name = charset;
+      else if (i == 1)
+        name = mime_name;
+      else if (aliases && aliases[i - 2])
+        name = aliases[i - 2];
+      else
+        break;
+
+      if (!name || !*name)
+        continue;
+
+      cd = g_iconv_open (name, "UTF-8");
+      if (cd != (GIConv) -1)
+        {
+          g_iconv_close (cd);
+          found = g_strdup (name);
+        }
+    }
+
+  g_free (mime_name);
+  g_strfreev (aliases);
+
+  return found;
+}
+
+
+/*
+ * Something that looks like C, with comments and strings in whatever
+ * scripts the encoding covers, one line at a time until it's size bytes.
+ */
+static gboolean
+write_corpus_file (CorpusFile *file, const gchar *bom, gsize bom_length)
+{
+  GPtrArray *usable;
+  GString   *data, *line;
+  GRand     *rand;
+  gchar     *encoded;
+  gsize      length, i;
+  gboolean   ok;
+
+  usable = g_ptr_array_new ();
+  for (i = 0; i < G_N_ELEMENTS (words); i++)
+    {
+      encoded = encode (words[i], file->encoding, &length);
+      if (encoded)
+        g_ptr_array_add (usable, (gpointer) words[i]);
+      g_free (encoded);
+    }
+
+  rand = g_rand_new_with_seed (BENCH_SEED ^ g_str_hash (file->path));
+  data = g_string_new (NULL);
+  line = g_string_new (NULL);
+
+  g_string_append_len (data, bom, bom_length);
+
+  if (file->modeline)
+    g_string_printf (line, "/* -*- coding: %s -*- */\n", file->charset);
+
+  while (data->len < file->size)
+    {
+      if (!line->len)
+        {
+          gint n = g_rand_int_range (rand, 2, 12);
+
+          g_string_append (line, "  ");
+          while (n--)
+            g_string_append (line, code[g_rand_int_range (rand, 0, G_N_ELEMENTS (code))]);
+
+          if (usable->len && g_rand_boolean (rand))
+            {
+              g_string_append (line, " /* ");
+              n = g_rand_int_range (rand, 1, 6);
+              while (n--)
+                {
+                  g_string_append (line, g_ptr_array_index (usable, g_rand_int_range (rand, 0, usable->len)));
+                  g_string_append_c (line, ' ');
+                }
+              g_string_append (line, "*/");
+            }
+          g_string_append_c (line, '\n');
+        }
+
+      encoded = encode (line->str, file->encoding, &length);
+      if (!encoded)
+        break;
+      g_string_append_len (data, encoded, length);
+      g_string_truncate (line, 0);
+      g_free (encoded);
+    }
+
+  file->length = data->len;
+  ok = data->len >= file->size &&
+       g_file_set_contents (file->path, data->str, data->len, NULL);
+
+  g_string_free (line, TRUE);
+  g_string_free (data, TRUE);
+  g_ptr_array_free (usable, TRUE);
+  g_rand_free (rand);
+
+  return ok;
+}
+
+
+static CorpusFile *
+add_corpus_file (GPtrArray   *corpus,
+                 const gchar *dir,
+                 const gchar *charset,
+                 const gchar *encoding,
+                 gsize        size,
+                 const gchar *bom,
+                 gsize        bom_length,
+                 gboolean     modeline)
+{
+  CorpusFile *file;
+  gchar      *name, *p;
+
+  name = g_strdup_printf ("%s-%" G_GSIZE_FORMAT "%s%s.txt", charset, size,
+                          bom ? "-bom" : "", modeline ? "-modeline" : "");
+  for (p = name; *p; p++)
+    if (!g_ascii_isalnum (*p) && *p != '-' && *p != '.')
+      *p = '_';
+
+  file = g_new0 (CorpusFile, 1);
+  file->charset = g_strdup (charset);
+  file->encoding = g_strdup (encoding);
+  file->path = g_build_filename (dir, name, NULL);
+  file->size = size;
+  file->bom = bom != NULL;
+  file->modeline = modeline;
+  g_free (name);
+
+  if (!write_corpus_file (file, bom, bom_length))
+    {
+      g_free (file->charset);
+      g_free (file->encoding);
+      g_free (file->path);
+      g_free (file);
+      return NULL;
+    }
+
+  g_ptr_array_add (corpus, file);
+
+  return file;
+}
+
+
+static gboolean
+is_common (const gchar *charset_name)
+{
+  const SourceFileCharset *charset = source_file_lookup_charset (charset_name);
+  guint                    i;
+
+  for (i = 0; charset && common_charsets[i]; i++)
+    if (source_file_charset_equals (charset, common_charsets[i]))
+      return TRUE;
+
+  return FALSE;
+}
+
+
+static GPtrArray *
+make_corpus (GKeyFile *conf, const gchar *dir, const gsize *sizes, GString *skipped)
+{
+  GPtrArray *corpus;
+  gchar    **charsets, *encoding, *quoted;
+  gsize      i, j, n;
+  gint       modeline;
+
+  corpus = g_ptr_array_new ();
+  charsets = g_key_file_get_groups (conf, &n);
+
+  for (i = 0; i < n; i++)
+    {
+      gboolean common = is_common (charsets[i]);
+
+      encoding = find_encoding (conf, charsets[i]);
+      if (!encoding)
+        {
+          quoted = json_string (charsets[i]);
+          g_string_append_printf (skipped, "%s    { \"charset\": %s, \"reason\": \"not supported by iconv\" }",
+                                  skipped->len ? ",\n" : "", quoted);
+          g_free (quoted);
+          continue;
+        }
+
+      for (modeline = 0; modeline < 2; modeline++)
+        {
+          if (!add_corpus_file (corpus, dir, charsets[i], encoding,
+                                BENCH_SMALL_SIZE, NULL, 0, modeline))
+            {
+              quoted = json_string (charsets[i]);
+              g_string_append_printf (skipped, "%s    { \"charset\": %s, \"reason\": \"can't encode the sample text\" }",
+                                      skipped->len ? ",\n" : "", quoted);
+              g_free (quoted);
+              break;
+            }
+
+          for (j = 0; common && sizes[j]; j++)
+            if (sizes[j] != BENCH_SMALL_SIZE)
+              add_corpus_file (corpus, dir, charsets[i], encoding, sizes[j], NULL, 0, modeline);
+        }
+
+      g_free (encoding);
+    }
+
+  for (i = 0; i < G_N_ELEMENTS (bom_charsets); i++)
+    for (j = 0; sizes[j]; j++)
+      add_corpus_file (corpus, dir, bom_charsets[i].charset, bom_charsets[i].charset,
+                       sizes[j], bom_charsets[i].bom, bom_charsets[i].bom_length, FALSE);
+
+  g_strfreev (charsets);
+
+  return corpus;
+}
+
+
+static gint
+compare_doubles (gconstpointer a, gconstpointer b)
+{
+  gdouble x = *(const gdouble *) a, y = *(const gdouble *) b;
+
+  return x < y ? -1 : x > y;
+}
+
+
+/* nearest rank, samples must be sorted */
+static gdouble
+percentile (GArray *samples, gdouble p)
+{
+  guint rank;
+
+  if (!samples->len)
+    return 0;
+
+  rank = (guint) (p * samples->len + 0.999999);
+  rank = CLAMP (rank, 1, samples->len);
+
+  return g_array_index (samples, gdouble, rank - 1);
+}
+
+
+static gdouble
+total (GArray *samples)
+{
+  gdouble sum = 0;
+  guint   i;
+
+  for (i = 0; i < samples->len; i++)
+    sum += g_array_index (samples, gdouble, i);
+
+  return sum;
+}
+
+
+/* runs func until it has taken at least --min-time and --min-runs */
+static Result *
+run (const gchar *operation, CorpusFile *file, gsize bytes, BenchFunc func, gpointer data)
+{
+  Result *result;
+  gint64  start, elapsed = 0, begin;
+  gdouble sample;
+
+  result = g_new0 (Result, 1);
+  result->operation = operation;
+  result->file = file;
+  result->bytes = bytes;
+  result->samples = g_array_new (FALSE, FALSE, sizeof (gdouble));
+
+  /* one untimed run for the page cache and lazy initialization */
+  if (!func (file, data))
+    {
+      g_array_unref (result->samples);
+      g_free (result);
+      return NULL;
+    }
+
+  begin = g_get_monotonic_time ();
+  while ((elapsed < opt_min_time * 1000 || result->samples->len < (guint) opt_min_runs) &&
+         result->samples->len < BENCH_MAX_RUNS)
+    {
+      start = g_get_monotonic_time ();
+      func (file, data);
+      sample = g_get_monotonic_time () - start;
+      g_array_append_val (result->samples, sample);
+      elapsed = g_get_monotonic_time () - begin;
+    }
+
+  g_array_sort (result->samples, compare_doubles);
+
+  return result;
+}
+
+
+static gboolean
+bench_load (CorpusFile *file, gpointer data)
+{
+  SourceFile *sf;
+  gchar     **detected = data;
+
+  sf = source_file_new (file->path, NULL, NULL);
+  sink += source_file_get_length (sf);
+
+  if (detected && !*detected)
+    *detected = g_strdup (source_file_get_charset (sf));
+
+  g_object_unref (sf);
+
+  return TRUE;
+}
+
+
+typedef struct
+{
+  SourceFile *scratch;
+  gchar      *contents;
+  gsize       length;
+} GuessData;
+
+
+static gboolean
+bench_guess_charset (CorpusFile *file, gpointer data)
+{
+  GuessData *guess = data;
+
+  source_file_guess_charset (guess->scratch, guess->contents, guess->length);
+
+  return TRUE;
+}
+
+
+static gboolean
+bench_guess_mime_type (CorpusFile *file, gpointer data)
+{
+  GuessData *guess = data;
+
+  source_file_guess_mime_type (guess->scratch, guess->contents,
+                               MIN (guess->length, SOURCE_FILE_LOAD_CHUNK_SIZE));
+
+  return TRUE;
+}
+
+
+/* loading with the charset and MIME type given is reading and converting */
+static gboolean
+bench_convert (CorpusFile *file, gpointer data)
+{
+  SourceFile *sf;
+  gboolean    ok;
+
+  sf = source_file_new (NULL, NULL, NULL);
+  ok = source_file_open (sf, file->path, file->encoding, "text/plain");
+  sink += source_file_get_length (sf);
+  g_object_unref (sf);
+
+  return ok;
+}
+
+
+static gboolean
+bench_save (CorpusFile *file, gpointer data)
+{
+  SourceFile *sf = data;
+
+  return source_file_save (sf, NULL);
+}
+
+
+typedef struct
+{
+  gchar **names;
+  guint   n_names;
+} LookupData;
+
+
+static gboolean
+bench_lookup_charset (CorpusFile *file, gpointer data)
+{
+  LookupData *lookup = data;
+  guint       i;
+
+  for (i = 0; i < lookup->n_names; i++)
+    sink += source_file_lookup_charset (lookup->names[i]) != NULL;
+
+  return TRUE;
+}
+
+
+/* every name and alias in charsets.conf, plus as many that aren't charsets */
+static LookupData *
+make_lookup_data (GKeyFile *conf)
+{
+  LookupData *lookup;
+  GPtrArray  *names;
+  gchar     **charsets, **aliases;
+  gsize       i, j, n, n_known;
+
+  names = g_ptr_array_new ();
+  charsets = g_key_file_get_groups (conf, &n);
+
+  for (i = 0; i < n; i++)
+    {
+      g_ptr_array_add (names, g_strdup (charsets[i]));
+      aliases = g_key_file_get_string_list (conf, charsets[i], "aliases", NULL, NULL);
+      for (j = 0; aliases && aliases[j]; j++)
+        if (*aliases[j])
+          g_ptr_array_add (names, g_strdup (aliases[j]));
+      g_strfreev (aliases);
+    }
+
+  n_known = names->len;
+  for (i = 0; i < n_known; i++)
+    g_ptr_array_add (names, g_strdup_printf ("x-unknown-%s", (gchar *) g_ptr_array_index (names, i)));
+
+  g_strfreev (charsets);
+
+  lookup = g_new0 (LookupData, 1);
+  lookup->n_names = names->len;
+  g_ptr_array_add (names, NULL);
+  lookup->names = (gchar **) g_ptr_array_free (names, FALSE);
+
+  return lookup;
+}
+
+
+static void
+print_result (FILE *out, Result *result, gboolean first)
+{
+  gdouble  us = total (result->samples);
+  gchar   *charset, *encoding, *detected;
+
+  fprintf (out, "%s    { \"operation\": \"%s\"", first ? "" : ",\n", result->operation);
+
+  if (result->file)
+    {
+      charset = json_string (result->file->charset);
+      encoding = json_string (result->file->encoding);
+      fprintf (out, ", \"charset\": %s, \"encoding\": %s, \"size\": %" G_GSIZE_FORMAT
+               ", \"bom\": %s, \"modeline\": %s",
+               charset, encoding, result->file->length,
+               result->file->bom ? "true" : "false",
+               result->file->modeline ? "true" : "false");
+      g_free (charset);
+      g_free (encoding);
+    }
+
+  if (result->detected)
+    {
+      detected = json_string (result->detected);
+      fprintf (out, ", \"detected\": %s", detected);
+      g_free (detected);
+    }
+
+  fprintf (out, ", \"runs\": %u, \"mb_per_s\": %.2f, \"p50_us\": %.2f, \"p99_us\": %.2f }",
+           result->samples->len,
+           us > 0 ? (gdouble) result->bytes * result->samples->len / us : 0,
+           percentile (result->samples, 0.5),
+           percentile (result->samples, 0.99));
+}
+
+
+/* all files of one size per operation, as throughput over the total time */
+static void
+print_summary (FILE *out, GPtrArray *results, const gsize *sizes)
+{
+  static const gchar *operations[] =
+    { "load", "guess_charset", "guess_mime_type", "convert", "save" };
+  GArray  *samples;
+  gdouble  bytes, us;
+  gboolean first = TRUE;
+  guint    i, j, k, files;
+
+  samples = g_array_new (FALSE, FALSE, sizeof (gdouble));
+
+  for (i = 0; i < G_N_ELEMENTS (operations); i++)
+    for (j = 0; sizes[j]; j++)
+      {
+        g_array_set_size (samples, 0);
+        bytes = us = 0;
+        files = 0;
+
+        for (k = 0; k < results->len; k++)
+          {
+            Result *result = g_ptr_array_index (results, k);
+
+            if (!result->file || result->file->size != sizes[j] ||
+                strcmp (result->operation, operations[i]) != 0)
+              continue;
+
+            g_array_append_vals (samples, result->samples->data, result->samples->len);
+            bytes += (gdouble) result->bytes * result->samples->len;
+            us += total (result->samples);
+            files++;
+          }
+
+        if (!files)
+          continue;
+
+        g_array_sort (samples, compare_doubles);
+        fprintf (out, "%s    { \"operation\": \"%s\", \"size\": %" G_GSIZE_FORMAT
+                 ", \"files\": %u, \"mb_per_s\": %.2f, \"p50_us\": %.2f, \"p99_us\": %.2f }",
+                 first ? "" : ",\n", operations[i], sizes[j], files,
+                 us > 0 ? bytes / us : 0,
+                 percentile (samples, 0.5), percentile (samples, 0.99));
+        first = FALSE;
+      }
+
+  g_array_unref (samples);
+}
+
+
+static gsize *
+parse_sizes (const gchar *spec)
+{
+  gchar **parts;
+  gsize  *sizes;
+  guint   i, n = 0;
+
+  parts = g_strsplit (spec, ",", -1);
+  sizes = g_new0 (gsize, g_strv_length (parts) + 2);
+
+  /* the small size is always there, every charset is done at it */
+  sizes[n++] = BENCH_SMALL_SIZE;
+  for (i = 0; parts[i]; i++)
+    {
+      gsize size = g_ascii_strtoull (parts[i], NULL, 10);
+
+      if (size && size != BENCH_SMALL_SIZE)
+        sizes[n++] = size;
+    }
+
+  g_strfreev (parts);
+
+  return sizes;
+}
+
+
+int
+main (int argc, char *argv[])
+{
+  GOptionContext *context;
+  GError         *error = NULL;
+  GKeyFile       *conf;
+  GPtrArray      *corpus, *results;
+  GString        *skipped;
+  LookupData     *lookup;
+  Result         *result;
+  FILE           *out = stdout;
+  gchar          *dir, *save_path;
+  gsize          *sizes;
+  guint           i, j;
+
+  context = g_option_context_new ("- benchmark SourceFile");
+  g_option_context_add_main_entries (context, entries, NULL);
+  if (!g_option_context_parse (context, &argc, &argv, &error))
+    {
+      fprintf (stderr, "%s\n", error->message);
+      exit (EXIT_FAILURE);
+    }
+  g_option_context_free (context);
+
+  conf = g_key_file_new ();
+  if (!g_key_file_load_from_file (conf, opt_charsets, G_KEY_FILE_NONE, &error))
+    {
+      fprintf (stderr, "Failed to read '%s': %s\n", opt_charsets, error->message);
+      exit (EXIT_FAILURE);
+    }
+
+  if (opt_corpus)
+    {
+      dir = g_strdup (opt_corpus);
+      opt_keep = TRUE;
+      g_mkdir_with_parents (dir, 0755);
+    }
+  else if (!(dir = g_dir_make_tmp ("sourcefile-bench-XXXXXX", &error)))
+    {
+      fprintf (stderr, "%s\n", error->message);
+      exit (EXIT_FAILURE);
+    }
+
+  if (opt_output && !(out = fopen (opt_output, "w")))
+    {
+      fprintf (stderr, "Failed to open '%s'\n", opt_output);
+      exit (EXIT_FAILURE);
+    }
+
+  sizes = parse_sizes (opt_sizes);
+  skipped = g_string_new (NULL);
+
+  fprintf (stderr, "Generating corpus in %s\n", dir);
+  corpus = make_corpus (conf, dir, sizes, skipped);
+  results = g_ptr_array_new ();
+  save_path = g_build_filename (dir, "saved.out", NULL);
+
+  for (i = 0; i < corpus->len; i++)
+    {
+      CorpusFile *file = g_ptr_array_index (corpus, i);
+      GuessData   guess = { NULL, };
+      SourceFile *sf;
+      gchar      *detected = NULL;
+
+      fprintf (stderr, "\r[%u/%u] %-60s", i + 1, corpus->len, file->path + strlen (dir) + 1);
+
+      if ((result = run ("load", file, file->length, bench_load, &detected)))
+        {
+          result->detected = detected;
+          g_ptr_array_add (results, result);
+        }
+
+      guess.scratch = source_file_new (NULL, NULL, NULL);
+      source_file_set_filename (guess.scratch, file->path);
+      if (g_file_get_contents (file->path, &guess.contents, &guess.length, NULL))
+        {
+          if ((result = run ("guess_charset", file, file->length, bench_guess_charset, &guess)))
+            g_ptr_array_add (results, result);
+          if ((result = run ("guess_mime_type", file, MIN (file->length, SOURCE_FILE_LOAD_CHUNK_SIZE),
+                             bench_guess_mime_type, &guess)))
+            g_ptr_array_add (results, result);
+          g_free (guess.contents);
+        }
+      g_object_unref (guess.scratch);
+
+      if ((result = run ("convert", file, file->length, bench_convert, NULL)))
+        g_ptr_array_add (results, result);
+
+      sf = source_file_new (NULL, NULL, NULL);
+      if (source_file_open (sf, file->path, file->encoding, "text/plain"))
+        {
+          source_file_set_filename (sf, save_path);
+          if ((result = run ("save", file, file->length, bench_save, sf)))
+            g_ptr_array_add (results, result);
+        }
+      g_object_unref (sf);
+    }
+  fprintf (stderr, "\n");
+
+  lookup = make_lookup_data (conf);
+  result = run ("lookup_charset", NULL, 0, bench_lookup_charset, lookup);
+
+  fprintf (out, "{\n");
+  fprintf (out, "  \"benchmark\": \"sourcefile\",\n");
+  fprintf (out, "  \"version\": 1,\n");
+  fprintf (out, "  \"simd\": \"%s\",\n", source_file_utf8_scan_impl ());
+  fprintf (out, "  \"glib\": \"%u.%u.%u\",\n", glib_major_version, glib_minor_version, glib_micro_version);
+  fprintf (out, "  \"min_time_ms\": %d,\n", opt_min_time);
+  fprintf (out, "  \"min_runs\": %d,\n", opt_min_runs);
+  fprintf (out, "  \"lookup_charset\": { \"names\": %u, \"runs\": %u, \"p50_ns\": %.2f, \"p99_ns\": %.2f },\n",
+           lookup->n_names, result->samples->len,
+           percentile (result->samples, 0.5) * 1000 / lookup->n_names,
+           percentile (result->samples, 0.99) * 1000 / lookup->n_names);
+  fprintf (out, "  \"summary\": [\n");
+  print_summary (out, results, sizes);
+  fprintf (out, "\n  ],\n");
+  fprintf (out, "  \"results\": [\n");
+  for (i = 0; i < results->len; i++)
+    print_result (out, g_ptr_array_index (results, i), i == 0);
+  fprintf (out, "\n  ],\n");
+  fprintf (out, "  \"skipped\": [\n%s\n  ]\n", skipped->str);
+  fprintf (out, "}\n");
+
+  if (out != stdout)
+    fclose (out);
+
+  g_unlink (save_path);
+  g_free (save_path);
+
+  for (i = 0; i < corpus->len; i++)
+    {
+      CorpusFile *file = g_ptr_array_index (corpus, i);
+
+      if (!opt_keep)
+        g_unlink (file->path);
+      g_free (file->charset);
+      g_free (file->encoding);
+      g_free (file->path);
+      g_free (file);
+    }
+  if (!opt_keep)
+    g_rmdir (dir);
+
+  for (i = 0; i < results->len; i++)
+    {
+      Result *r = g_ptr_array_index (results, i);
+
+      g_array_unref (r->samples);
+      g_free (r->detected);
+      g_free (r);
+    }
+  g_array_unref (result->samples);
+  g_free (result);
+
+  for (j = 0; j < lookup->n_names; j++)
+    g_free (lookup->names[j]);
+  g_free (lookup->names);
+  g_free (lookup);
+
+  g_ptr_array_free (results, TRUE);
+  g_ptr_array_free (corpus, TRUE);
+  g_string_free (skipped, TRUE);
+  g_key_file_free (conf);
+  g_free (sizes);
+  g_free (dir);
+
+  return 0;
+}
@@ -0,0 +1,541 @@
+#include <errno.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <glib.h>
+#include <gio/gio.h>
+#include <sourcefile.h>
+#include <sourcefile-private.h>
+
+
+/*
+ * Detects the charset and MIME type of every file under the given paths
+ * and prints one JSON object per file:
+ *
+ *   sourcefile-detect [-j THREADS] [--head BYTES] [--no-magic] PATH...
+ *
+ *   {"path":"a/b.c","size":1234,"charset":"UTF-8","method":"utf8",
+ *    "confidence":0.99,"mime_type":"text/x-c","read_us":4,
+ *    "charset_us":2,"mime_type_us":310}
+ *
+ * or {"path":...,"error":"..."} for files that can't be read. Detection
+ * is the same as source_file_new()'s, but only ever on the first --head
+ * bytes and the last sniffing chunk of a file. Confidence follows from
+ * how the charset was found: a declaration or byte order mark is
+ * certain, a statistical guess less so, the fallback charset hardly.
+ *
+ * Directories are walked by the same threads that detect: each keeps
+ * its own queue of directories and files found, working from the newest
+ * end, and takes the oldest entries of another's queue when it runs out.
+ * Symbolic links found while walking are not followed. Output lines are
+ * collected per thread and written out whole, in no particular order.
+ */
+
+
+#define DETECT_OUTPUT_FLUSH 65536
+
+
+typedef struct
+{
+  gchar   *path;
+  gboolean is_dir;
+} Task;
+
+
+typedef struct
+{
+  GMutex      lock;
+  GQueue      tasks;
+  GThread    *thread;
+  guint       index;
+  SourceFile *scratch;
+  gchar      *head;
+  GString    *out;
+  guint64     n_files;
+  guint64     n_dirs;
+  guint64     n_errors;
+} Worker;
+
+
+static gint     opt_threads = 0;
+static gint     opt_head = SOURCE_FILE_SNIFF_MAX_BYTES;
+static gboolean opt_no_magic = FALSE;
+static gboolean opt_stats = FALSE;
+
+static GOptionEntry entries[] =
+{
+  { "threads", 'j', 0, G_OPTION_ARG_INT, &opt_threads, "Detection threads (default: one per CPU)", "N" },
+  { "head", 0, 0, G_OPTION_ARG_INT, &opt_head, "Bytes read from the start of each file", "BYTES" },
+  { "no-magic", 0, 0, G_OPTION_ARG_NONE, &opt_no_magic, "Guess MIME types with GIO only, much faster than libmagic", NULL },
+  { "stats", 0, 0, G_OPTION_ARG_NONE, &opt_stats, "Print totals to stderr when done", NULL },
+  { NULL }
+};
+
+
+static const struct
+{
+  const gchar *name;
+  gdouble      confidence;
+} methods[] =
+{
+  [SOURCE_FILE_GUESS_DECLARATION] = { "declaration", 1.0  },
+  [SOURCE_FILE_GUESS_BOM]         = { "bom",         1.0  },
+  [SOURCE_FILE_GUESS_ASCII]       = { "ascii",       0.9  },   /* only the head was looked at */
+  [SOURCE_FILE_GUESS_UTF8]        = { "utf8",        0.99 },
+  [SOURCE_FILE_GUESS_DETECTOR]    = { "detector",    0.6  },
+  [SOURCE_FILE_GUESS_LOCALE]      = { "locale",      0.3  },
+  [SOURCE_FILE_GUESS_FALLBACK]    = { "fallback",    0.1  },
+};
+
+
+static Worker  *workers = NULL;
+static guint    n_workers = 0;
+static gint     n_pending = 0;   /* tasks queued or being worked on */
+static gint     n_idle = 0;
+static GMutex   idle_lock;
+static GCond    idle_cond;
+static GMutex   output_lock;
+
+
+static void
+append_json_string (GString *out, const gchar *str)
+{
+  const gchar *p;
+  gchar       *valid = NULL;
+
+  /* file names needn't be UTF-8, JSON has to be */
+  if (!g_utf8_validate (str, -1, NULL))
+    str = valid = g_utf8_make_valid (str, -1);
+
+  g_string_append_c (out, '"');
+  for (p = str; *p; p++)
+    {
+      if (*p == '"' || *p == '\\')
+        {
+          g_string_append_c (out, '\\');
+          g_string_append_c (out, *p);
+        }
+      else if ((guchar) *p < 0x20)
+        g_string_append_printf (out, "\\u%04x", (guchar) *p);
+      else
+        g_string_append_c (out, *p);
+    }
+  g_string_append_c (out, '"');
+
+  g_free (valid);
+}
+
+
+static void
+flush_output (Worker *worker)
+{
+  if (!worker->out->len)
+    return;
+
+  g_mutex_lock (&output_lock);
+  fwrite (worker->out->str, 1, worker->out->len, stdout);
+  g_mutex_unlock (&output_lock);
+
+  g_string_truncate (worker->out, 0);
+}
+
+
+static void
+push_task (Worker *worker, gchar *path, gboolean is_dir)
+{
+  Task *task;
+
+  task = g_slice_new (Task);
+  task->path = path;
+  task->is_dir = is_dir;
+
+  g_atomic_int_inc (&n_pending);
+
+  g_mutex_lock (&worker->lock);
+  g_queue_push_tail (&worker->tasks, task);
+  g_mutex_unlock (&worker->lock);
+
+  if (g_atomic_int_get (&n_idle) > 0)
+    {
+      g_mutex_lock (&idle_lock);
+      g_cond_signal (&idle_cond);
+      g_mutex_unlock (&idle_lock);
+    }
+}
+
+
+/* the newest task of our own, or else the oldest of someone else's */
+static Task *
+take_task (Worker *worker)
+{
+  Task *task;
+  guint i;
+
+  g_mutex_lock (&worker->lock);
+  task = g_queue_pop_tail (&worker->tasks);
+  g_mutex_unlock (&worker->lock);
+
+  for (i = 1; !task && i < n_workers; i++)
+    {
+      Worker *victim = &workers[(worker->index + i) % n_workers];
+
+      g_mutex_lock (&victim->lock);
+      task = g_queue_pop_head (&victim->tasks);
+      g_mutex_unlock (&victim->lock);
+    }
+
+  return task;
+}
+
+
+static void
+finish_task (Task *task)
+{
+  g_free (task->path);
+  g_slice_free (Task, task);
+
+  if (g_atomic_int_dec_and_test (&n_pending))
+    {
+      g_mutex_lock (&idle_lock);
+      g_cond_broadcast (&idle_cond);
+      g_mutex_unlock (&idle_lock);
+    }
+}
+
+
+static void
+report_error (Worker *worker, const gchar *path, gint errsv)
+{
+  g_string_append (worker->out, "{\"path\":");
+  append_json_string (worker->out, path);
+  g_string_append (worker->out, ",\"error\":");
+  append_json_string (worker->out, g_strerror (errsv));
+  g_string_append (worker->out, "}\n");
+
+  worker->n_errors++;
+}
+
+
+static void
+walk_directory (Worker *worker, const gchar *path)
+{
+  struct dirent *entry;
+  struct stat    st;
+  DIR           *dir;
+  gchar         *child;
+  gboolean       is_dir;
+  gsize          len = strlen (path);
+
+  dir = opendir (path);
+  if (!dir)
+    {
+      report_error (worker, path, errno);
+      return;
+    }
+
+  worker->n_dirs++;
+
+  while ((entry = readdir (dir)))
+    {
+      if (entry->d_name[0] == '.' &&
+          (!entry->d_name[1] || (entry->d_name[1] == '.' && !entry->d_name[2])))
+        continue;
+
+      if (len && path[len - 1] == '/')
+        child = g_strconcat (path, entry->d_name, NULL);
+      else
+        child = g_strconcat (path, "/", entry->d_name, NULL);
+
+      if (entry->d_type == DT_DIR)
+        is_dir = TRUE;
+      else if (entry->d_type == DT_REG)
+        is_dir = FALSE;
+      else if (entry->d_type == DT_UNKNOWN && lstat (child, &st) == 0 &&
+               (S_ISDIR (st.st_mode) || S_ISREG (st.st_mode)))
+        is_dir = S_ISDIR (st.st_mode);
+      else
+        {
+          g_free (child);
+          continue;
+        }
+
+      push_task (worker, child, is_dir);
+    }
+
+  closedir (dir);
+}
+
+
+/* reads the head of the file and, like loading does, its last chunk */
+static gssize
+read_sniff_window (Worker *worker, const gchar *path, guint64 *size)
+{
+  struct stat st;
+  gsize       length = 0, tail;
+  gssize      n;
+  gint        fd;
+
+  fd = open (path, O_RDONLY | O_CLOEXEC);
+  if (fd < 0 || fstat (fd, &st) != 0)
+    goto error;
+
+  *size = st.st_size;
+
+  while (length < (gsize) opt_head)
+    {
+      n = read (fd, worker->head + length, opt_head - length);
+      if (n < 0 && errno == EINTR)
+        continue;
+      if (n < 0)
+        goto error;
+      if (n == 0)
+        break;
+      length += n;
+    }
+
+  /* the tail goes after a newline, so a modeline there starts a line */
+  if ((guint64) st.st_size > length)
+    {
+      tail = MIN ((guint64) SOURCE_FILE_SNIFF_CHUNK_SIZE, (guint64) st.st_size - length);
+      worker->head[length] = '\n';
+      n = pread (fd, worker->head + length + 1, tail, st.st_size - tail);
+      if (n > 0)
+        length += 1 + n;
+    }
+
+  close (fd);
+
+  return length;
+
+error:
+  n = errno;
+  if (fd >= 0)
+    close (fd);
+  errno = n;
+
+  return -1;
+}
+
+
+/* interned, like source_file_guess_mime_type()'s */
+static const gchar *
+guess_mime_type_gio (const gchar *path, const gchar *data, gsize length)
+{
+  const gchar *mime_type = NULL;
+  gchar       *content_type, *type;
+  gboolean     uncertain;
+
+  content_type = g_content_type_guess (path, (const guchar *) data, length, &uncertain);
+  if (!uncertain)
+    {
+      type = g_content_type_get_mime_type (content_type);
+      mime_type = g_intern_string (type);
+      g_free (type);
+    }
+  g_free (content_type);
+
+  return mime_type;
+}
+
+
+static void
+detect_file (Worker *worker, const gchar *path)
+{
+  SourceFileGuessMethod method = SOURCE_FILE_GUESS_FALLBACK;
+  const gchar          *charset = NULL, *mime_type = NULL;
+  gint64                start, read_us, charset_us = 0, mime_type_us = 0;
+  guint64               size = 0;
+  gssize                length;
+  gsize                 head_length;
+
+  start = g_get_monotonic_time ();
+  length = read_sniff_window (worker, path, &size);
+  read_us = g_get_monotonic_time () - start;
+
+  if (length < 0)
+    {
+      report_error (worker, path, errno);
+      return;
+    }
+
+  head_length = MIN ((guint64) length, MIN (size, (guint64) opt_head));
+
+  if (length > 0)
+    {
+      source_file_set_sniff_filename (worker->scratch, path);
+
+      start = g_get_monotonic_time ();
+      charset = source_file_guess_charset_full (worker->scratch, worker->head, length, &method);
+      charset_us = g_get_monotonic_time () - start;
+
+      start = g_get_monotonic_time ();
+      if (opt_no_magic)
+        mime_type = guess_mime_type_gio (path, worker->head, head_length);
+      else
+        mime_type = source_file_guess_mime_type (worker->scratch, worker->head, head_length);
+      mime_type_us = g_get_monotonic_time () - start;
+    }
+
+  g_string_append (worker->out, "{\"path\":");
+  append_json_string (worker->out, path);
+  g_string_append_printf (worker->out, ",\"size\":%" G_GUINT64_FORMAT, size);
+
+  if (charset)
+    {
+      g_string_append (worker->out, ",\"charset\":");
+      append_json_string (worker->out, charset);
+      g_string_append_printf (worker->out, ",\"method\":\"%s\",\"confidence\":%.2f",
+                              methods[method].name, methods[method].confidence);
+    }
+  else
+    g_string_append (worker->out, ",\"charset\":null");
+
+  g_string_append (worker->out, ",\"mime_type\":");
+  if (mime_type)
+    append_json_string (worker->out, mime_type);
+  else
+    g_string_append (worker->out, "null");
+
+  g_string_append_printf (worker->out,
+                          ",\"read_us\":%" G_GINT64_FORMAT
+                          ",\"charset_us\":%" G_GINT64_FORMAT
+                          ",\"mime_type_us\":%" G_GINT64_FORMAT "}\n",
+                          read_us, charset_us, mime_type_us);
+
+  worker->n_files++;
+}
+
+
+static gpointer
+worker_thread (gpointer data)
+{
+  Worker *worker = data;
+  Task   *task;
+
+  for (;;)
+    {
+      task = take_task (worker);
+
+      if (!task)
+        {
+          /* nothing left anywhere: wait until someone pushes, or all is done */
+          g_mutex_lock (&idle_lock);
+          g_atomic_int_inc (&n_idle);
+          while (!(task = take_task (worker)) && g_atomic_int_get (&n_pending) > 0)
+            g_cond_wait_until (&idle_cond, &idle_lock,
+                               g_get_monotonic_time () + 10 * G_TIME_SPAN_MILLISECOND);
+          g_atomic_int_add (&n_idle, -1);
+          g_mutex_unlock (&idle_lock);
+
+          if (!task)
+            break;
+        }
+
+      if (task->is_dir)
+        walk_directory (worker, task->path);
+      else
+        detect_file (worker, task->path);
+
+      if (worker->out->len >= DETECT_OUTPUT_FLUSH)
+        flush_output (worker);
+
+      finish_task (task);
+    }
+
+  flush_output (worker);
+
+  return NULL;
+}
+
+
+int
+main (int argc, char *argv[])
+{
+  static gchar   *here[] = { ".", NULL };
+  GOptionContext *context;
+  GError         *error = NULL;
+  struct stat     st;
+  gchar         **paths;
+  guint64         n_files = 0, n_dirs = 0, n_errors = 0;
+  gint64          start;
+  guint           i;
+
+  context = g_option_context_new ("[PATH...] - print the charset and MIME type of files as JSON lines");
+  g_option_context_add_main_entries (context, entries, NULL);
+  if (!g_option_context_parse (context, &argc, &argv, &error))
+    {
+      fprintf (stderr, "%s\n", error->message);
+      exit (EXIT_FAILURE);
+    }
+  g_option_context_free (context);
+
+  if (opt_head <= 0)
+    {
+      fprintf (stderr, "--head must be positive\n");
+      exit (EXIT_FAILURE);
+    }
+
+  n_workers = opt_threads > 0 ? (guint) opt_threads : g_get_num_processors ();
+  workers = g_new0 (Worker, n_workers);
+
+  for (i = 0; i < n_workers; i++)
+    {
+      g_mutex_init (&workers[i].lock);
+      g_queue_init (&workers[i].tasks);
+      workers[i].index = i;
+      workers[i].scratch = source_file_new (NULL, NULL, NULL);
+      workers[i].head = g_malloc (opt_head + 1 + SOURCE_FILE_SNIFF_CHUNK_SIZE);
+      workers[i].out = g_string_sized_new (DETECT_OUTPUT_FLUSH * 2);
+    }
+
+  start = g_get_monotonic_time ();
+
+  /* the paths given are shared out round robin, the rest is stolen */
+  paths = argc > 1 ? argv + 1 : here;
+  for (i = 0; paths[i]; i++)
+    {
+      Worker *worker = &workers[i % n_workers];
+
+      if (stat (paths[i], &st) != 0)
+        report_error (worker, paths[i], errno);
+      else if (S_ISDIR (st.st_mode) || S_ISREG (st.st_mode))
+        push_task (worker, g_strdup (paths[i]), S_ISDIR (st.st_mode));
+    }
+
+  for (i = 0; i < n_workers; i++)
+    workers[i].thread = g_thread_new ("detect", worker_thread, &workers[i]);
+
+  for (i = 0; i < n_workers; i++)
+    {
+      g_thread_join (workers[i].thread);
+      n_files += workers[i].n_files;
+      n_dirs += workers[i].n_dirs;
+      n_errors += workers[i].n_errors;
+      g_object_unref (workers[i].scratch);
+      g_free (workers[i].head);
+      g_string_free (workers[i].out, TRUE);
+      g_mutex_clear (&workers[i].lock);
+    }
+
+  fflush (stdout);
+
+  if (opt_stats)
+    {
+      gdouble seconds = (g_get_monotonic_time () - start) / (gdouble) G_USEC_PER_SEC;
+
+      fprintf (stderr,
+               "%" G_GUINT64_FORMAT " files, %" G_GUINT64_FORMAT " directories, "
+               "%" G_GUINT64_FORMAT " errors in %.2f s (%.0f files/s, %u threads)\n",
+               n_files, n_dirs, n_errors, seconds,
+               seconds > 0 ? n_files / seconds : 0, n_workers);
+    }
+
+  g_free (workers);
+
+  return n_errors ? EXIT_FAILURE : EXIT_SUCCESS;
+}